@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+#
+# ws63standin.py - Stand-in WS63 Boot ROM & Loader
+# Copyright (C) 2024-2025  Gong Zhile
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+"""
+Answers ws63flash on stdin/stdout the way a WS63 does: handshake, the
+loaderboot over ymodem, then baud changes, erases & images until the
+reset. What would be flashed lands in an image file, so a run can be
+checked without the board:
+
+  ws63flash --flash 'pty:python3 ws63standin.py -o flash.img' fw.fwpkg
+"""
+
+import argparse
+import os
+import random
+import select
+import struct
+import sys
+import time
+
+MAGIC = b'\xef\xbe\xad\xde'
+ACK, NAK, CAN, EOT, SOH, STX = 0x06, 0x15, 0x18, 0x04, 0x01, 0x02
+
+CMD_ACK = 0xe1
+CMD_HANDSHAKE = 0xf0
+CMD_SETBAUDR = 0x5a
+CMD_DOWNLOADI = 0xd2
+CMD_RST = 0x87
+
+ap = argparse.ArgumentParser(description='Stand-in WS63 on stdin/stdout.')
+ap.add_argument('-o', '--image', default='',
+                help='write the flash contents here on reset')
+ap.add_argument('--flash-size', type=lambda s: int(s, 0), default=8 << 20,
+                help='flash size in bytes (default 8M)')
+ap.add_argument('--nak-rate', type=float, default=0.0,
+                help='NAK this fraction of the good ymodem blocks')
+ap.add_argument('--max-baud', type=int, default=0,
+                help='corrupt replies above this rate, as a bad line does')
+ap.add_argument('--fifo', type=int, default=0,
+                help='drop what a command read brings past this many bytes,'
+                ' as an overrun FIFO does, unless flow control is on')
+ap.add_argument('--no-flow', action='store_true',
+                help='ignore the flow control byte of SETBAUDR')
+ap.add_argument('-v', '--verbose', action='store_true',
+                help='say what happens on stderr')
+args = ap.parse_args()
+
+rfd, wfd = sys.stdin.fileno(), sys.stdout.fileno()
+buf = bytearray()
+baud = 115200
+flow = False
+cmds = False			# the loader's command loop, where --fifo bites
+
+
+def log(*a):
+    if args.verbose:
+        print('standin:', *a, file=sys.stderr, flush=True)
+
+
+def crc16(data):
+    crc = 0
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xffff
+    return crc
+
+
+def fill(timeout):
+    r, _, _ = select.select([rfd], [], [], max(0.0, timeout))
+    if not r:
+        return False
+    try:
+        d = os.read(rfd, 65536)
+    except OSError:
+        d = b''
+    if not d:
+        log('host went away')
+        sys.exit(0)
+    if args.fifo and cmds and not flow and len(d) > args.fifo:
+        log('overrun, %d bytes lost' % (len(d) - args.fifo))
+        d = d[:args.fifo]
+    buf.extend(d)
+    return True
+
+
+def take(n, timeout):
+    end = time.monotonic() + timeout
+    while len(buf) < n:
+        if not fill(end - time.monotonic()) and time.monotonic() >= end:
+            return None
+    d = bytes(buf[:n])
+    del buf[:n]
+    return d
+
+
+def send(b):
+    os.write(wfd, b)
+
+
+def frame(cmd, payload):
+    body = bytes([cmd, ((cmd << 4) | (cmd >> 4)) & 0xff]) + payload
+    f = MAGIC + struct.pack('<H', len(body) + 8) + body
+    f += struct.pack('<H', crc16(f))
+    if args.max_baud and baud > args.max_baud:
+        f = f[:-1] + bytes([f[-1] ^ 0x5a])
+    return f
+
+
+def ack():
+    send(frame(CMD_ACK, b'\x5a\x00'))
+
+
+def read_cmd(timeout):
+    """Next command frame as (cmd, payload, crc ok), None on timeout"""
+    end = time.monotonic() + timeout
+    while True:
+        i = buf.find(MAGIC)
+        if i > 0:
+            del buf[:i]
+            i = 0
+        if i == 0 and len(buf) >= 6:
+            n = struct.unpack('<H', buf[4:6])[0]
+            if n < 10 or n > 1036:
+                del buf[:1]
+                continue
+            if len(buf) >= n:
+                f = bytes(buf[:n])
+                del buf[:n]
+                ok = struct.unpack('<H', f[-2:])[0] == crc16(f[:-2])
+                return f[6], f[8:-2], ok
+        if not fill(end - time.monotonic()) and time.monotonic() >= end:
+            return None
+
+
+def ymodem():
+    """Receive one file, returns (name, data) or None"""
+    name, size, seq, eot = None, 0, 0, False
+    out = bytearray()
+    send(b'C')
+    while True:
+        h = take(1, 10)
+        if h is None:
+            log('ymodem: timed out')
+            return None
+        c = h[0]
+        if c == EOT:
+            send(bytes([ACK]))
+            eot = True
+            continue
+        if c == CAN:
+            log('ymodem: cancelled')
+            return None
+        if c not in (SOH, STX):
+            continue
+        n = 128 if c == SOH else 1024
+        rest = take(n + 4, 3)
+        if rest is None:
+            log('ymodem: short block')
+            return None
+        data = rest[2:2 + n]
+        good = (rest[0] ^ rest[1] == 0xff
+                and struct.unpack('>H', rest[-2:])[0] == crc16(data))
+        if not good and name is None:
+            # Tail of the handshake flood, a NAK now would be taken
+            # for the header's and put the ACKs out of step
+            buf.clear()
+            continue
+        if not good or (rest[0] and random.random() < args.nak_rate):
+            send(bytes([NAK]))
+            continue
+        if rest[0] == 0 and name is None:
+            name = data.split(b'\0')[0].decode(errors='replace')
+            size = int(data[len(name) + 1:].split(b'\0')[0].split(b' ')[0]
+                       or b'0', 0)
+            seq = 1
+        elif rest[0] == 0 and eot:
+            send(bytes([ACK]))
+            break
+        elif rest[0] == (seq - 1) & 0xff:
+            pass			# ACK got lost, seen it already
+        elif rest[0] != seq & 0xff:
+            send(bytes([NAK]))
+            continue
+        else:
+            out += data
+            seq += 1
+        send(bytes([ACK]))
+    log('ymodem: got', name, size, 'bytes')
+    return name, bytes(out[:size])
+
+
+flash = bytearray(b'\xff' * args.flash_size)
+
+log('waiting for the handshake')
+while True:
+    r = read_cmd(60)
+    if r is None:
+        sys.exit(1)
+    if r[0] == CMD_HANDSHAKE and r[2]:
+        break
+ack()
+
+# Resent handshakes are still coming in, the ROM lets them pass
+while fill(0.05):
+    buf.clear()
+
+if ymodem() is None:
+    sys.exit(1)
+send(b'boot.\r\n')
+ack()
+cmds = True
+
+while True:
+    r = read_cmd(30)
+    if r is None:
+        log('idle, leaving')
+        break
+    cmd, pl, ok = r
+    if not ok:
+        continue
+    if cmd == CMD_SETBAUDR:
+        # Acknowledged at the old rate, then again at the new one
+        ack()
+        baud = struct.unpack('<I', pl[:4])[0]
+        flow = not args.no_flow and len(pl) > 7 and pl[7] != 0
+        log('baud', baud, 'rtscts' if flow else '')
+        time.sleep(0.02)
+        ack()
+    elif cmd == CMD_DOWNLOADI:
+        addr, ilen, eras = struct.unpack('<III', pl[:12])
+        log('download addr=%#x len=%#x erase=%#x' % (addr, ilen, eras))
+        if eras == 0xffffffff:
+            flash[:] = b'\xff' * len(flash)
+        else:
+            flash[addr:addr + eras] = b'\xff' * eras
+        ack()
+        if ilen:
+            cmds = False
+            f = ymodem()
+            cmds = True
+            if f:
+                flash[addr:addr + len(f[1])] = f[1]
+            send(b'\r\nwrite ok\r\n')
+            ack()
+    elif cmd == CMD_RST:
+        send(b'Reset device...\r\n')
+        log('reset')
+        break
+    else:
+        ack()
+
+if args.image:
+    with open(args.image, 'wb') as f:
+        f.write(flash)
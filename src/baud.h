@@ -28,6 +28,18 @@ struct baud_ipair {
 	speed_t speed;
 };
 
+/*
+  Whether any integer baudrate can be set, not just those of the table:
+  through IOSSIOSPEED on macOS, termios2 with BOTHER on Linux
+*/
+#if defined(__APPLE__) && defined(HAVE_DECL_IOSSIOSPEED)
+#define BAUD_ANY 1
+#elif defined(__linux__) && defined(HAVE_TERMIOS2)
+#define BAUD_ANY 1
+#else
+#define BAUD_ANY 0
+#endif
+
 #define AVAIL_BAUD_N (sizeof(avail_baud_tbl)/sizeof(*avail_baud_tbl))
 
 const static struct baud_ipair avail_baud_tbl[] = {
@@ -63,4 +75,13 @@ const static struct baud_ipair avail_baud_tbl[] = {
 #endif
 };
 
+/* Whether BAUD can be set, by the table or any rate at all */
+static inline int baud_avail(int baud)
+{
+	for (int i = 0; i < AVAIL_BAUD_N; i++)
+		if (avail_baud_tbl[i].baud == baud)
+			return 1;
+	return BAUD_ANY;
+}
+
 #endif
@@ -0,0 +1,110 @@
+/*
+  mkframes.c - Pre-frame the Loaderboot Blob for YModem at Build Time
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/*
+  Writes a C source to stdout holding the whole ymodem session of the
+  signed loaderboot, laid out as ymodem_xfer_frames() expects it, so
+  ws63flash sends it without building or CRCing anything at runtime.
+*/
+
+#include <config.h>
+
+#include "ymodem.h"
+#include "blob/ws63_loaderboot_signed.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LOADERBOOT_NAME "root_loaderboot_sign.bin"
+
+static size_t col;
+
+static void emit(const uint8_t *p, size_t len)
+{
+	for (size_t i = 0; i < len; i++, col++)
+		printf("%s0x%02x,", col % 12 ? " " : "\n  ", p[i]);
+}
+
+/* A 128 B frame numbered SEQ */
+static void emit_soh(int seq, const uint8_t *dat)
+{
+	uint8_t hdr[3] = { SOH, seq % 0x100, 0xff - seq % 0x100 };
+	uint16_t crc = htobe16(crc16_xmodem(dat, 128));
+
+	emit(hdr, sizeof(hdr));
+	emit(dat, 128);
+	emit((const uint8_t *) &crc, sizeof(crc));
+}
+
+int main(void)
+{
+	const uint8_t *dat = ws63_loaderboot_signed_bin;
+	size_t len = ws63_loaderboot_signed_len;
+	uint8_t blk0[128+5], tail[1024];
+	struct ymodem_frame fr;
+
+	printf("/*\n"
+	       "  WS63 LiteOS signed bootloader blob (%s),\n"
+	       "  as ymodem frames. Generated by mkframes, do not edit.\n"
+	       "*/\n\n"
+	       "#include \"blob/ws63_loaderboot_frames.h\"\n\n"
+	       "const unsigned char ws63_loaderboot_frames[] = {",
+	       LOADERBOOT_NAME);
+
+	ymodem_blk0_build(blk0, LOADERBOOT_NAME, len);
+	emit(blk0, sizeof(blk0));
+
+	for (size_t ofs = 0; ofs < len; ofs += 1024) {
+		const uint8_t *blk = dat + ofs;
+		int seq = ofs / 1024 + 1;
+
+		if (len - ofs < 1024) {
+			memset(tail, 0, sizeof(tail));
+			memcpy(tail, blk, len - ofs);
+			blk = tail;
+		}
+
+		/* The tail goes as SOH frames if ymodem_xfer() sends it so */
+		if (len - ofs < 1024 && ymodem_tail_soh(len - ofs)) {
+			for (size_t i = 0; i < len - ofs; i += 128, seq++)
+				emit_soh(seq, blk + i);
+			break;
+		}
+
+		ymodem_frame_build(&fr, seq, blk);
+		emit(fr.hdr, sizeof(fr.hdr));
+		emit(fr.dat, 1024);
+		emit(fr.crc, sizeof(fr.crc));
+	}
+
+	ymodem_blk0_build(blk0, NULL, 0);
+	emit(blk0, sizeof(blk0));
+
+	if (col != ymodem_pre_len(len)) {
+		fprintf(stderr, "mkframes: emitted %zu bytes, expected %zu\n",
+			col, ymodem_pre_len(len));
+		return EXIT_FAILURE;
+	}
+
+	printf("\n};\n\n"
+	       "const char ws63_loaderboot_frames_name[] = \"%s\";\n"
+	       "const unsigned int ws63_loaderboot_frames_len = %zu;\n",
+	       LOADERBOOT_NAME, len);
+
+	return fflush(stdout) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
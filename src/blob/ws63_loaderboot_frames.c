@@ -0,0 +1,2704 @@
+/*
+  WS63 LiteOS signed bootloader blob (root_loaderboot_sign.bin),
+  as ymodem frames. Generated by mkframes, do not edit.
+*/
+
+#include "blob/ws63_loaderboot_frames.h"
+
+const unsigned char ws63_loaderboot_frames[] = {
+  0x01, 0x00, 0xff, 0x72, 0x6f, 0x6f, 0x74, 0x5f, 0x6c, 0x6f, 0x61, 0x64,
+  0x65, 0x72, 0x62, 0x6f, 0x6f, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x2e,
+  0x62, 0x69, 0x6e, 0x00, 0x30, 0x78, 0x37, 0x63, 0x34, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+  0x2d, 0x02, 0x01, 0xfe, 0x1e, 0xc3, 0xa5, 0x4b, 0x00, 0x00, 0x01, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x12, 0xc8, 0x13, 0x2a, 0x12, 0xc8, 0x13, 0x2a, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4c, 0x62, 0x46,
+  0xb8, 0x59, 0x63, 0x15, 0xc9, 0x64, 0x3b, 0xef, 0x84, 0x54, 0x03, 0x50,
+  0xc4, 0x86, 0x05, 0x0e, 0xb3, 0x36, 0xcf, 0x46, 0xfb, 0x41, 0xf8, 0x13,
+  0xae, 0x1a, 0xb7, 0xd9, 0x1c, 0x5d, 0xdd, 0xbd, 0xaa, 0x50, 0x25, 0xe6,
+  0x27, 0x73, 0xe9, 0x23, 0x17, 0xe9, 0xaf, 0x1f, 0x39, 0x68, 0x4b, 0xdd,
+  0xf1, 0x7b, 0xdb, 0x1a, 0xd6, 0x0f, 0xaa, 0x2f, 0x66, 0x6e, 0xc5, 0x3f,
+  0x1e, 0xf0, 0xd2, 0x4b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x12, 0xc8, 0x13, 0x2a, 0x12, 0xc8, 0x13, 0x2a, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x98, 0x97, 0xc2, 0xb4, 0x9e, 0xf2, 0x1a, 0xa4, 0x7d, 0x66, 0x2b, 0xc9,
+  0x50, 0x5c, 0xeb, 0x56, 0x83, 0x4f, 0xc3, 0xbe, 0x10, 0x33, 0x26, 0x34,
+  0x64, 0xf1, 0x19, 0x81, 0xa3, 0x32, 0xcb, 0x34, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0xf0, 0xd2, 0x4b, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0x78, 0x00, 0x00, 0x66, 0x6b, 0x4c, 0x91,
+  0x1f, 0x4d, 0x0c, 0x32, 0x73, 0xca, 0x92, 0xde, 0x4a, 0x29, 0xdd, 0x9b,
+  0x92, 0xd6, 0x48, 0x6c, 0xe4, 0x1d, 0x86, 0x66, 0xfe, 0xd4, 0x43, 0x10,
+  0x2d, 0x59, 0x6c, 0x43, 0xc3, 0x87, 0x69, 0x1e, 0x00, 0x11, 0x22, 0x33,
+  0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+  0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb,
+  0xcc, 0xdd, 0xee, 0xff, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+  0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd2, 0xa4, 0xa9, 0x8c, 0x83, 0x53, 0x63, 0x67,
+  0x9e, 0xda, 0xc3, 0x4f, 0x98, 0x4b, 0xb8, 0x22, 0x80, 0xc7, 0x25, 0x83,
+  0xa5, 0x81, 0x82, 0xbf, 0x58, 0xa7, 0x60, 0x7c, 0xc7, 0x7f, 0x96, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x40, 0x00, 0x97, 0x62, 0xfe, 0xff, 0x93, 0x82, 0x02, 0x71,
+  0x13, 0x03, 0x05, 0x00, 0x93, 0x83, 0x05, 0x00, 0x03, 0x2e, 0x03, 0x00,
+  0x23, 0xa0, 0xc2, 0x01, 0x93, 0x82, 0x42, 0x00, 0x13, 0x03, 0x43, 0x00,
+  0x93, 0x83, 0xc3, 0xff, 0xe3, 0x46, 0x70, 0xfe, 0x97, 0x62, 0x00, 0x00,
+  0x93, 0x82, 0x02, 0xd0, 0x93, 0x82, 0x12, 0x00, 0x73, 0x90, 0x52, 0x30,
+  0x73, 0x50, 0x00, 0x30, 0x73, 0x50, 0x40, 0x30, 0x97, 0x31, 0xfe, 0xff,
+  0x93, 0x81, 0x81, 0x91, 0x17, 0x21, 0xfe, 0xff, 0x13, 0x01, 0x41, 0x83,
+  0x97, 0x02, 0xfe, 0xff, 0x93, 0x82, 0xc2, 0xc2, 0x17, 0x23, 0xfe, 0xff,
+  0x13, 0x03, 0x43, 0x02, 0x63, 0x8c, 0x62, 0x00, 0xb7, 0xb3, 0xbe, 0xef,
+  0x93, 0x83, 0xe3, 0xdd, 0x23, 0xa0, 0x72, 0x00, 0x93, 0x82, 0x42, 0x00,
+  0xe3, 0xcc, 0x62, 0xfe, 0x93, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x02, 0x02,
+  0xfd, 0x13, 0x02, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x93, 0x04, 0x00,
+  0x00, 0x13, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00, 0x13, 0x06, 0x00,
+  0x00, 0x93, 0x06, 0x00, 0x00, 0x13, 0x07, 0x00, 0x00, 0x93, 0x07, 0x00,
+  0x00, 0x13, 0x08, 0x00, 0x00, 0x93, 0x08, 0x00, 0x00, 0x13, 0x09, 0x00,
+  0x00, 0x93, 0x09, 0x00, 0x00, 0x13, 0x0a, 0x00, 0x00, 0x93, 0x0a, 0x00,
+  0x00, 0x13, 0x0b, 0x00, 0x00, 0x93, 0x0b, 0x00, 0x00, 0x13, 0x0c, 0x00,
+  0x00, 0x93, 0x0c, 0x00, 0x00, 0x13, 0x0d, 0x00, 0x00, 0x93, 0x0d, 0x00,
+  0x00, 0x13, 0x0e, 0x00, 0x00, 0x93, 0x0e, 0x00, 0x00, 0x13, 0x0f, 0x00,
+  0x00, 0x93, 0x0f, 0x00, 0x00, 0x97, 0x22, 0xfe, 0xff, 0x93, 0x82, 0xc2,
+  0xf9, 0x17, 0x73, 0x00, 0x00, 0x13, 0x03, 0x83, 0x5d, 0x93, 0x03, 0xc0,
+  0x0d, 0x63, 0x8e, 0x03, 0x00, 0x03, 0x2e, 0x03, 0x00, 0x23, 0xa0, 0xc2,
+  0x01, 0x93, 0x82, 0x42, 0x00, 0x13, 0x03, 0x43, 0x00, 0x93, 0x83, 0xc3,
+  0xff, 0xe3, 0x46, 0x70, 0xfe, 0x97, 0x22, 0xfe, 0xff, 0x93, 0x82, 0x42,
+  0x14, 0x17, 0x63, 0xfe, 0xff, 0x13, 0x03, 0x83, 0x5f, 0x63, 0x8a, 0x62,
+  0x00, 0x93, 0x03, 0x00, 0x00, 0x23, 0xa0, 0x72, 0x00, 0x93, 0x82, 0x42,
+  0x00, 0xe3, 0xcc, 0x62, 0xfe, 0x6f, 0x10, 0xa0, 0x76, 0xb0, 0x5f, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x5e, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2, 0x00, 0x4a, 0x53, 0xa2,
+  0x00, 0x4a, 0x53, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2, 0x00, 0x36, 0x4f, 0xa2,
+  0x00, 0x36, 0x4f, 0xa2, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x80, 0x11, 0x04, 0x22, 0xc0, 0xed,
+  0x3f, 0xd2, 0x42, 0x73, 0x90, 0x12, 0x34, 0x82, 0x5d, 0x12, 0x5d, 0xa2,
+  0x5c, 0x32, 0x5c, 0xc2, 0x5b, 0x52, 0x5b, 0xe2, 0x5a, 0x72, 0x5a, 0x86,
+  0x49, 0x16, 0x49, 0xa6, 0x44, 0x36, 0x44, 0xc6, 0x4f, 0x56, 0x4f, 0xe6,
+  0x4e, 0x76, 0x4e, 0x86, 0x58, 0x16, 0x58, 0xa6, 0x57, 0x36, 0x57, 0xc6,
+  0x56, 0x56, 0x56, 0xe6, 0x55, 0x76, 0x55, 0x8a, 0x43, 0x1a, 0x43, 0xaa,
+  0x42, 0xba, 0x40, 0x49, 0x61, 0x73, 0x00, 0x20, 0x30, 0x01, 0x47, 0x39,
+  0xa0, 0x18, 0x81, 0x38, 0x00, 0x21, 0x20, 0x22, 0x45, 0xb2, 0x45, 0x14,
+  0x81, 0xb6, 0x88, 0x32, 0x88, 0xaa, 0x87, 0x2e, 0x8e, 0xdd, 0xee, 0x63,
+  0xf1, 0xc5, 0x12, 0xc1, 0x66, 0x63, 0x6a, 0xd6, 0x1c, 0xb7, 0x06, 0x00,
+  0x01, 0x63, 0x65, 0xd6, 0x3a, 0x13, 0x53, 0x86, 0x01, 0xe1, 0x48, 0x97,
+  0x26, 0xfe, 0xff, 0x83, 0xa6, 0x26, 0xe6, 0x9a, 0x96, 0x94, 0x22, 0x13,
+  0x03, 0x00, 0x02, 0xb6, 0x98, 0x33, 0x03, 0x13, 0x41, 0x63, 0x0c, 0x03,
+  0x00, 0xb3, 0x95, 0x65, 0x00, 0xb3, 0x58, 0x15, 0x01, 0x33, 0x18, 0x66,
+  0x00, 0x33, 0xee, 0xb8, 0x00, 0xb3, 0x17, 0x65, 0x00, 0x93, 0x5e, 0x08,
+  0x01, 0x33, 0x5f, 0xde, 0x03, 0x13, 0x16, 0x08, 0x01, 0x41, 0x82, 0x93,
+  0xd6, 0x07, 0x01, 0xb3, 0x75, 0xde, 0x03, 0xb3, 0x0f, 0xe6, 0x03, 0x9b,
+  0xa6, 0xb6, 0x20, 0x63, 0xfa, 0xf6, 0x01, 0xc2, 0x96, 0x93, 0x05, 0xff,
+  0xff, 0x63, 0xe4, 0x06, 0x01, 0x63, 0xe5, 0xf6, 0x37, 0x2e, 0x8f, 0xb3,
+  0x85, 0xf6, 0x41, 0x33, 0xd5, 0xd5, 0x03, 0x93, 0x96, 0x07, 0x01, 0xc1,
+  0x82, 0xb3, 0xf5, 0xd5, 0x03, 0x33, 0x06, 0xa6, 0x02, 0x9b, 0xa7, 0xb6,
+  0x20, 0x63, 0xfa, 0xc7, 0x00, 0xc2, 0x97, 0x93, 0x06, 0xf5, 0xff, 0x63,
+  0xe4, 0x07, 0x01, 0x63, 0xeb, 0xc7, 0x32, 0x36, 0x85, 0x91, 0x8f, 0x1b,
+  0x25, 0xe5, 0x21, 0x81, 0x45, 0x11, 0xc7, 0xb3, 0xd7, 0x67, 0x00, 0x1c,
+  0xc3, 0x23, 0x22, 0x07, 0x00, 0x82, 0x80, 0x63, 0xf9, 0xd5, 0x00, 0x63,
+  0x0f, 0x07, 0x12, 0x08, 0xc3, 0x4c, 0xc3, 0x01, 0x45, 0x81, 0x45, 0x82,
+  0x80, 0xc1, 0x67, 0x63, 0xed, 0xf6, 0x0e, 0xb7, 0x07, 0x00, 0x01, 0x63,
+  0xea, 0xf6, 0x2c, 0x93, 0xd8, 0x86, 0x01, 0x61, 0x48, 0x97, 0x27, 0xfe,
+  0xff, 0x83, 0xa7, 0x87, 0xd9, 0xc6, 0x97, 0x03, 0xc3, 0x07, 0x00, 0x93,
+  0x0e, 0x00, 0x02, 0x42, 0x93, 0xb3, 0x8e, 0x6e, 0x40, 0x63, 0x95, 0x0e,
+  0x18, 0x63, 0xe4, 0xb6, 0x00, 0x63, 0x63, 0xc5, 0x2e, 0x33, 0x06, 0xc5,
+  0x40, 0x33, 0x35, 0xc5, 0x00, 0x95, 0x8d, 0x33, 0x8e, 0xa5, 0x40, 0x05,
+  0x45, 0x81, 0x45, 0x4d, 0xd3, 0x10, 0xc3, 0x23, 0x22, 0xc7, 0x01, 0x82,
+  0x80, 0x01, 0xe6, 0x85, 0x46, 0x33, 0xd8, 0xc6, 0x02, 0xc1, 0x66, 0x63,
+  0x60, 0xd8, 0x0c, 0xb7, 0x06, 0x00, 0x01, 0x63, 0x68, 0xd8, 0x26, 0x13,
+  0x56, 0x88, 0x01, 0xe1, 0x48, 0x97, 0x26, 0xfe, 0xff, 0x83, 0xa6, 0xc6,
+  0xd3, 0xb2, 0x96, 0x90, 0x22, 0x13, 0x03, 0x00, 0x02, 0x46, 0x96, 0x33,
+  0x03, 0xc3, 0x40, 0x63, 0x18, 0x03, 0x0a, 0x93, 0x1e, 0x08, 0x01, 0xb3,
+  0x86, 0x05, 0x41, 0x13, 0x5f, 0x08, 0x01, 0x93, 0xde, 0x0e, 0x01, 0x85,
+  0x45, 0x93, 0xd8, 0x07, 0x01, 0x33, 0xde, 0xe6, 0x03, 0xb3, 0xf6, 0xe6,
+  0x03, 0x33, 0x06, 0xde, 0x03, 0x9b, 0xa6, 0xd8, 0x20, 0x63, 0xfa, 0xc6,
+  0x00, 0xc2, 0x96, 0x13, 0x05, 0xfe, 0xff, 0x63, 0xe4, 0x06, 0x01, 0x63,
+  0xeb, 0xc6, 0x24, 0x2a, 0x8e, 0x33, 0x86, 0xc6, 0x40, 0x33, 0x55, 0xe6,
+  0x03, 0x93, 0x96, 0x07, 0x01, 0xc1, 0x82, 0x33, 0x76, 0xe6, 0x03, 0xb3,
+  0x08, 0xd5, 0x03, 0x9b, 0xa7, 0x57, 0x23, 0x02, 0x03, 0xfc, 0xc6, 0x20,
+  0x63, 0xfa, 0x17, 0x01, 0xc2, 0x97, 0x93, 0x06, 0xf5, 0xff, 0x63, 0xe4,
+  0x07, 0x01, 0x63, 0xeb, 0x17, 0x21, 0x36, 0x85, 0xb3, 0x87, 0x17, 0x41,
+  0x1b, 0x25, 0xc5, 0x21, 0xdd, 0xb5, 0x93, 0x07, 0xf0, 0x0f, 0x63, 0xf3,
+  0xd7, 0x1e, 0x93, 0xd8, 0x86, 0x00, 0x21, 0x48, 0x29, 0xb7, 0x32, 0x83,
+  0x93, 0x06, 0xf0, 0x0f, 0xe3, 0xfc, 0xc6, 0xe2, 0x13, 0x53, 0x86, 0x00,
+  0xa1, 0x48, 0x3d, 0xb5, 0x42, 0x86, 0x93, 0x06, 0xf0, 0x0f, 0xe3, 0xf6,
+  0x06, 0xf5, 0x13, 0x56, 0x88, 0x00, 0xa1, 0x48, 0x89, 0xb7, 0x81, 0x45,
+  0x01, 0x45, 0x82, 0x80, 0x33, 0x18, 0x68, 0x00, 0xb3, 0xd8, 0xc5, 0x00,
+  0x13, 0x5f, 0x08, 0x01, 0xb3, 0xdf, 0xe8, 0x03, 0x93, 0x1e, 0x08, 0x01,
+  0xb3, 0x95, 0x65, 0x00, 0x33, 0x56, 0xc5, 0x00, 0x93, 0xde, 0x0e, 0x01,
+  0x4d, 0x8e, 0x13, 0x5e, 0x06, 0x01, 0xb3, 0x17, 0x65, 0x00, 0xb3, 0xf8,
+  0xe8, 0x03, 0xb3, 0x85, 0xfe, 0x03, 0x1b, 0x25, 0x1e, 0x21, 0x63, 0x7b,
+  0xb5, 0x00, 0x42, 0x95, 0x93, 0x86, 0xff, 0xff, 0x63, 0x64, 0x05, 0x19,
+  0x63, 0x72, 0xb5, 0x18, 0xf9, 0x1f, 0x42, 0x95, 0x0d, 0x8d, 0xb3, 0x58,
+  0xe5, 0x03, 0x21, 0x9e, 0x33, 0x75, 0xe5, 0x03, 0xb3, 0x86, 0x1e, 0x03,
+  0x9b, 0x25, 0xa6, 0x20, 0x63, 0xfb, 0xd5, 0x00, 0xc2, 0x95, 0x13, 0x86,
+  0xf8, 0xff, 0x63, 0xeb, 0x05, 0x15, 0x63, 0xf9, 0xd5, 0x14, 0xf9, 0x18,
+  0xc2, 0x95, 0xb3, 0x86, 0xd5, 0x40, 0x9b, 0xa5, 0xf8, 0x21, 0xe5, 0xb5,
+  0x33, 0x58, 0x66, 0x00, 0xb3, 0x96, 0xd6, 0x01, 0xb3, 0x66, 0xd8, 0x00,
+  0xb3, 0xd7, 0x65, 0x00, 0x13, 0xde, 0x06, 0x01, 0xb3, 0xdf, 0xc7, 0x03,
+  0x93, 0x98, 0x06, 0x01, 0x93, 0xd8, 0x08, 0x01, 0x33, 0x58, 0x65, 0x00,
+  0x33, 0x1f, 0xd5, 0x01, 0xb3, 0x95, 0xd5, 0x01, 0xb3, 0x65, 0xb8, 0x00,
+  0x13, 0xd8, 0x05, 0x01, 0x33, 0x16, 0xd6, 0x01, 0xb3, 0xf7, 0xc7, 0x03,
+  0x33, 0x85, 0xf8, 0x03, 0x9b, 0x27, 0xf8, 0x20, 0x63, 0xfb, 0xa7, 0x00,
+  0xb6, 0x97, 0x13, 0x88, 0xff, 0xff, 0x63, 0xeb, 0xd7, 0x0e, 0x63, 0xf9,
+  0xa7, 0x0e, 0xf9, 0x1f, 0xb6, 0x97, 0x89, 0x8f, 0x33, 0xd5, 0xc7, 0x03,
+  0xa1, 0x9d, 0xb3, 0xf7, 0xc7, 0x03, 0xb3, 0x88, 0xa8, 0x02, 0x9b, 0xa5,
+  0xf5, 0x20, 0x63, 0xfb, 0x15, 0x01, 0xb6, 0x95, 0x93, 0x07, 0xf5, 0xff,
+  0x63, 0xe2, 0xd5, 0x0c, 0x63, 0xf0, 0x15, 0x0d, 0x79, 0x15, 0xb6, 0x95,
+  0xc1, 0x63, 0x1b, 0x25, 0xf5, 0x21, 0x93, 0x87, 0xf3, 0xff, 0x33, 0x78,
+  0xf5, 0x00, 0x13, 0x5e, 0x05, 0x01, 0xf1, 0x8f, 0x93, 0x5f, 0x06, 0x01,
+  0xb3, 0x02, 0xfe, 0x02, 0xb3, 0x88, 0x15, 0x41, 0xb3, 0x05, 0xf8, 0x03,
+  0x33, 0x08, 0xf8, 0x02, 0x96, 0x95, 0x9b, 0x85, 0x05, 0x61, 0x33, 0x0e,
+  0xfe, 0x03, 0x63, 0xf3, 0x55, 0x00, 0x1e, 0x9e, 0xc1, 0x67, 0xfd, 0x17,
+  0xb3, 0xff, 0xf5, 0x00, 0xb3, 0x77, 0xf8, 0x00, 0x1b, 0x08, 0xbe, 0x60,
+  0x9b, 0x87, 0xf7, 0x21, 0x63, 0xed, 0x08, 0x03, 0x63, 0x89, 0x08, 0x03,
+  0x81, 0x45, 0xe3, 0x0e, 0x07, 0xd4, 0xb3, 0x07, 0xff, 0x40, 0x33, 0x3f,
+  0xff, 0x00, 0xb3, 0x88, 0x08, 0x41, 0xb3, 0x88, 0xe8, 0x41, 0x33, 0x93,
+  0x68, 0x00, 0xb3, 0xd7, 0xd7, 0x01, 0xb3, 0x67, 0xf3, 0x00, 0xb3, 0xd8,
+  0xd8, 0x01, 0x1c, 0xc3, 0x23, 0x22, 0x17, 0x01, 0x82, 0x80, 0xe3, 0x79,
+  0xff, 0xfc, 0x33, 0x86, 0xc7, 0x40, 0xb3, 0xb7, 0xc7, 0x00, 0x33, 0x08,
+  0xd8, 0x40, 0x33, 0x08, 0xf8, 0x40, 0x7d, 0x15, 0xb2, 0x87, 0x6d, 0xbf,
+  0x13, 0x56, 0x08, 0x01, 0xc1, 0x48, 0x51, 0xbb, 0x93, 0xd8, 0x06, 0x01,
+  0x41, 0x48, 0x05, 0xbb, 0x01, 0x48, 0x35, 0xb3, 0x13, 0x53, 0x06, 0x01,
+  0xc1, 0x48, 0xa9, 0xb9, 0x3e, 0x85, 0x99, 0xb7, 0xb2, 0x88, 0x55, 0xbd,
+  0xc2, 0x8f, 0x11, 0xbf, 0xb6, 0x8f, 0x49, 0xb5, 0x79, 0x15, 0xc2, 0x97,
+  0xf5, 0xb3, 0x79, 0x15, 0xc2, 0x97, 0xf1, 0xb1, 0x79, 0x1f, 0xc2, 0x96,
+  0x61, 0xb9, 0x79, 0x1e, 0xc2, 0x96, 0x75, 0xb3, 0x2a, 0x86, 0x01, 0x45,
+  0x2d, 0xb3, 0x59, 0xca, 0x93, 0xf7, 0xf5, 0x0f, 0x1c, 0xa1, 0x33, 0x07,
+  0xc5, 0x00, 0xa3, 0x0f, 0xf7, 0xfe, 0xbb, 0x61, 0x26, 0x03, 0x1c, 0xb1,
+  0x3c, 0xa1, 0x23, 0x0f, 0xf7, 0xfe, 0xa3, 0x0e, 0xf7, 0xfe, 0xbb, 0x6d,
+  0x16, 0x07, 0x3c, 0xb1, 0x23, 0x0e, 0xf7, 0xfe, 0xa1, 0x46, 0x63, 0xf5,
+  0xc6, 0x06, 0xb3, 0x07, 0xa0, 0x40, 0x8d, 0x8b, 0x33, 0x07, 0xf5, 0x00,
+  0x1d, 0x8e, 0x93, 0xf5, 0xf5, 0x0f, 0x9f, 0x07, 0x01, 0x01, 0x01, 0x01,
+  0xb3, 0x85, 0xf5, 0x02, 0x71, 0x9a, 0xb3, 0x07, 0xc7, 0x00, 0x0c, 0xc3,
+  0x23, 0xae, 0xb7, 0xfe, 0x63, 0xf0, 0xc6, 0x04, 0x4c, 0xc3, 0x0c, 0xc7,
+  0x23, 0xaa, 0xb7, 0xfe, 0x23, 0xac, 0xb7, 0xfe, 0x3b, 0x6c, 0x06, 0x19,
+  0x4c, 0xc7, 0x0c, 0xcb, 0x4c, 0xcb, 0x0c, 0xcf, 0x23, 0xa2, 0xb7, 0xfe,
+  0x23, 0xa4, 0xb7, 0xfe, 0x23, 0xa6, 0xb7, 0xfe, 0x23, 0xa8, 0xb7, 0xfe,
+  0x93, 0x77, 0x47, 0x00, 0xe1, 0x07, 0xba, 0x97, 0xfd, 0x46, 0x32, 0x97,
+  0x33, 0x06, 0xf7, 0x40, 0x63, 0xe3, 0xc6, 0x00, 0x82, 0x80, 0x8c, 0xc3,
+  0xcc, 0xc3, 0x8c, 0xc7, 0xcc, 0xc7, 0x8c, 0xcb, 0xcc, 0xcb, 0x8c, 0xcf,
+  0xcc, 0xcf, 0x93, 0x87, 0x07, 0x02, 0xcd, 0xb7, 0xaa, 0x87, 0x13, 0xf7,
+  0x35, 0x00, 0x19, 0xc3, 0x63, 0x19, 0x06, 0x16, 0x13, 0xf8, 0x37, 0x00,
+  0x3d, 0x47, 0x63, 0x0e, 0x08, 0x18, 0xbb, 0x6a, 0x16, 0x20, 0x94, 0x21,
+  0x98, 0x41, 0xbb, 0x07, 0x78, 0x02, 0x8d, 0x48, 0x63, 0x05, 0x18, 0x23,
+  0x94, 0xa3, 0x94, 0x31, 0x75, 0x16, 0x8d, 0x05, 0x94, 0xb3, 0x83, 0xc6,
+  0xf5, 0xff, 0x8d, 0x07, 0x41, 0x4e, 0xa3, 0x8f, 0xd7, 0xfe, 0x03, 0xa3,
+  0x15, 0x00, 0x83, 0xa8, 0x55, 0x00, 0x41, 0x16, 0x13, 0x18, 0x83, 0x00,
+  0x1b, 0x27, 0xe8, 0x70, 0x03, 0xa8, 0x95, 0x00, 0x98, 0xc3, 0x93, 0x96,
+  0x88, 0x00, 0x13, 0x17, 0x88, 0x00, 0x1b, 0x27, 0x17, 0x71, 0x98, 0xc7,
+  0x03, 0xa7, 0xd5, 0x00, 0x9b, 0xa6, 0x66, 0x70, 0xd4, 0xc3, 0x93, 0x16,
+  0x87, 0x00, 0x9b, 0xa6, 0x06, 0x71, 0xd4, 0xc7, 0xc1, 0x05, 0xc1, 0x07,
+  0xe3, 0x61, 0xce, 0xfc, 0x13, 0x77, 0x06, 0x01, 0x51, 0xc3, 0x98, 0x21,
+  0xc1, 0x07, 0xc1, 0x05, 0x23, 0x88, 0xe7, 0xfe, 0x03, 0xc7, 0x15, 0xff,
+  0xa3, 0x88, 0xe7, 0xfe, 0x03, 0xc7, 0x25, 0xff, 0x23, 0x89, 0xe7, 0xfe,
+  0x03, 0xc7, 0x35, 0xff, 0xa3, 0x89, 0xe7, 0xfe, 0x03, 0xc7, 0x45, 0xff,
+  0x23, 0x8a, 0xe7, 0xfe, 0x03, 0xc7, 0x55, 0xff, 0xa3, 0x8a, 0xe7, 0xfe,
+  0x03, 0xc7, 0x65, 0xff, 0x23, 0x8b, 0xe7, 0xfe, 0x03, 0xc7, 0x75, 0xff,
+  0xa3, 0x8b, 0xe7, 0xfe, 0x03, 0xc7, 0x85, 0xff, 0x23, 0x8c, 0xe7, 0xfe,
+  0x03, 0xc7, 0x95, 0xff, 0xa3, 0x8c, 0xe7, 0xfe, 0x03, 0xc7, 0xa5, 0xff,
+  0x23, 0x8d, 0xe7, 0xfe, 0x03, 0xc7, 0xb5, 0xff, 0xa3, 0x8d, 0xe7, 0xfe,
+  0x03, 0xc7, 0xc5, 0xff, 0x23, 0x8e, 0xe7, 0xfe, 0x03, 0xc7, 0xd5, 0xff,
+  0xa3, 0x8e, 0xe7, 0xfe, 0x03, 0xc7, 0xe5, 0xff, 0x23, 0x8f, 0xe7, 0xfe,
+  0x03, 0xc7, 0xf5, 0xff, 0xa3, 0x8f, 0xe7, 0xfe, 0x13, 0x77, 0x86, 0x00,
+  0x31, 0xc3, 0x9e, 0x73, 0x02, 0x04, 0xfb, 0x98, 0x21, 0xa1, 0x07, 0xa1,
+  0x05, 0x23, 0x8c, 0xe7, 0xfe, 0x03, 0xc7, 0x95, 0xff, 0xa3, 0x8c, 0xe7,
+  0xfe, 0x03, 0xc7, 0xa5, 0xff, 0x23, 0x8d, 0xe7, 0xfe, 0x03, 0xc7, 0xb5,
+  0xff, 0xa3, 0x8d, 0xe7, 0xfe, 0x03, 0xc7, 0xc5, 0xff, 0x23, 0x8e, 0xe7,
+  0xfe, 0x03, 0xc7, 0xd5, 0xff, 0xa3, 0x8e, 0xe7, 0xfe, 0x03, 0xc7, 0xe5,
+  0xff, 0x23, 0x8f, 0xe7, 0xfe, 0x03, 0xc7, 0xf5, 0xff, 0xa3, 0x8f, 0xe7,
+  0xfe, 0x13, 0x77, 0x46, 0x00, 0x59, 0xc3, 0x98, 0x21, 0x91, 0x07, 0x91,
+  0x05, 0x23, 0x8e, 0xe7, 0xfe, 0x03, 0xc7, 0xd5, 0xff, 0xa3, 0x8e, 0xe7,
+  0xfe, 0x03, 0xc7, 0xe5, 0xff, 0x23, 0x8f, 0xe7, 0xfe, 0x03, 0xc7, 0xf5,
+  0xff, 0xa3, 0x8f, 0xe7, 0xfe, 0x8d, 0xa0, 0x85, 0x05, 0x03, 0xc7, 0xf5,
+  0xff, 0x85, 0x07, 0x7d, 0x16, 0xa3, 0x8f, 0xe7, 0xfe, 0xad, 0xbd, 0x94,
+  0x41, 0xc1, 0x07, 0xc1, 0x05, 0x23, 0xa8, 0xd7, 0xfe, 0x83, 0xa6, 0x45,
+  0xff, 0x41, 0x16, 0x23, 0xaa, 0xd7, 0xfe, 0x83, 0xa6, 0x85, 0xff, 0x23,
+  0xac, 0xd7, 0xfe, 0x83, 0xa6, 0xc5, 0xff, 0x23, 0xae, 0xd7, 0xfe, 0xe3,
+  0x6e, 0xc7, 0xfc, 0x13, 0x77, 0x86, 0x00, 0x11, 0xcb, 0x98, 0x41, 0xa1,
+  0x07, 0xa1, 0x05, 0x23, 0xac, 0xe7, 0xfe, 0x03, 0xa7, 0xc5, 0xff, 0x23,
+  0xae, 0xe7, 0xfe, 0x13, 0x77, 0x46, 0x00, 0x11, 0xc7, 0x98, 0x41, 0x91,
+  0x07, 0x91, 0x05, 0x23, 0xae, 0xe7, 0xfe, 0x13, 0x77, 0x26, 0x00, 0x11,
+  0xcb, 0x98, 0x21, 0x89, 0x07, 0x89, 0x05, 0x23, 0x8f, 0xe7, 0xfe, 0x03,
+  0xc7, 0xf5, 0xff, 0xa3, 0x8f, 0xe7, 0xfe, 0x05, 0x8a, 0x19, 0xc2, 0x98,
+  0x21, 0x98, 0xa3, 0x82, 0x80, 0x94, 0xa3, 0x94, 0x31, 0x79, 0x16, 0x89,
+  0x05, 0x94, 0xb3, 0x45, 0x4e, 0x89, 0x07, 0x03, 0xa3, 0x25, 0x00, 0x83,
+  0xa8, 0x65, 0x00, 0x41, 0x16, 0x13, 0x18, 0x03, 0x01, 0x1b, 0x27, 0xe8,
+  0x60, 0x03, 0xa8, 0xa5, 0x00, 0x98, 0xc3, 0x93, 0x96, 0x08, 0x01, 0x13,
+  0x17, 0x08, 0x01, 0x1b, 0x27, 0x17, 0x61, 0x98, 0xc7, 0x03, 0xa7, 0xe5,
+  0x00, 0x9b, 0xa6, 0x66, 0x60, 0xd4, 0xc3, 0x93, 0x16, 0x07, 0x01, 0x9b,
+  0xa6, 0x06, 0x61, 0xd4, 0xc7, 0xc1, 0x05, 0xc1, 0x07, 0xe3, 0x61, 0xce,
+  0xfc, 0x15, 0xbd, 0x94, 0xa3, 0x85, 0x05, 0x7d, 0x16, 0x85, 0x07, 0x49,
+  0x4e, 0x03, 0xa3, 0x35, 0x00, 0x83, 0xa8, 0x75, 0x00, 0x41, 0x16, 0x13,
+  0x18, 0x83, 0x01, 0x1b, 0x27, 0xe8, 0x50, 0x03, 0xa8, 0xb5, 0x00, 0x98,
+  0xc3, 0x93, 0x96, 0x88, 0x01, 0x13, 0x17, 0x88, 0x01, 0x1b, 0x27, 0x17,
+  0x51, 0x98, 0xc7, 0x03, 0xa7, 0xf5, 0x00, 0x9b, 0xa6, 0x66, 0x50, 0xd4,
+  0xc3, 0x93, 0x16, 0x87, 0x01, 0x9b, 0xa6, 0x06, 0x51, 0xd4, 0xc7, 0xc1,
+  0x05, 0xc1, 0x07, 0xe3, 0x61, 0xce, 0xfc, 0xdd, 0xb3, 0x2a, 0x96, 0x63,
+  0x0c, 0xc5, 0x00, 0x1c, 0x21, 0x98, 0x21, 0x63, 0x85, 0xe7, 0x00, 0x33,
+  0x85, 0xe7, 0x40, 0x82, 0x80, 0x05, 0x05, 0x85, 0x05, 0xed, 0xb7, 0x01,
+  0x45, 0x82, 0x80, 0xaa, 0x87, 0x13, 0xf7, 0x37, 0x00, 0x1d, 0xe3, 0x9f,
+  0x05, 0xff, 0xfe, 0xfe, 0xfe, 0x1f, 0x06, 0x80, 0x80, 0x80, 0x80, 0x94,
+  0x43, 0x33, 0x87, 0xb6, 0x00, 0x93, 0xc6, 0xf6, 0xff, 0x75, 0x8f, 0x71,
+  0x8f, 0x01, 0xcf, 0x98, 0x23, 0x09, 0xc7, 0x85, 0x07, 0xed, 0xbf, 0x98,
+  0x23, 0x01, 0xe7, 0x33, 0x85, 0xa7, 0x40, 0x82, 0x80, 0x85, 0x07, 0xe9,
+  0xb7, 0x91, 0x07, 0xe1, 0xbf, 0x18, 0x80, 0xef, 0x30, 0x70, 0x67, 0xb7,
+  0x27, 0x00, 0x40, 0x11, 0x47, 0x23, 0x98, 0xe7, 0x10, 0x01, 0xa0, 0x1f,
+  0x05, 0xd8, 0x25, 0xa0, 0x00, 0x82, 0x80, 0x18, 0x80, 0x2a, 0x86, 0xd1,
+  0x46, 0xd1, 0x45, 0x1f, 0x05, 0xd8, 0x25, 0xa0, 0x00, 0xef, 0x40, 0x00,
+  0x77, 0x01, 0xc5, 0x37, 0x05, 0x00, 0x80, 0x11, 0x05, 0x14, 0x80, 0x58,
+  0x80, 0x9f, 0x07, 0xec, 0x25, 0xa0, 0x00, 0x80, 0x43, 0x3c, 0x28, 0x13,
+  0x09, 0x34, 0x01, 0xbd, 0x8b, 0x99, 0xc7, 0x93, 0x05, 0x50, 0x08, 0x4a,
+  0x85, 0x50, 0x80, 0x6f, 0x30, 0xf0, 0x42, 0x93, 0x06, 0x50, 0x40, 0x01,
+  0x46, 0x93, 0x05, 0x50, 0x40, 0x4a, 0x85, 0x44, 0x40, 0xef, 0x40, 0xc0,
+  0x76, 0x85, 0x47, 0x3c, 0xb8, 0x1c, 0x38, 0x10, 0x44, 0x93, 0x09, 0x64,
+  0x01, 0x5c, 0xa8, 0x93, 0xc7, 0xf7, 0xff, 0x5c, 0xb8, 0xad, 0x46, 0x93,
+  0x05, 0x00, 0x08, 0x4e, 0x85, 0xef, 0x40, 0x40, 0x71, 0x29, 0xe5, 0x93,
+  0x07, 0x14, 0x02, 0x26, 0x87, 0xbe, 0x86, 0x3e, 0x86, 0x29, 0x45, 0xb3,
+  0x05, 0xf6, 0x40, 0x63, 0x4d, 0xe0, 0x02, 0x33, 0x87, 0xb7, 0x00, 0x9b,
+  0x87, 0xb7, 0x82, 0x7d, 0x17, 0x63, 0x90, 0xf6, 0x04, 0x13, 0x06, 0x00,
+  0x08, 0xce, 0x85, 0x01, 0x45, 0xef, 0x00, 0x30, 0x24, 0x93, 0x57, 0x85,
+  0x00, 0x23, 0x0b, 0xf4, 0x08, 0xa3, 0x0b, 0xa4, 0x08, 0x93, 0x05, 0x50,
+  0x08, 0x4a, 0x85, 0xef, 0x30, 0x70, 0x3b, 0x89, 0x47, 0x1c, 0xa8, 0x54,
+  0x80, 0xb3, 0x65, 0xa7, 0x02, 0x05, 0x06, 0x93, 0x85, 0x05, 0x03, 0xa3,
+  0x0f, 0xb6, 0xfe, 0x33, 0x47, 0xa7, 0x02, 0x45, 0xbf, 0x0c, 0x23, 0x90,
+  0x22, 0x85, 0x06, 0xa3, 0x8f, 0xb6, 0xfe, 0x10, 0xa3, 0x4d, 0xbf, 0x58,
+  0x80, 0x9f, 0x07, 0xec, 0x25, 0xa0, 0x00, 0x80, 0x43, 0x3c, 0x28, 0x13,
+  0x09, 0x34, 0x01, 0xbd, 0x8b, 0x81, 0xcf, 0x3c, 0x38, 0x93, 0x05, 0x50,
+  0x08, 0x3b, 0x82, 0x07, 0x01, 0x93, 0x05, 0x50, 0x40, 0x4a, 0x85, 0x50,
+  0x80, 0x6f, 0x30, 0x50, 0x36, 0x5c, 0x44, 0x44, 0x40, 0x69, 0x46, 0x93,
+  0x06, 0x50, 0x40, 0x9d, 0x8c, 0x95, 0x47, 0x1c, 0xa8, 0x93, 0x05, 0x50,
+  0x40, 0x4a, 0x85, 0xef, 0x40, 0xa0, 0x69, 0x89, 0x47, 0x3c, 0xb8, 0x1c,
+  0x38, 0x93, 0x09, 0x64, 0x01, 0x10, 0x40, 0x85, 0x07, 0x81, 0x9f, 0x1c,
+  0xb8, 0x5c, 0xa8, 0x93, 0xc7, 0xf7, 0xff, 0x5c, 0xb8, 0x5c, 0x44, 0x3b,
+  0xf1, 0x14, 0x81, 0x05, 0x47, 0x38, 0xb8, 0xa6, 0x86, 0x3e, 0x96, 0x93,
+  0x05, 0x00, 0x08, 0x4e, 0x85, 0xef, 0x40, 0x00, 0x63, 0x2d, 0xe5, 0xce,
+  0x85, 0x13, 0x06, 0x00, 0x08, 0xef, 0x00, 0x30, 0x18, 0x93, 0x57, 0x85,
+  0x00, 0x23, 0x0b, 0xf4, 0x08, 0xa3, 0x0b, 0xa4, 0x08, 0x93, 0x05, 0x50,
+  0x08, 0x4a, 0x85, 0xef, 0x30, 0x70, 0x2f, 0x5c, 0x44, 0xbe, 0x94, 0x44,
+  0xc4, 0x50, 0x80, 0x6f, 0x30, 0xb0, 0x4c, 0x13, 0x07, 0x00, 0x40, 0x63,
+  0x76, 0x97, 0x00, 0x11, 0x47, 0x18, 0xa8, 0x93, 0x04, 0x00, 0x40, 0xa6,
+  0x86, 0x3e, 0x96, 0x93, 0x05, 0x00, 0x40, 0x4e, 0x85, 0xef, 0x40, 0x40,
+  0x5e, 0x19, 0xed, 0xce, 0x85, 0x13, 0x06, 0x00, 0x40, 0xef, 0x00, 0x70,
+  0x13, 0x93, 0x57, 0x85, 0x00, 0x23, 0x0b, 0xf4, 0x40, 0xa3, 0x0b, 0xa4,
+  0x40, 0x93, 0x05, 0x50, 0x40, 0x55, 0xbf, 0x54, 0x80, 0x38, 0x80, 0x9f,
+  0x07, 0xec, 0x25, 0xa0, 0x00, 0x80, 0x43, 0x93, 0x06, 0x00, 0x08, 0x01,
+  0x46, 0x93, 0x04, 0x34, 0x01, 0x93, 0x05, 0x50, 0x40, 0x26, 0x85, 0xef,
+  0x40, 0xe0, 0x5d, 0x85, 0x47, 0x3c, 0xb8, 0xfd, 0x57, 0x5c, 0xb8, 0x13,
+  0x06, 0x00, 0x08, 0x93, 0x05, 0x64, 0x01, 0x23, 0x0a, 0x04, 0x00, 0x01,
+  0x45, 0xef, 0x00, 0xb0, 0x0e, 0x93, 0x57, 0x85, 0x00, 0x23, 0x0b, 0x50,
+  0x03, 0x02, 0x05, 0xfa, 0xf4, 0x08, 0xa3, 0x0b, 0xa4, 0x08, 0x93, 0x05,
+  0x50, 0x08, 0x26, 0x85, 0xef, 0x30, 0xf0, 0x25, 0x9d, 0x47, 0x1c, 0xa8,
+  0x34, 0x80, 0x58, 0x80, 0x2e, 0x84, 0xaa, 0x84, 0xb2, 0x89, 0xf9, 0x3b,
+  0x2a, 0x89, 0xef, 0x30, 0x90, 0x42, 0xbb, 0x16, 0x14, 0xff, 0xef, 0x00,
+  0x10, 0x5d, 0x11, 0xcd, 0x83, 0x27, 0xc9, 0x00, 0xa2, 0x85, 0x26, 0x85,
+  0x82, 0x97, 0x11, 0xcd, 0x1f, 0x05, 0x22, 0x36, 0x00, 0x00, 0xef, 0x30,
+  0x90, 0x2e, 0x7d, 0x55, 0x54, 0x80, 0x83, 0x27, 0xc9, 0x00, 0xfd, 0x55,
+  0x82, 0x97, 0x6d, 0xf5, 0x7d, 0x54, 0xef, 0x30, 0x50, 0x3f, 0x1f, 0x05,
+  0x00, 0x69, 0xa2, 0x00, 0xef, 0x30, 0x50, 0x2f, 0x13, 0x05, 0xa0, 0x05,
+  0xb1, 0x2c, 0xce, 0x86, 0x01, 0x46, 0xa2, 0x85, 0x26, 0x85, 0xef, 0x00,
+  0xf0, 0x09, 0x33, 0x35, 0xa0, 0x00, 0x33, 0x05, 0xa0, 0x40, 0xe9, 0xb7,
+  0x45, 0xf8, 0xc9, 0xbf, 0x49, 0xbf, 0x98, 0x81, 0x37, 0x24, 0xa0, 0x00,
+  0x83, 0x27, 0xc4, 0x5e, 0xaa, 0x84, 0x2e, 0x89, 0x13, 0x04, 0xc4, 0x5e,
+  0x91, 0xe7, 0x13, 0x05, 0x80, 0x41, 0xef, 0x30, 0x90, 0x4b, 0x08, 0xc0,
+  0x08, 0x40, 0xfd, 0x5b, 0x41, 0xc9, 0x93, 0x06, 0x80, 0x41, 0x01, 0x46,
+  0x93, 0x05, 0x80, 0x41, 0xef, 0x40, 0x60, 0x50, 0x1c, 0x40, 0x37, 0x07,
+  0x20, 0x00, 0xba, 0x94, 0x84, 0xc3, 0x1c, 0x40, 0x1f, 0x07, 0x14, 0x69,
+  0xa2, 0x00, 0x13, 0x05, 0xa0, 0x05, 0x98, 0xc7, 0x05, 0x47, 0x23, 0xa2,
+  0x27, 0x01, 0x98, 0xab, 0xf5, 0x22, 0x00, 0x40, 0x9f, 0x04, 0x80, 0x96,
+  0x98, 0x00, 0x37, 0x79, 0xa2, 0x00, 0x93, 0x09, 0x30, 0x04, 0x13, 0x09,
+  0x89, 0x8e, 0x26, 0x8a, 0x9f, 0x0a, 0x80, 0x84, 0x1e, 0x00, 0x93, 0x05,
+  0xf1, 0x00, 0x26, 0x85, 0xef, 0x30, 0x70, 0x20, 0xaa, 0x8b, 0x75, 0xf9,
+  0x03, 0x4b, 0xf1, 0x00, 0x63, 0x1d, 0x3b, 0x01, 0x1c, 0x28, 0x23, 0x09,
+  0x04, 0x00, 0xbb, 0x8d, 0x17, 0x03, 0xbb, 0x80, 0x27, 0x06, 0x3b, 0x97,
+  0xf7, 0x01, 0x09, 0x33, 0xd9, 0xbf, 0xbb, 0x1e, 0x0b, 0x06, 0x1c, 0x28,
+  0x23, 0x09, 0x04, 0x00, 0x3b, 0x94, 0x07, 0x07, 0x13, 0x05, 0x40, 0x06,
+  0xef, 0x30, 0xf0, 0x0e, 0x5e, 0x85, 0x94, 0x81, 0x3b, 0x83, 0x17, 0x04,
+  0x3b, 0x84, 0x07, 0x05, 0xbb, 0x9c, 0xe7, 0x02, 0x8d, 0x47, 0x1c, 0xa8,
+  0xd6, 0x84, 0x65, 0xb7, 0x11, 0x45, 0xef, 0x30, 0x50, 0x0d, 0x23, 0x08,
+  0x64, 0x01, 0x71, 0xbf, 0x3b, 0x10, 0x1b, 0x15, 0x3c, 0x28, 0xbd, 0x8b,
+  0x3c, 0xa8, 0x3e, 0x28, 0x85, 0x07, 0xbd, 0x8b, 0x3c, 0xa8, 0xa9, 0xc7,
+  0x1c, 0x28, 0xf9, 0x17, 0x81, 0x9f, 0x3b, 0xf0, 0xe7, 0x06, 0x9b, 0x07,
+  0xf9, 0x04, 0x9c, 0x43, 0x82, 0x87, 0x79, 0x39, 0xd2, 0x84, 0x85, 0xbf,
+  0xa1, 0x3b, 0xb5, 0xb7, 0x11, 0x45, 0xef, 0x30, 0x90, 0x09, 0x99, 0x47,
+  0x1c, 0xa8, 0x85, 0xb7, 0x2d, 0x35, 0xb1, 0xbf, 0xbb, 0x16, 0xdb, 0x18,
+  0x3c, 0x28, 0xc1, 0x9b, 0x3c, 0xa8, 0x1c, 0x48, 0xd1, 0x83, 0x85, 0x07,
+  0xbd, 0x8b, 0x13, 0x97, 0x47, 0x00, 0x38, 0xa8, 0xbb, 0x90, 0xd7, 0x03,
+  0xfd, 0x5b, 0xbd, 0xbf, 0x68, 0x82, 0x14, 0x2d, 0x93, 0x05, 0xf1, 0x01,
+  0x2a, 0x89, 0x36, 0xc6, 0x03, 0x2a, 0xc5, 0x00, 0x83, 0x29, 0x05, 0x01,
+  0x44, 0x49, 0xa3, 0x0f, 0x01, 0x00, 0xef, 0x00, 0xf0, 0x42, 0x2a, 0x84,
+  0xb2, 0x46, 0x09, 0xc9, 0xaa, 0x85, 0x1f, 0x05, 0x9c, 0x69, 0xa2, 0x00,
+  0xef, 0x30, 0xf0, 0x17, 0x22, 0x85, 0x64, 0x82, 0x83, 0x47, 0xf1, 0x01,
+  0xe5, 0xdf, 0x63, 0x89, 0x09, 0x00, 0x99, 0xc0, 0x63, 0xe6, 0x34, 0x01,
+  0xb7, 0x07, 0x40, 0x00, 0x63, 0xf9, 0x37, 0x05, 0x1f, 0x05, 0xb0, 0x69,
+  0xa2, 0x00, 0xef, 0x30, 0x70, 0x14, 0x1f, 0x05, 0xc0, 0x69, 0xa2, 0x00,
+  0xef, 0x30, 0xf0, 0x02, 0x85, 0x45, 0x52, 0x85, 0xef, 0x30, 0xf0, 0x07,
+  0x1f, 0x05, 0xd0, 0x69, 0xa2, 0x00, 0xef, 0x30, 0xd0, 0x01, 0x85, 0x45,
+  0x4e, 0x85, 0xef, 0x30, 0xd0, 0x06, 0x1f, 0x05, 0xdc, 0x69, 0xa2, 0x00,
+  0xef, 0x30, 0xb0, 0x00, 0x85, 0x45, 0x26, 0x85, 0xef, 0x30, 0xb0, 0x05,
+  0x1f, 0x05, 0x48, 0x74, 0xa2, 0x00, 0xef, 0x30, 0x80, 0x7f, 0x7d, 0x54,
+  0x61, 0xbf, 0x83, 0x47, 0xa9, 0x00, 0x37, 0x06, 0x40, 0x00, 0xa6, 0x85,
+  0x52, 0x85, 0xbb, 0x92, 0x07, 0x78, 0x39, 0x3d, 0x2a, 0x84, 0x49, 0xb7,
+  0x6d, 0x33, 0xed, 0xbf, 0x18, 0x80, 0x4c, 0x45, 0xb7, 0x07, 0x40, 0x00,
+  0x13, 0x87, 0xf5, 0xff, 0x63, 0x69, 0xf7, 0x00, 0x1f, 0x05, 0x00, 0x6a,
+  0xa2, 0x00, 0xef, 0x30, 0xf0, 0x0c, 0x7d, 0x55, 0x14, 0x80, 0x08, 0x49,
+  0x13, 0x77, 0x35, 0x00, 0x09, 0xc7, 0x1f, 0x05, 0x14, 0x6a, 0xa2, 0x00,
+  0xed, 0xb7, 0x33, 0x87, 0xa5, 0x00, 0x63, 0xf6, 0xe7, 0x00, 0x1f, 0x05,
+  0x28, 0x6a, 0xa2, 0x00, 0xe9, 0xbf, 0x10, 0x80, 0xd9, 0xbb, 0x18, 0x80,
+  0xef, 0x00, 0x50, 0x2f, 0x01, 0xc5, 0x10, 0x80, 0x6f, 0x00, 0x50, 0x25,
+  0x7d, 0x55, 0x14, 0x80, 0x28, 0x9f, 0x13, 0x01, 0x01, 0xde, 0x2a, 0x84,
+  0x13, 0x06, 0x00, 0x41, 0x81, 0x45, 0x0a, 0x85, 0xef, 0xf0, 0x0f, 0xf7,
+  0x9f, 0x07, 0xef, 0xbe, 0xad, 0xde, 0x29, 0x46, 0x3e, 0xc2, 0x23, 0x06,
+  0x81, 0x00, 0x9f, 0x07, 0x0c, 0x00, 0xe1, 0x1e, 0x13, 0x44, 0xf4, 0xff,
+  0x4c, 0x00, 0x01, 0x45, 0x3e, 0xc4, 0xa3, 0x06, 0x81, 0x00, 0xdd, 0x23,
+  0x83, 0x55, 0x81, 0x00, 0x23, 0x16, 0xa1, 0x40, 0x48, 0x00, 0xf9, 0x15,
+  0xef, 0x30, 0x20, 0x76, 0x13, 0x05, 0xc1, 0x40, 0x89, 0x45, 0xef, 0x30,
+  0x80, 0x75, 0x13, 0x01, 0x01, 0x41, 0x24, 0x80, 0x18, 0x80, 0x1f, 0x05,
+  0xec, 0x69, 0xa2, 0x00, 0xef, 0x30, 0x10, 0x03, 0x13, 0x05, 0xa0, 0x05,
+  0x61, 0x3f, 0x15, 0x45, 0xef, 0x30, 0x20, 0x6f, 0x5d, 0x3c, 0x01, 0x45,
+  0x14, 0x80, 0x98, 0x81, 0x2a, 0x84, 0x9f, 0x09, 0x80, 0x84, 0x1e, 0x00,
+  0x1f, 0x0a, 0xef, 0xbe, 0xad, 0xde, 0x13, 0x09, 0x44, 0x00, 0x23, 0x00,
+  0x04, 0x00, 0x23, 0x11, 0x04, 0x00, 0x93, 0x06, 0xc0, 0x40, 0x01, 0x46,
+  0x93, 0x05, 0xc0, 0x40, 0x4a, 0x85, 0xef, 0x40, 0x80, 0x25, 0x49, 0xcd,
+  0x13, 0x05, 0x50, 0x0a, 0xa1, 0x3f, 0xf1, 0xbf, 0xef, 0x30, 0xb0, 0x0d,
+  0x93, 0x05, 0xb1, 0x00, 0x4e, 0x85, 0xef, 0x30, 0x80, 0x78, 0x2a, 0x8b,
+  0x05, 0xed, 0x85, 0x0a, 0xc2, 0x0a, 0x93, 0xda, 0x0a, 0x01, 0x89, 0xc4,
+  0x23, 0x22, 0x04, 0x00, 0x23, 0x00, 0x04, 0x00, 0x1c, 0x20, 0x03, 0x47,
+  0xb1, 0x00, 0xbb, 0xfd, 0x07, 0x04, 0x14, 0x08, 0x52, 0xc6, 0xbe, 0x96,
+  0x83, 0xc6, 0xc6, 0xff, 0x63, 0x9b, 0xe6, 0x00, 0xca, 0x97, 0x94, 0xa3,
+  0x1c, 0x20, 0x85, 0x07, 0x1c, 0xa0, 0x81, 0x44, 0xe3, 0x9c, 0x7a, 0xfb,
+  0x75, 0xb7, 0x93, 0x07, 0xf0, 0x0e, 0x85, 0x44, 0xe3, 0x1a, 0xf7, 0xfe,
+  0xbd, 0x57, 0x5c, 0xa0, 0x04, 0xa0, 0xe5, 0xb7, 0xca, 0x97, 0x98, 0xa3,
+  0x1c, 0x20, 0x91, 0xc7, 0x16, 0x24, 0x13, 0x07, 0x00, 0x40, 0x63, 0x6f,
+  0xd7, 0x00, 0x85, 0x07, 0x81, 0x9f, 0x1c, 0xa0, 0xbb, 0xe3, 0xf7, 0x08,
+  0x23, 0x11, 0x04, 0x00, 0x93, 0x04, 0xc4, 0x00, 0x9f, 0x0a, 0xa0, 0x86,
+  0x01, 0x00, 0x2d, 0xa0, 0x85, 0x44, 0x6d, 0xbf, 0x2b, 0x19, 0x02, 0x06,
+  0xf9, 0x81, 0x4a, 0x81, 0x44, 0x93, 0x0b, 0x50, 0x06, 0x45, 0xbf, 0x6c,
+  0x00, 0x56, 0x85, 0xef, 0x30, 0x40, 0x6f, 0x39, 0xf9, 0x3e, 0x20, 0x13,
+  0x87, 0x17, 0x00, 0x3a, 0xa0, 0x03, 0x47, 0xc1, 0x00, 0xa6, 0x97, 0x98,
+  0xa3, 0x1e, 0x24, 0x36, 0x20, 0x13, 0x87, 0x87, 0xff, 0xe3, 0xef, 0xe6,
+  0xfc, 0x13, 0x87, 0x77, 0xff, 0x26, 0x97, 0xa6, 0x97, 0x14, 0x23, 0x83,
+  0xc7, 0x67, 0xff, 0x9b, 0xa7, 0xd7, 0x10, 0x23, 0x16, 0xf4, 0x40, 0x23,
+  0x00, 0x07, 0x00, 0x1e, 0x24, 0xbe, 0x94, 0x23, 0x8b, 0x04, 0xfe, 0x12,
+  0x24, 0x3a, 0x20, 0x93, 0x07, 0x86, 0xff, 0xe3, 0x17, 0xf7, 0xf0, 0x79,
+  0x16, 0xca, 0x85, 0x01, 0x45, 0xb5, 0x29, 0x83, 0x57, 0xc4, 0x40, 0xe3,
+  0x9f, 0xa7, 0xee, 0x2c, 0x24, 0x9f, 0x07, 0x64, 0x69, 0xa2, 0x00, 0x9d,
+  0x46, 0x98, 0x23, 0x63, 0x18, 0xb7, 0x02, 0xd8, 0x43, 0x0d, 0xc7, 0x22,
+  0x85, 0x02, 0x97, 0xe3, 0x11, 0x05, 0xee, 0xef, 0x30, 0x00, 0x7c, 0x13,
+  0x05, 0xa0, 0x05, 0x0d, 0x3d, 0x1f, 0x05, 0x30, 0x69, 0xa2, 0x00, 0xef,
+  0x30, 0xa0, 0x6b, 0x1f, 0x05, 0x48, 0x69, 0xa2, 0x00, 0xef, 0x30, 0x00,
+  0x6b, 0x4d, 0xb5, 0x05, 0x0b, 0xa1, 0x07, 0xe3, 0x15, 0xdb, 0xfc, 0x1f,
+  0x05, 0x20, 0x69, 0xa2, 0x00, 0xef, 0x30, 0xe0, 0x6a, 0x75, 0xb5, 0x48,
+  0x81, 0x7d, 0x59, 0x9f, 0x04, 0x40, 0x42, 0x0f, 0x00, 0x7d, 0x54, 0x93,
+  0x05, 0xf1, 0x00, 0x26, 0x85, 0xa3, 0x07, 0x21, 0x01, 0xef, 0x30, 0xe0,
+  0x62, 0xe3, 0x19, 0x85, 0xfe, 0x44, 0x81, 0xc8, 0x81, 0xfd, 0x57, 0x37,
+  0x24, 0xa0, 0x00, 0xa3, 0x05, 0xf1, 0x00, 0x23, 0x06, 0xf1, 0x00, 0xa3,
+  0x06, 0xf1, 0x00, 0x23, 0x07, 0xf1, 0x00, 0x09, 0x67, 0x93, 0x07, 0x04,
+  0x5f, 0xba, 0x97, 0xdc, 0x33, 0x37, 0x49, 0xa0, 0x00, 0x13, 0x04, 0x04,
+  0x5f, 0x13, 0x09, 0x09, 0x5f, 0x91, 0xc7, 0x19, 0x45, 0xef, 0x30, 0x60,
+  0x51, 0xa3, 0x02, 0x09, 0x00, 0xfd, 0x57, 0xa3, 0x07, 0xf1, 0x00, 0x81,
+  0x49, 0x81, 0x44, 0x1f, 0x0b, 0x40, 0x42, 0x0f, 0x00, 0x29, 0x4a, 0xb1,
+  0x4a, 0xe1, 0x4b, 0x0d, 0x4c, 0x89, 0x4c, 0x11, 0x4d, 0x93, 0x05, 0xf1,
+  0x00, 0x5a, 0x85, 0xef, 0x30, 0x80, 0x5c, 0x09, 0xc9, 0xbd, 0x3f, 0x51,
+  0x45, 0xef, 0x30, 0xe0, 0x4d, 0x1f, 0x05, 0xa6, 0x69, 0x5a, 0xc3, 0x01,
+  0xa2, 0x83, 0x47, 0xf1, 0x00, 0x85, 0x04, 0x63, 0x8c, 0x47, 0x0d, 0x63,
+  0x6a, 0xfa, 0x0a, 0x63, 0x85, 0x97, 0x0d, 0x63, 0x8e, 0xa7, 0x0d, 0xbb,
+  0x93, 0xf7, 0x01, 0x93, 0x07, 0x00, 0x08, 0xb7, 0x44, 0x0f, 0x00, 0x93,
+  0x05, 0xd1, 0x00, 0x13, 0x85, 0x04, 0x24, 0x1c, 0xc0, 0xfd, 0x59, 0xef,
+  0x30, 0x40, 0x58, 0xe3, 0x03, 0x35, 0xfd, 0x93, 0x05, 0xe1, 0x00, 0x13,
+  0x85, 0x04, 0x24, 0xef, 0x30, 0x40, 0x57, 0xe3, 0x0b, 0x35, 0xfb, 0x0d,
+  0x45, 0xef, 0x30, 0x60, 0x48, 0x81, 0x49, 0x13, 0x0a, 0x44, 0x00, 0x93,
+  0x84, 0x04, 0x24, 0xfd, 0x5a, 0x1c, 0x40, 0x63, 0xe3, 0xf9, 0x0a, 0xb7,
+  0x49, 0x0f, 0x00, 0x6c, 0x00, 0x13, 0x85, 0x09, 0x24, 0xef, 0x30, 0xa0,
+  0x54, 0xfd, 0x54, 0xe3, 0x05, 0x95, 0xf8, 0x93, 0x05, 0xb1, 0x00, 0x13,
+  0x85, 0x09, 0x24, 0xef, 0x30, 0x80, 0x53, 0xe3, 0x0d, 0x95, 0xf6, 0x03,
+  0x47, 0xe1, 0x00, 0x83, 0x47, 0xd1, 0x00, 0xb9, 0x8f, 0x13, 0x07, 0xf0,
+  0x0f, 0x63, 0x91, 0xe7, 0x08, 0x10, 0x40, 0xb7, 0x25, 0xa0, 0x00, 0x93,
+  0x85, 0x45, 0x5f, 0x01, 0x45, 0xc5, 0x2c, 0x03, 0x47, 0xc1, 0x00, 0x83,
+  0x47, 0xb1, 0x00, 0x9b, 0xa7, 0xe7, 0x10, 0x63, 0x96, 0xa7, 0x06, 0x83,
+  0x47, 0xd1, 0x00, 0x01, 0x45, 0x23, 0x03, 0xf9, 0x00, 0x89, 0xa0, 0x63,
+  0x86, 0x57, 0x03, 0x63, 0xe2, 0x57, 0x03, 0xe3, 0x9f, 0x77, 0xf1, 0x85,
+  0x09, 0xe3, 0x9c, 0x89, 0xf1, 0x1f, 0x05, 0xa7, 0x69, 0x5a, 0xc3, 0x25,
+  0xa0, 0x93, 0x07, 0x00, 0x40, 0x89, 0xb7, 0x9f, 0x07, 0x00, 0x08, 0x00,
+  0x00, 0x2d, 0xbf, 0x85, 0x67, 0x1d, 0xbf, 0x89, 0x67, 0x0d, 0xbf, 0xbb,
+  0x9d, 0xb4, 0x01, 0x19, 0x45, 0xef, 0x30, 0x20, 0x3e, 0x1f, 0x05, 0xaa,
+  0x69, 0x5a, 0xc3, 0xc4, 0x81, 0xb3, 0x05, 0x3a, 0x01, 0x26, 0x85, 0xef,
+  0x30, 0xc0, 0x4a, 0xe3, 0x0a, 0x55, 0xff, 0x85, 0x09, 0xa1, 0xb7, 0x1f,
+  0x05, 0xa8, 0x69, 0x5a, 0xc3, 0xdd, 0xb7, 0x1f, 0x05, 0xa9, 0x69, 0x5a,
+  0xc3, 0xf9, 0xbf, 0x88, 0x80, 0x37, 0x29, 0xa0, 0x00, 0x93, 0x07, 0x09,
+  0x5f, 0x09, 0x67, 0x23, 0xa0, 0x07, 0x00, 0x13, 0x05, 0x30, 0x04, 0xba,
+  0x97, 0x23, 0xa4, 0x07, 0x00, 0x23, 0xa6, 0x07, 0x00, 0xa3, 0x82, 0x07,
+  0x00, 0x23, 0x82, 0x07, 0x00, 0xef, 0x30, 0xe0, 0x38, 0xef, 0x30, 0xe0,
+  0x5a, 0xb7, 0x77, 0x5a, 0xc3, 0x37, 0x44, 0xa0, 0x00, 0x51, 0x4a, 0x13,
+  0x09, 0x09, 0x5f, 0x13, 0x04, 0x04, 0x5f, 0xfd, 0x5a, 0x13, 0x8b, 0x77,
+  0x9a, 0x93, 0x89, 0x67, 0x9a, 0x7d, 0x1a, 0x63, 0x15, 0x5a, 0x01, 0xfd,
+  0x54, 0x26, 0x85, 0x84, 0x80, 0x19, 0x3d, 0xaa, 0x84, 0x61, 0xed, 0x7c,
+  0x20, 0x9d, 0xef, 0x0d, 0x45, 0xef, 0x30, 0xa0, 0x34, 0xb7, 0x27, 0xa0,
+  0x00, 0x93, 0x87, 0x47, 0x5f, 0x93, 0x06, 0x59, 0x08, 0x85, 0x07, 0x03,
+  0xc7, 0xf7, 0xff, 0x19, 0xc3, 0xe3, 0x9c, 0xd7, 0xfe, 0x13, 0x06, 0x00,
+  0x08, 0x93, 0x06, 0x00, 0x02, 0x19, 0xa0, 0x85, 0x07, 0x7d, 0x16, 0x98,
+  0x23, 0x63, 0x1c, 0xd7, 0x00, 0x7d, 0xfa, 0x23, 0x24, 0x04, 0x00, 0x85,
+  0x47, 0x5c, 0xb0, 0x85, 0x47, 0x7c, 0xb0, 0x23, 0x20, 0x09, 0x00, 0x7d,
+  0xb7, 0x29, 0x48, 0x3b, 0x16, 0x07, 0x30, 0x98, 0x33, 0x13, 0x77, 0xf7,
+  0x0d, 0xbb, 0x13, 0x07, 0x58, 0xbb, 0x62, 0x06, 0x02, 0x89, 0x07, 0x79,
+  0x16, 0x41, 0x48, 0x81, 0x45, 0x25, 0x43, 0x95, 0x48, 0x01, 0xa8, 0x13,
+  0x87, 0x06, 0xfd, 0x63, 0x65, 0xe8, 0x00, 0xb3, 0x05, 0xb8, 0x02, 0xba,
+  0x95, 0x98, 0x23, 0x05, 0xe7, 0x0c, 0xc4, 0xb7, 0x07, 0x00, 0x01, 0xe3,
+  0xfc, 0xb7, 0xfa, 0x9f, 0x04, 0xac, 0x69, 0x5a, 0xc3, 0xa5, 0xb7, 0x13,
+  0x07, 0xf7, 0xfb, 0x01, 0x9f, 0x63, 0xe5, 0xe8, 0x00, 0x13, 0x87, 0x96,
+  0xfc, 0xc9, 0xbf, 0x01, 0x47, 0xc9, 0xbf, 0x69, 0xde, 0x13, 0x05, 0x07,
+  0xfd, 0x93, 0x16, 0x87, 0x01, 0x01, 0x9d, 0x85, 0x07, 0xe1, 0x86, 0xe3,
+  0x7c, 0xa3, 0xfa, 0x13, 0x75, 0xf7, 0xfd, 0x13, 0x05, 0xf5, 0xfb, 0x01,
+  0x9d, 0xe3, 0xe9, 0xa8, 0xf2, 0x13, 0x05, 0xf7, 0xf9, 0x01, 0x9d, 0xe3,
+  0xe2, 0xa8, 0xfc, 0x13, 0x87, 0x96, 0xfa, 0x71, 0xbf, 0xe3, 0x0f, 0x65,
+  0xf1, 0xe3, 0x1a, 0x35, 0xf1, 0xef, 0x30, 0xe0, 0x49, 0x51, 0x45, 0xef,
+  0x30, 0x00, 0x27, 0x13, 0x05, 0x30, 0x04, 0xef, 0x30, 0xc0, 0x26, 0xfd,
+  0xbd, 0x28, 0x80, 0x37, 0x24, 0xa0, 0x00, 0x03, 0x45, 0x44, 0x49, 0xef,
+  0x10, 0x20, 0x15, 0x01, 0xe5, 0xef, 0x30, 0x40, 0x2b, 0xcd, 0xbf, 0x24,
+  0x80, 0xd8, 0x80, 0xb7, 0x7b, 0x5a, 0xc3, 0x1f, 0x09, 0xf0, 0x25, 0xa0,
+  0x00, 0x09, 0x6b, 0x37, 0x44, 0xa0, 0x00, 0xaa, 0x8a, 0xae, 0x84, 0x01,
+  0x4a, 0x4a, 0x9b, 0x13, 0x04, 0x04, 0x5f, 0x93, 0x8c, 0x7b, 0x9a, 0x13,
+  0x8d, 0xab, 0x9a, 0x83, 0x47, 0xde, 0x09, 0x02, 0x07, 0xf8, 0x4b, 0x00,
+  0xdd, 0xeb, 0xd5, 0xc8, 0x83, 0x27, 0x09, 0x00, 0x9d, 0xef, 0x55, 0x4c,
+  0xfd, 0x59, 0x93, 0x8d, 0xbb, 0x9a, 0x85, 0xa8, 0xe1, 0x31, 0xaa, 0x89,
+  0x3d, 0xe9, 0x78, 0x20, 0x7c, 0x30, 0x63, 0x1a, 0xf7, 0x04, 0x85, 0x47,
+  0x05, 0x07, 0x5c, 0xb0, 0x78, 0xb0, 0x83, 0x27, 0x09, 0x00, 0x58, 0x44,
+  0x14, 0x44, 0x3e, 0x97, 0x58, 0xc4, 0x63, 0xf6, 0xe6, 0x00, 0xb6, 0x97,
+  0x99, 0x8f, 0x23, 0x20, 0xf9, 0x00, 0x5c, 0x20, 0xc5, 0xff, 0x83, 0x29,
+  0x09, 0x00, 0x63, 0xf3, 0x34, 0x01, 0xa6, 0x89, 0x37, 0x26, 0xa0, 0x00,
+  0xce, 0x86, 0x13, 0x06, 0x46, 0x5f, 0xa6, 0x85, 0x56, 0x85, 0xef, 0x30,
+  0x30, 0x52, 0x2d, 0xe5, 0xb3, 0x84, 0x34, 0x41, 0xce, 0x9a, 0x4e, 0x9a,
+  0x23, 0x20, 0x09, 0x00, 0x71, 0xb7, 0xfd, 0x17, 0x93, 0xf7, 0xf7, 0x0f,
+  0x63, 0x11, 0xf7, 0x04, 0x19, 0x45, 0xef, 0x30, 0x60, 0x1a, 0x7d, 0x1c,
+  0xe3, 0x18, 0x0c, 0xf8, 0xe3, 0x8d, 0x09, 0xfa, 0x2d, 0xa0, 0x63, 0x04,
+  0x95, 0x03, 0x63, 0x15, 0xa5, 0x03, 0x19, 0x45, 0xef, 0x30, 0xc0, 0x18,
+  0x13, 0x05, 0x30, 0x04, 0xef, 0x30, 0x40, 0x18, 0x25, 0x39, 0xaa, 0x89,
+  0x19, 0x45, 0xef, 0x30, 0xa0, 0x17, 0x85, 0x47, 0x5c, 0xa0, 0xe3, 0x85,
+  0x09, 0xf4, 0x52, 0x85, 0xd4, 0x80, 0xee, 0x89, 0x01, 0x31, 0x13, 0x05,
+  0x30, 0x04, 0xef, 0x30, 0x20, 0x16, 0xef, 0x30, 0x20, 0x38, 0x65, 0xbf,
+  0x7d, 0x5a, 0xe5, 0xb7, 0x09, 0x67, 0x9f, 0x07, 0xf0, 0x25, 0xa0, 0x00,
+  0xba, 0x97, 0x88, 0x47, 0x82, 0x80, 0x81, 0x47, 0x89, 0xc9, 0x01, 0xca,
+  0x2e, 0x96, 0xaa, 0x87, 0x9f, 0x06, 0x4c, 0x6a, 0xa2, 0x00, 0x63, 0x94,
+  0xc5, 0x00, 0x3e, 0x85, 0x82, 0x80, 0x85, 0x05, 0x03, 0xc7, 0xf5, 0xff,
+  0x1b, 0x37, 0xf7, 0x50, 0x1b, 0x87, 0xe6, 0x02, 0x0a, 0x23, 0x9b, 0x37,
+  0xf5, 0x10, 0xa1, 0x9f, 0xcd, 0xb7, 0x98, 0x80, 0xaa, 0x8a, 0x2e, 0x89,
+  0x32, 0x8a, 0x36, 0x84, 0xa1, 0x3b, 0x0d, 0xe9, 0xaa, 0x89, 0x4d, 0x3f,
+  0xaa, 0x84, 0x63, 0x74, 0xaa, 0x00, 0x63, 0x79, 0xa4, 0x00, 0xa6, 0x85,
+  0x1f, 0x05, 0x4c, 0x6c, 0xa2, 0x00, 0xef, 0x30, 0x20, 0x23, 0x19, 0xa8,
+  0x2a, 0x84, 0x63, 0x0d, 0x09, 0x06, 0x63, 0x7b, 0xa9, 0x06, 0x1f, 0x05,
+  0x60, 0x6c, 0xa2, 0x00, 0xef, 0x30, 0xa0, 0x20, 0x8d, 0x3d, 0x7d, 0x54,
+  0x85, 0xa0, 0xa2, 0x85, 0x63, 0x73, 0x8b, 0x00, 0x89, 0x65, 0x13, 0x05,
+  0x0a, 0x60, 0xa5, 0x3d, 0x2a, 0x89, 0x6d, 0xd5, 0xe3, 0x64, 0xa4, 0xfe,
+  0xef, 0xf0, 0x2f, 0xc9, 0x1c, 0x45, 0xca, 0x85, 0x81, 0x46, 0x13, 0x06,
+  0x0a, 0x60, 0x33, 0x85, 0x7a, 0x01, 0x82, 0x97, 0xaa, 0x85, 0x09, 0xc5,
+  0x1f, 0x05, 0x78, 0x6c, 0xa2, 0x00, 0x75, 0xb7, 0x33, 0x04, 0x24, 0x41,
+  0xca, 0x99, 0xca, 0x9a, 0xef, 0x30, 0x80, 0x2b, 0x5d, 0xfc, 0x89, 0x65,
+  0x13, 0x05, 0x0a, 0x60, 0x2d, 0x3d, 0xe3, 0x97, 0x34, 0xfb, 0xa6, 0x85,
+  0x1f, 0x05, 0x8c, 0x6c, 0xa2, 0x00, 0xef, 0x30, 0xa0, 0x1b, 0x01, 0x3d,
+  0x22, 0x85, 0x94, 0x80, 0x37, 0x4a, 0xa0, 0x00, 0x09, 0x6b, 0xb7, 0x0b,
+  0xe0, 0xff, 0xd9, 0xbf, 0xd8, 0x83, 0x40, 0x45, 0x93, 0x07, 0x70, 0x4f,
+  0x13, 0x07, 0xf4, 0xfc, 0x63, 0xfa, 0xe7, 0x00, 0xa2, 0x85, 0x1f, 0x05,
+  0x98, 0x6c, 0xa2, 0x00, 0xef, 0x30, 0xc0, 0x18, 0xfd, 0x5b, 0x2d, 0xa0,
+  0x13, 0x05, 0xa0, 0x05, 0xef, 0xf0, 0xff, 0x8d, 0x93, 0x06, 0x80, 0x52,
+  0x13, 0x06, 0x00, 0x03, 0x81, 0x45, 0x37, 0x05, 0xa3, 0x00, 0x21, 0x3f,
+  0xaa, 0x8b, 0x09, 0xc9, 0xaa, 0x85, 0x1f, 0x05, 0xb0, 0x6c, 0xa2, 0x00,
+  0xef, 0x30, 0x00, 0x16, 0x5e, 0x85, 0xd4, 0x83, 0x81, 0x45, 0x13, 0x06,
+  0x00, 0x02, 0x08, 0x08, 0xef, 0xf0, 0xef, 0x82, 0xef, 0x00, 0xf0, 0x09,
+  0xaa, 0x85, 0x01, 0xcd, 0x1f, 0x05, 0xcc, 0x6c, 0xa2, 0x00, 0xef, 0x30,
+  0xe0, 0x13, 0x1f, 0x05, 0x64, 0x6d, 0xa2, 0x00, 0xef, 0x30, 0x20, 0x12,
+  0x65, 0xb7, 0x93, 0x05, 0x04, 0xfe, 0x37, 0x04, 0xa3, 0x00, 0x93, 0x06,
+  0x00, 0x02, 0x10, 0x08, 0x13, 0x05, 0x04, 0x02, 0xef, 0x00, 0xd0, 0x03,
+  0xaa, 0x85, 0x09, 0xc5, 0x1f, 0x05, 0xec, 0x6c, 0xa2, 0x00, 0xc1, 0xbf,
+  0xef, 0x00, 0x90, 0x08, 0xaa, 0x8b, 0x11, 0xc5, 0xaa, 0x85, 0x1f, 0x05,
+  0x10, 0x6d, 0xa2, 0x00, 0x7d, 0xbf, 0x13, 0x06, 0x00, 0x02, 0x0c, 0x08,
+  0x37, 0x05, 0xa3, 0x00, 0xef, 0xf0, 0x8f, 0xb1, 0x19, 0xc5, 0x1f, 0x05,
+  0x34, 0x6d, 0xa2, 0x00, 0xef, 0x30, 0x20, 0x0d, 0x5d, 0xb7, 0x3e, 0x30,
+  0x3b, 0xe3, 0x07, 0x14, 0x1f, 0x05, 0x4c, 0x6d, 0xa2, 0x00, 0xfd, 0xb7,
+  0x83, 0x47, 0x14, 0x02, 0x81, 0x4c, 0xb7, 0x0a, 0xa3, 0x00, 0x3e, 0x94,
+  0x05, 0x4b, 0x37, 0x7a, 0xa2, 0x00, 0xb7, 0x79, 0xa2, 0x00, 0x37, 0x79,
+  0xa2, 0x00, 0xb7, 0x74, 0xa2, 0x00, 0x83, 0xd7, 0x2a, 0x02, 0xe3, 0xf9,
+  0xfc, 0xf4, 0xe3, 0x01, 0x04, 0xf2, 0x83, 0x5d, 0x24, 0x00, 0x03, 0x5d,
+  0x44, 0x00, 0x13, 0x07, 0x84, 0x00, 0x6e, 0x8c, 0x6e, 0x9d, 0xb3, 0x07,
+  0xbc, 0x41, 0xa1, 0x9f, 0x63, 0x4a, 0xac, 0x01, 0x1c, 0x30, 0x7a, 0x20,
+  0x85, 0x0c, 0x93, 0xfc, 0xfc, 0x0f, 0xba, 0x97, 0x3e, 0x94, 0xf1, 0xb7,
+  0x9b, 0x06, 0xf7, 0x46, 0x94, 0x22, 0x9d, 0x8b, 0xb3, 0x17, 0xfb, 0x00,
+  0xf5, 0x8f, 0x91, 0xe7, 0x05, 0x0c, 0x42, 0x0c, 0x13, 0x5c, 0x0c, 0x01,
+  0xf9, 0xb7, 0x93, 0x75, 0x7c, 0x00, 0x13, 0x55, 0x3c, 0x00, 0x3a, 0xc6,
+  0xef, 0x10, 0xe0, 0x02, 0x32, 0x47, 0x7d, 0xd1, 0xe6, 0x85, 0x13, 0x05,
+  0x0a, 0xd8, 0xef, 0x30, 0xa0, 0x04, 0x13, 0x85, 0xc9, 0xd9, 0xef, 0x20,
+  0x30, 0x72, 0x2a, 0x20, 0x85, 0x45, 0xef, 0x20, 0x30, 0x77, 0x13, 0x05,
+  0x89, 0xda, 0xef, 0x20, 0x30, 0x71, 0x4a, 0x20, 0x85, 0x45, 0xef, 0x20,
+  0x30, 0x76, 0x13, 0x85, 0x84, 0xe6, 0xef, 0x20, 0x30, 0x70, 0x49, 0xbf,
+  0x58, 0x82, 0x42, 0x25, 0x13, 0x06, 0x00, 0x02, 0x81, 0x45, 0x0a, 0x85,
+  0xef, 0xe0, 0xff, 0xee, 0x1f, 0x05, 0xb4, 0x6d, 0xa2, 0x00, 0xef, 0x20,
+  0x50, 0x7f, 0x1f, 0x05, 0x9c, 0x6d, 0xa2, 0x00, 0xef, 0x20, 0xd0, 0x6d,
+  0x22, 0x85, 0x85, 0x45, 0xef, 0x20, 0xd0, 0x72, 0x1f, 0x05, 0x48, 0x74,
+  0xa2, 0x00, 0xef, 0x20, 0xb0, 0x6c, 0xbb, 0x64, 0x04, 0x13, 0x1f, 0x05,
+  0xc0, 0x6d, 0xa2, 0x00, 0xef, 0x20, 0xb0, 0x7c, 0x7d, 0x54, 0x25, 0xa8,
+  0x13, 0x75, 0xf4, 0x0f, 0x13, 0x06, 0x00, 0x02, 0x8a, 0x85, 0xef, 0x20,
+  0xf0, 0x51, 0x2a, 0x84, 0x75, 0xf5, 0x81, 0x44, 0xb7, 0x79, 0xa2, 0x00,
+  0x13, 0x09, 0x00, 0x02, 0xb3, 0x07, 0x91, 0x00, 0x88, 0x23, 0x85, 0x45,
+  0x85, 0x04, 0xef, 0x20, 0x70, 0x6e, 0x13, 0x85, 0xc9, 0xdc, 0xef, 0x20,
+  0x70, 0x68, 0xe3, 0x95, 0x24, 0xff, 0x22, 0x85, 0x54, 0x82, 0xb2, 0x87,
+  0x2e, 0x86, 0xbe, 0x85, 0x6f, 0x20, 0xd0, 0x16, 0x1f, 0x05, 0xd0, 0x6d,
+  0xa2, 0x00, 0x6f, 0x20, 0x90, 0x0b, 0x3b, 0x92, 0x05, 0xff, 0x6f, 0x20,
+  0xb0, 0x3e, 0xb7, 0x07, 0xe0, 0xff, 0x3e, 0x95, 0x6f, 0x20, 0x30, 0x32,
+  0xb3, 0x08, 0xb5, 0x00, 0x37, 0x08, 0x80, 0x00, 0xae, 0x86, 0x63, 0xf7,
+  0x08, 0x01, 0x41, 0x68, 0x02, 0x08, 0xf7, 0x32, 0x87, 0x2e, 0x86, 0xba,
+  0x85, 0x6f, 0x20, 0xd0, 0x20, 0x18, 0x80, 0xaa, 0x87, 0x37, 0x05, 0x20,
+  0x00, 0x3e, 0x95, 0xef, 0x30, 0xf0, 0x16, 0x33, 0x35, 0xa0, 0x00, 0x33,
+  0x05, 0xa0, 0x40, 0x14, 0x80, 0x18, 0x9f, 0x13, 0x01, 0x01, 0xdb, 0x13,
+  0x06, 0x00, 0x41, 0x81, 0x45, 0x08, 0x18, 0xef, 0xe0, 0x5f, 0xe1, 0xef,
+  0x20, 0x50, 0x51, 0x1d, 0x45, 0xef, 0x00, 0x10, 0x51, 0x01, 0x45, 0xef,
+  0x00, 0xd0, 0x55, 0xef, 0x00, 0x40, 0x70, 0x31, 0x46, 0x9f, 0x05, 0x94,
+  0x6a, 0xa0, 0x00, 0x0a, 0x85, 0xef, 0xe0, 0x1f, 0xea, 0x81, 0x45, 0x0a,
+  0x85, 0xef, 0x20, 0xb0, 0x75, 0x1f, 0x05, 0xdc, 0x6d, 0xa2, 0x00, 0xef,
+  0x20, 0x10, 0x6f, 0x9f, 0x07, 0xd6, 0x1b, 0xa2, 0x00, 0x3e, 0xce, 0x9f,
+  0x07, 0xcc, 0x1b, 0xa2, 0x00, 0x3e, 0xd0, 0x9f, 0x07, 0xf2, 0x1b, 0xa2,
+  0x00, 0x3e, 0xd2, 0x68, 0x08, 0x9f, 0x07, 0xe0, 0x1b, 0xa2, 0x00, 0x3e,
+  0xd4, 0x02, 0xd6, 0xef, 0xf0, 0x8f, 0x97, 0x37, 0x37, 0x00, 0x40, 0x83,
+  0x27, 0x47, 0x15, 0xb7, 0x06, 0x00, 0x01, 0x15, 0x45, 0xd5, 0x8f, 0x23,
+  0x2a, 0xf7, 0x14, 0xef, 0x20, 0xf0, 0x57, 0x3d, 0x37, 0x31, 0xc9, 0xaa,
+  0x85, 0x1f, 0x05, 0xf8, 0x6d, 0xa2, 0x00, 0xef, 0x20, 0x30, 0x6b, 0xef,
+  0x20, 0x50, 0x4d, 0xef, 0x20, 0xd0, 0x4f, 0xef, 0x20, 0x20, 0x5e, 0xaa,
+  0x85, 0x11, 0xc5, 0x1f, 0x05, 0x24, 0x6e, 0xa2, 0x00, 0xef, 0x20, 0x90,
+  0x69, 0xef, 0x20, 0x70, 0x3f, 0xef, 0x00, 0x70, 0x5a, 0xef, 0x30, 0x80,
+  0x07, 0xef, 0x30, 0xc0, 0x03, 0x05, 0xe5, 0x13, 0x05, 0xa0, 0x05, 0xef,
+  0xf0, 0xcf, 0xdd, 0x1f, 0x05, 0x38, 0x6e, 0xa2, 0x00, 0xef, 0x20, 0x30,
+  0x66, 0x08, 0x18, 0xef, 0xf0, 0x2f, 0xe4, 0x01, 0xa0, 0x1f, 0x05, 0x10,
+  0x6e, 0xa2, 0x00, 0xef, 0x20, 0x10, 0x65, 0x45, 0xbf, 0x13, 0x01, 0x01,
+  0x44, 0x14, 0x80, 0x28, 0x81, 0x2a, 0x84, 0xef, 0x20, 0xd0, 0x71, 0xb7,
+  0x17, 0x00, 0x44, 0x03, 0xa7, 0x47, 0x10, 0x9f, 0x06, 0xff, 0xff, 0xfb,
+  0xff, 0x9f, 0x05, 0x00, 0x68, 0x89, 0x09, 0x75, 0x8f, 0x23, 0xa2, 0xe7,
+  0x10, 0x03, 0xa7, 0x47, 0x13, 0xb7, 0x06, 0x04, 0x00, 0x01, 0x45, 0x13,
+  0x67, 0x27, 0x00, 0x23, 0xaa, 0xe7, 0x12, 0x03, 0xa7, 0x47, 0x10, 0x55,
+  0x8f, 0x23, 0xa2, 0xe7, 0x10, 0xef, 0x20, 0xe0, 0x2a, 0x31, 0x46, 0xa2,
+  0x85, 0x0a, 0x85, 0xef, 0xe0, 0xbf, 0xd9, 0x0a, 0x85, 0x81, 0x45, 0xef,
+  0x20, 0x50, 0x65, 0x01, 0x45, 0x24, 0x81, 0x38, 0x80, 0x9f, 0x07, 0xef,
+  0xbe, 0xad, 0xde, 0x5c, 0xc1, 0x9f, 0x07, 0x0c, 0x00, 0xe1, 0x1e, 0x93,
+  0x04, 0x45, 0x00, 0x1c, 0xc5, 0x93, 0x07, 0xa0, 0x05, 0x2a, 0x84, 0x5e,
+  0xa5, 0x29, 0x46, 0xa6, 0x85, 0x01, 0x45, 0x91, 0x3e, 0x0e, 0x24, 0x23,
+  0x16, 0xa4, 0x40, 0x26, 0x85, 0xf9, 0x15, 0xef, 0x20, 0x30, 0x4d, 0x89,
+  0x45, 0x13, 0x05, 0xc4, 0x40, 0x30, 0x80, 0x6f, 0x20, 0x70, 0x4c, 0x38,
+  0x9f, 0x13, 0x01, 0x01, 0xde, 0xaa, 0x84, 0x13, 0x06, 0x00, 0x41, 0x81,
+  0x45, 0x0a, 0x85, 0xef, 0xe0, 0xdf, 0xc8, 0x9c, 0x44, 0x1f, 0x07, 0xff,
+  0xff, 0xff, 0x00, 0x01, 0x45, 0xf9, 0x8f, 0x1f, 0x07, 0x12, 0x00, 0x5a,
+  0x00, 0x63, 0x93, 0xe7, 0x02, 0x37, 0x64, 0xa0, 0x00, 0xa1, 0x46, 0x13,
+  0x86, 0xc4, 0x00, 0xb1, 0x45, 0x13, 0x05, 0x04, 0x60, 0xef, 0x30, 0x00,
+  0x7a, 0x0a, 0x85, 0x41, 0x37, 0x15, 0x45, 0xef, 0x20, 0x70, 0x43, 0x13,
+  0x05, 0x04, 0x60, 0x13, 0x01, 0x01, 0x41, 0x34, 0x80, 0x9f, 0x07, 0x0c,
+  0x66, 0xa0, 0x00, 0x88, 0x23, 0x82, 0x80, 0x38, 0x25, 0x93, 0x07, 0x20,
+  0x0d, 0x63, 0x06, 0xf7, 0x00, 0x7d, 0x55, 0x82, 0x80, 0x7d, 0x55, 0x34,
+  0x81, 0x38, 0x81, 0x04, 0x49, 0x5c, 0x49, 0x2e, 0x84, 0xb3, 0x34, 0x90,
+  0x00, 0xbb, 0x99, 0x07, 0xff, 0xef, 0xe0, 0x7f, 0xfd, 0x2a, 0xc6, 0x7d,
+  0xd1, 0xef, 0x20, 0xd0, 0x61, 0x32, 0x45, 0xfd, 0x55, 0x5c, 0x45, 0x01,
+  0x45, 0x82, 0x97, 0x61, 0xfd, 0x9f, 0x07, 0x0c, 0x66, 0xa0, 0x00, 0x05,
+  0x47, 0x98, 0xa3, 0x04, 0xa0, 0x01, 0x45, 0xe1, 0xb7, 0x38, 0x80, 0xf3,
+  0x24, 0x00, 0x30, 0xf3, 0x77, 0x04, 0x30, 0x37, 0x64, 0xa0, 0x00, 0x93,
+  0x07, 0xc4, 0x61, 0x9e, 0x23, 0x13, 0x04, 0xc4, 0x61, 0xa1, 0x9f, 0x89,
+  0xeb, 0x9f, 0x07, 0x14, 0x66, 0xa0, 0x00, 0x9c, 0x43, 0x81, 0xc7, 0x86,
+  0x85, 0x01, 0x45, 0x82, 0x97, 0x9f, 0x07, 0x10, 0x66, 0xa0, 0x00, 0x9c,
+  0x43, 0x89, 0xc7, 0x86, 0x85, 0x12, 0x20, 0x01, 0x45, 0x82, 0x97, 0x1e,
+  0x20, 0xa1, 0x9f, 0x89, 0xeb, 0x8d, 0x80, 0x93, 0xc4, 0x14, 0x00, 0x85,
+  0x88, 0x9f, 0x07, 0x18, 0x66, 0xa0, 0x00, 0x84, 0xc3, 0x1e, 0x20, 0x85,
+  0x07, 0xa1, 0x9f, 0x1e, 0xa0, 0x1e, 0x20, 0xa1, 0x9f, 0x81, 0xeb, 0x93,
+  0x05, 0x30, 0x06, 0x13, 0x05, 0x10, 0x03, 0x30, 0x80, 0x6f, 0x30, 0xa0,
+  0x55, 0x0f, 0x00, 0xf0, 0x0f, 0x0f, 0x00, 0xf0, 0x0f, 0x34, 0x80, 0x38,
+  0x80, 0x37, 0x64, 0xa0, 0x00, 0x93, 0x07, 0xc4, 0x61, 0x9e, 0x23, 0xa1,
+  0x9f, 0x81, 0xeb, 0x93, 0x05, 0xf0, 0x06, 0x13, 0x05, 0x10, 0x03, 0x30,
+  0x80, 0x6f, 0x30, 0x20, 0x53, 0x13, 0x04, 0xc4, 0x61, 0x1e, 0x20, 0x86,
+  0x84, 0xfd, 0x17, 0xa1, 0x9f, 0x1e, 0xa0, 0x9f, 0x07, 0x10, 0x66, 0xa0,
+  0x00, 0x9c, 0x43, 0x89, 0xc7, 0x86, 0x85, 0x12, 0x20, 0x05, 0x45, 0x82,
+  0x97, 0x1e, 0x20, 0xa1, 0x9f, 0x85, 0xe7, 0x9f, 0x07, 0x14, 0x66, 0xa0,
+  0x00, 0x9c, 0x43, 0x81, 0xc7, 0xa6, 0x85, 0x05, 0x45, 0x82, 0x97, 0x9f,
+  0x07, 0x18, 0x66, 0xa0, 0x00, 0x9c, 0x43, 0x99, 0xe3, 0xf3, 0x67, 0x04,
+  0x30, 0x0f, 0x00, 0xf0, 0x0f, 0x0f, 0x00, 0xf0, 0x0f, 0x34, 0x80, 0x18,
+  0x80, 0x2a, 0x86, 0xb1, 0x46, 0xb1, 0x45, 0x1f, 0x05, 0x20, 0x66, 0xa0,
+  0x00, 0xef, 0x30, 0x00, 0x64, 0x01, 0x45, 0x14, 0x80, 0x38, 0x80, 0x2e,
+  0x84, 0xe1, 0x46, 0x01, 0x46, 0xe1, 0x45, 0xaa, 0x84, 0xef, 0x30, 0x40,
+  0x66, 0x93, 0x07, 0x84, 0xff, 0x1f, 0x07, 0x2c, 0x66, 0xa0, 0x00, 0x13,
+  0x85, 0xb4, 0x01, 0xf1, 0x9b, 0x71, 0x99, 0x1c, 0xcb, 0xe1, 0x17, 0x89,
+  0x8f, 0x48, 0xc7, 0xa1, 0x9f, 0x5e, 0xa1, 0x1c, 0xc7, 0x9d, 0x67, 0x93,
+  0x87, 0x47, 0x07, 0x7e, 0xa1, 0x23, 0x20, 0x05, 0x00, 0x34, 0x80, 0xc9,
+  0xb7, 0xb7, 0x66, 0xa0, 0x00, 0x93, 0x87, 0xc6, 0x62, 0xdc, 0x47, 0x93,
+  0x86, 0xc6, 0x62, 0x99, 0xe3, 0x01, 0x45, 0x82, 0x80, 0x75, 0xdd, 0xf2,
+  0x23, 0x1d, 0x67, 0x13, 0x08, 0x47, 0x07, 0x63, 0x06, 0x06, 0x01, 0x13,
+  0x07, 0xc7, 0xc6, 0xe3, 0x15, 0xe6, 0xfe, 0x0d, 0x05, 0x71, 0x99, 0x1d,
+  0x67, 0x21, 0x9d, 0x81, 0x48, 0x13, 0x06, 0x47, 0x07, 0x13, 0x08, 0x85,
+  0x00, 0x13, 0x03, 0xc7, 0xc6, 0x03, 0xde, 0x67, 0x00, 0xda, 0x23, 0x63,
+  0x12, 0xce, 0x04, 0x63, 0x75, 0xe8, 0x02, 0x09, 0x8f, 0x3e, 0x98, 0x61,
+  0x17, 0x23, 0x12, 0xe8, 0x00, 0x23, 0x13, 0xc8, 0x00, 0x1d, 0x67, 0x13,
+  0x07, 0xc7, 0xc6, 0x8c, 0xc3, 0xfa, 0xa3, 0x98, 0x42, 0xca, 0xa3, 0x3a,
+  0x95, 0x88, 0xc2, 0x13, 0x85, 0x87, 0x00, 0x82, 0x80, 0x63, 0x6b, 0x6e,
+  0x6e, 0x02, 0x09, 0xf6, 0xa7, 0x00, 0x1d, 0x66, 0x13, 0x06, 0xc6, 0xc6,
+  0x8c, 0xc3, 0xf2, 0xa3, 0x90, 0x42, 0x32, 0x97, 0x98, 0xc2, 0xdd, 0xb7,
+  0x21, 0x07, 0xba, 0x97, 0x98, 0x4a, 0x63, 0xef, 0xe7, 0x00, 0xe3, 0x9e,
+  0x08, 0xf6, 0xd8, 0x46, 0x5e, 0x23, 0x03, 0xae, 0x06, 0x01, 0xa1, 0x07,
+  0xb3, 0x08, 0xf7, 0x00, 0x63, 0xea, 0xc8, 0x01, 0xdc, 0x46, 0x85, 0x48,
+  0xfa, 0x23, 0xe3, 0x08, 0x67, 0xf8, 0xe3, 0x06, 0xc7, 0xf8, 0xa1, 0xbf,
+  0x03, 0x5e, 0x67, 0x00, 0x63, 0x1b, 0xce, 0x00, 0x03, 0xde, 0x68, 0x00,
+  0x63, 0x17, 0xce, 0x00, 0x83, 0xd8, 0x48, 0x00, 0xc6, 0x97, 0x5e, 0xa3,
+  0xba, 0x88, 0x46, 0x87, 0xd1, 0xb7, 0x18, 0x80, 0x86, 0x85, 0x10, 0x80,
+  0x0d, 0xb7, 0x0d, 0xc5, 0x03, 0x57, 0xe5, 0xff, 0x9f, 0x07, 0x6c, 0x6c,
+  0x00, 0x00, 0x63, 0x1f, 0xf7, 0x00, 0x9d, 0x67, 0x93, 0x87, 0x47, 0x07,
+  0x23, 0x1f, 0xf5, 0xfe, 0x1f, 0x07, 0x2c, 0x66, 0xa0, 0x00, 0x83, 0x56,
+  0xc5, 0xff, 0x5c, 0x43, 0xb6, 0x97, 0x5c, 0xc3, 0x01, 0x45, 0x82, 0x80,
+  0xc9, 0xbf, 0x18, 0x80, 0x4d, 0x3b, 0x01, 0x45, 0x14, 0x80, 0x1d, 0xb5,
+  0x78, 0x8e, 0x2a, 0x89, 0xae, 0x8a, 0xb2, 0x84, 0x81, 0x45, 0x13, 0x06,
+  0x00, 0x04, 0x08, 0x10, 0x3a, 0xc6, 0x36, 0x8a, 0x3e, 0x84, 0xef, 0xe0,
+  0xbf, 0x98, 0x13, 0x06, 0x00, 0x08, 0x81, 0x45, 0x88, 0x10, 0xef, 0xe0,
+  0xff, 0x97, 0x02, 0xce, 0x32, 0x47, 0x63, 0x94, 0x0a, 0x00, 0x7d, 0x55,
+  0x74, 0x8e, 0xe3, 0x0e, 0x0a, 0xfe, 0xb7, 0x07, 0x00, 0x01, 0xe3, 0xfa,
+  0xf4, 0xfe, 0x3b, 0x1c, 0xf7, 0x20, 0x9f, 0x07, 0x00, 0x91, 0x16, 0x02,
+  0x63, 0x09, 0xf9, 0x0c, 0x1f, 0x06, 0x6c, 0x6e, 0xa2, 0x00, 0xca, 0x85,
+  0x22, 0x85, 0xef, 0x00, 0x50, 0x61, 0x79, 0xf9, 0x13, 0xf9, 0xf4, 0x03,
+  0xb3, 0x89, 0x24, 0x41, 0x63, 0x9f, 0x09, 0x0a, 0x93, 0x06, 0x00, 0x08,
+  0x01, 0x46, 0x93, 0x05, 0x00, 0x08, 0x88, 0x10, 0xef, 0x30, 0x20, 0x4a,
+  0xca, 0x86, 0x33, 0x86, 0x3a, 0x01, 0x93, 0x05, 0x00, 0x08, 0x88, 0x10,
+  0xef, 0x30, 0xa0, 0x45, 0x5d, 0xf1, 0x9c, 0x11, 0xca, 0x97, 0x13, 0x07,
+  0x00, 0xf8, 0x23, 0x80, 0xe7, 0xf8, 0x93, 0x09, 0x00, 0x04, 0x3b, 0x62,
+  0x09, 0x38, 0x93, 0x09, 0x00, 0x08, 0x13, 0x97, 0x34, 0x00, 0x13, 0x96,
+  0xb4, 0x01, 0x9f, 0x07, 0x00, 0xff, 0x00, 0x00, 0x9b, 0xc7, 0xe7, 0x50,
+  0x1b, 0x26, 0xe6, 0x70, 0x5d, 0x8e, 0xb7, 0x07, 0xff, 0x00, 0x9b, 0xc4,
+  0x97, 0x16, 0x45, 0x8e, 0x13, 0x85, 0xc9, 0xff, 0x9c, 0x10, 0x32, 0xce,
+  0x91, 0x46, 0x70, 0x08, 0x91, 0x45, 0x3e, 0x95, 0xef, 0x30, 0xa0, 0x40,
+  0x39, 0xf9, 0x95, 0x46, 0x4e, 0x86, 0x8c, 0x10, 0x22, 0x85, 0xef, 0x00,
+  0xb0, 0x66, 0x29, 0xf5, 0x81, 0x45, 0x22, 0x85, 0xef, 0x00, 0x50, 0x6d,
+  0x21, 0xf1, 0x13, 0x06, 0x00, 0x04, 0x0c, 0x10, 0x22, 0x85, 0xef, 0x10,
+  0x00, 0x0b, 0x0d, 0xf9, 0x93, 0x06, 0x00, 0x02, 0x10, 0x10, 0x93, 0x05,
+  0x00, 0x02, 0x52, 0x85, 0xef, 0x30, 0x20, 0x3d, 0x33, 0x35, 0xa0, 0x00,
+  0x33, 0x05, 0xa0, 0x40, 0x21, 0xbf, 0x1f, 0x06, 0x8c, 0x6e, 0xa2, 0x00,
+  0x0d, 0xbf, 0x95, 0x46, 0x4e, 0x86, 0xd6, 0x85, 0x22, 0x85, 0xef, 0x00,
+  0x30, 0x62, 0xe3, 0x11, 0x05, 0xf0, 0x81, 0x45, 0x22, 0x85, 0xef, 0x00,
+  0xb0, 0x68, 0xe3, 0x1b, 0x05, 0xee, 0x01, 0x46, 0x81, 0x45, 0x22, 0x85,
+  0xef, 0x10, 0x60, 0x06, 0xe3, 0x00, 0x05, 0xf2, 0xd5, 0xb5, 0x9f, 0x07,
+  0x44, 0x66, 0xa0, 0x00, 0x03, 0xa3, 0x87, 0x00, 0x63, 0x03, 0x03, 0x00,
+  0x02, 0x83, 0x82, 0x80, 0x15, 0xc1, 0x18, 0x41, 0x9f, 0x07, 0x44, 0x66,
+  0xa0, 0x00, 0x98, 0xc3, 0x58, 0x41, 0xd8, 0xc3, 0x18, 0x45, 0x98, 0xc7,
+  0x18, 0x49, 0x98, 0xcb, 0x58, 0x4d, 0xd8, 0xcf, 0x18, 0x51, 0x01, 0x45,
+  0x98, 0xd3, 0x82, 0x80, 0x7d, 0x55, 0x82, 0x80, 0x9f, 0x07, 0x44, 0x66,
+  0xa0, 0x00, 0x03, 0xa3, 0xc7, 0x01, 0x63, 0x03, 0x03, 0x00, 0x02, 0x83,
+  0x05, 0x45, 0x82, 0x80, 0x9f, 0x05, 0xac, 0x6e, 0xa2, 0x00, 0x1f, 0x05,
+  0xb0, 0x6e, 0xa2, 0x00, 0x09, 0xa0, 0xb7, 0x67, 0xa0, 0x00, 0x23, 0xac,
+  0xa7, 0x7a, 0xb7, 0x67, 0xa0, 0x00, 0x23, 0xaa, 0xb7, 0x7a, 0x82, 0x80,
+  0x28, 0x80, 0xef, 0x00, 0x70, 0x39, 0x2a, 0x84, 0x19, 0xc1, 0xef, 0x00,
+  0x30, 0x3a, 0x22, 0x85, 0x24, 0x80, 0x18, 0x81, 0xef, 0x00, 0x90, 0x39,
+  0x09, 0xe5, 0x2a, 0xc6, 0xef, 0x00, 0xd0, 0x3a, 0x32, 0x45, 0x14, 0x81,
+  0x82, 0x80, 0x28, 0x81, 0x2a, 0x84, 0x05, 0x45, 0x2e, 0xc6, 0x32, 0xc4,
+  0x36, 0xc2, 0xef, 0x00, 0x50, 0x69, 0x22, 0x46, 0xb2, 0x45, 0x12, 0x47,
+  0xb2, 0x86, 0x85, 0x47, 0x2e, 0x86, 0x1f, 0x05, 0x00, 0x91, 0x16, 0x01,
+  0xa2, 0x85, 0xed, 0x3b, 0x2a, 0x84, 0x05, 0x45, 0xef, 0x00, 0x70, 0x40,
+  0x22, 0x85, 0x24, 0x81, 0x18, 0x83, 0x13, 0x06, 0x40, 0x02, 0x81, 0x45,
+  0x68, 0x00, 0xef, 0xe0, 0x2f, 0xf8, 0xef, 0x10, 0xa0, 0x0d, 0x59, 0x3f,
+  0xef, 0x00, 0x10, 0x39, 0x9f, 0x07, 0x84, 0x22, 0xa2, 0x00, 0x68, 0x00,
+  0x3e, 0xca, 0x2d, 0x37, 0x95, 0x37, 0x01, 0x45, 0x14, 0x83, 0x18, 0x80,
+  0x79, 0x37, 0xef, 0x10, 0x80, 0x0c, 0xef, 0x00, 0xd0, 0x3e, 0x01, 0x45,
+  0x14, 0x80, 0x48, 0x80, 0x5d, 0x33, 0x9f, 0x07, 0x68, 0x66, 0xa0, 0x00,
+  0x9c, 0x23, 0x99, 0xe7, 0x4d, 0x33, 0x01, 0x44, 0x81, 0x44, 0x22, 0x85,
+  0xa6, 0x85, 0x44, 0x80, 0x2a, 0x89, 0xef, 0x10, 0x10, 0x55, 0x2a, 0x84,
+  0x4a, 0x85, 0xae, 0x84, 0x69, 0x33, 0xf5, 0xb7, 0x28, 0x81, 0xd1, 0x3f,
+  0x2a, 0x84, 0x2e, 0xc6, 0xef, 0x10, 0xb0, 0x54, 0xb2, 0x45, 0x9f, 0x07,
+  0x40, 0x42, 0x0f, 0x00, 0x33, 0x37, 0xf4, 0x02, 0x2a, 0x86, 0x81, 0x46,
+  0xb3, 0x85, 0xf5, 0x02, 0x33, 0x05, 0xf4, 0x02, 0xba, 0x95, 0xef, 0xe0,
+  0xaf, 0xaf, 0x24, 0x81, 0x48, 0x80, 0x81, 0x3b, 0x1f, 0x09, 0x69, 0x66,
+  0xa0, 0x00, 0x83, 0x47, 0x09, 0x00, 0x89, 0xc7, 0xa9, 0x33, 0x01, 0x44,
+  0x22, 0x85, 0x44, 0x80, 0xaa, 0x84, 0xef, 0x10, 0xa0, 0x05, 0x2a, 0x84,
+  0x01, 0xc5, 0x26, 0x85, 0x1d, 0x3b, 0xfd, 0xb7, 0x85, 0x47, 0x23, 0x00,
+  0xf9, 0x00, 0xd5, 0xbf, 0x48, 0x80, 0x05, 0x33, 0x9f, 0x07, 0x69, 0x66,
+  0xa0, 0x00, 0x9c, 0x23, 0x99, 0xe7, 0x31, 0x3b, 0x01, 0x44, 0x81, 0x44,
+  0x22, 0x85, 0xa6, 0x85, 0x44, 0x80, 0x2a, 0x89, 0xef, 0x10, 0x40, 0x05,
+  0x2a, 0x84, 0x4a, 0x85, 0xae, 0x84, 0x11, 0x33, 0xf5, 0xb7, 0x9f, 0x07,
+  0x69, 0x66, 0xa0, 0x00, 0x9c, 0x23, 0xb1, 0xc3, 0x48, 0x80, 0x2a, 0x84,
+  0xef, 0x10, 0x10, 0x4d, 0x93, 0x07, 0x80, 0x3e, 0xb3, 0x05, 0xf4, 0x02,
+  0x33, 0x34, 0xf4, 0x02, 0xb3, 0x84, 0xa5, 0x02, 0x33, 0x04, 0xa4, 0x02,
+  0xb3, 0xb5, 0xa5, 0x02, 0x2e, 0x94, 0x6d, 0x37, 0x33, 0x89, 0xa4, 0x00,
+  0xb3, 0x34, 0x99, 0x00, 0xa2, 0x95, 0xae, 0x94, 0x71, 0x3f, 0xe3, 0xef,
+  0x95, 0xfe, 0x63, 0x94, 0xb4, 0x00, 0xe3, 0x6b, 0x25, 0xff, 0x01, 0x45,
+  0x44, 0x80, 0x7d, 0x55, 0x82, 0x80, 0x9f, 0x07, 0x69, 0x66, 0xa0, 0x00,
+  0x9c, 0x23, 0x8d, 0xcb, 0x48, 0x80, 0x2a, 0x84, 0x8c, 0xa3, 0x02, 0x0a,
+  0xf5, 0xef, 0x10, 0x10, 0x48, 0xb3, 0x04, 0xa4, 0x02, 0x33, 0x34, 0xa4,
+  0x02, 0xb5, 0x37, 0x33, 0x89, 0xa4, 0x00, 0xb3, 0x34, 0x99, 0x00, 0x2e,
+  0x94, 0x26, 0x94, 0xb9, 0x3f, 0xe3, 0xef, 0x85, 0xfe, 0x63, 0x14, 0xb4,
+  0x00, 0xe3, 0x6b, 0x25, 0xff, 0x01, 0x45, 0x44, 0x80, 0x7d, 0x55, 0x82,
+  0x80, 0x38, 0x80, 0x37, 0x67, 0xa0, 0x00, 0x93, 0x07, 0x07, 0x67, 0xdb,
+  0x97, 0xa7, 0x18, 0x94, 0x43, 0x2e, 0x86, 0x2a, 0x84, 0xce, 0x2b, 0x93,
+  0x04, 0x07, 0x67, 0x99, 0xc2, 0xc8, 0x47, 0x82, 0x96, 0x5b, 0x94, 0x84,
+  0x18, 0x23, 0x1a, 0x04, 0x00, 0x34, 0x80, 0x9f, 0x07, 0xb8, 0x66, 0xa0,
+  0x00, 0x5b, 0x95, 0xa7, 0x4c, 0x1c, 0x41, 0x03, 0xa3, 0x87, 0x00, 0x63,
+  0x06, 0x03, 0x00, 0xd0, 0x43, 0xcc, 0x47, 0x88, 0x43, 0x02, 0x83, 0x82,
+  0x80, 0x93, 0x07, 0xc0, 0x04, 0xb3, 0x07, 0xf5, 0x02, 0xb7, 0x66, 0xa0,
+  0x00, 0x13, 0x87, 0x86, 0x6b, 0x93, 0x86, 0x86, 0x6b, 0xb3, 0x05, 0xf7,
+  0x00, 0x90, 0x41, 0xb1, 0x07, 0xba, 0x97, 0x41, 0x06, 0x13, 0x87, 0x07,
+  0x04, 0x63, 0x7b, 0xe6, 0x00, 0x90, 0xc1, 0x5b, 0x95, 0xa6, 0x4c, 0x1e,
+  0x25, 0x23, 0x15, 0x05, 0x00, 0xfd, 0x17, 0x1e, 0xa5, 0x82, 0x80, 0x9c,
+  0xc1, 0xfd, 0xb7, 0x38, 0x80, 0x1f, 0x04, 0xb8, 0x66, 0xa0, 0x00, 0x5b,
+  0x14, 0xa4, 0x4c, 0x04, 0x40, 0x3e, 0x24, 0x05, 0x46, 0x8c, 0x40, 0xbe,
+  0x95, 0xef, 0x00, 0x90, 0x7e, 0x2a, 0x24, 0x05, 0x05, 0x21, 0x9d, 0x2a,
+  0xa4, 0xdc, 0x44, 0x33, 0x35, 0xf5, 0x00, 0x13, 0x45, 0x15, 0x00, 0x34,
+  0x80, 0x48, 0x81, 0x2a, 0x84, 0x13, 0x06, 0xf1, 0x00, 0xa5, 0x45, 0x9f,
+  0x04, 0x70, 0x66, 0xa0, 0x00, 0x23, 0x07, 0x01, 0x00, 0xa3, 0x07, 0x01,
+  0x00, 0x5b, 0x99, 0x84, 0x18, 0xef, 0x00, 0x90, 0x7d, 0x83, 0x47, 0xf1,
+  0x00, 0x99, 0xcb, 0xdb, 0x94, 0x84, 0x18, 0xde, 0x28, 0x91, 0xc7, 0x9c,
+  0x40, 0x81, 0xc7, 0x85, 0x45, 0x22, 0x85, 0x19, 0x3f, 0x44, 0x81, 0x05,
+  0x46, 0x93, 0x05, 0xe1, 0x00, 0x22, 0x85, 0xef, 0x00, 0x10, 0x7a, 0x83,
+  0x56, 0x49, 0x01, 0x83, 0x27, 0xc9, 0x00, 0x03, 0x47, 0xe1, 0x00, 0xb6,
+  0x97, 0x98, 0xa3, 0x83, 0x57, 0x49, 0x01, 0x03, 0x57, 0x09, 0x01, 0x85,
+  0x07, 0xa1, 0x9f, 0x23, 0x1a, 0xf9, 0x00, 0x63, 0xe5, 0xe7, 0x00, 0x85,
+  0x45, 0x22, 0x85, 0xf9, 0x3d, 0x13, 0x06, 0xf1, 0x00, 0xa5, 0x45, 0x22,
+  0x85, 0xef, 0x00, 0xd0, 0x77, 0x55, 0xb7, 0x58, 0x81, 0xfd, 0x15, 0x93,
+  0xf7, 0xf5, 0x0f, 0xbb, 0xf3, 0x67, 0x05, 0xb7, 0x75, 0xa2, 0x00, 0x93,
+  0x85, 0x05, 0xeb, 0x9b, 0x85, 0xf5, 0x04, 0x9c, 0x41, 0x2a, 0x84, 0x82,
+  0x87, 0x9f, 0x04, 0xb8, 0x66, 0xa0, 0x00, 0xa3, 0x07, 0x01, 0x00, 0xdb,
+  0x94, 0xa4, 0x4c, 0x9e, 0x24, 0x81, 0xeb, 0x01, 0x46, 0x89, 0x45, 0x22,
+  0x85, 0xef, 0x00, 0x10, 0x74, 0x01, 0x45, 0x54, 0x81, 0x13, 0x06, 0xf1,
+  0x00, 0x9d, 0x45, 0x22, 0x85, 0xef, 0x00, 0x10, 0x73, 0x83, 0x47, 0xf1,
+  0x00, 0xf5, 0xf7, 0x22, 0x85, 0x09, 0x37, 0x6d, 0xd5, 0x22, 0x85, 0x45,
+  0x35, 0x22, 0x85, 0x6d, 0x3d, 0xf9, 0xb7, 0x13, 0x06, 0xf1, 0x00, 0xa5,
+  0x45, 0x9f, 0x04, 0x70, 0x66, 0xa0, 0x00, 0x23, 0x07, 0x01, 0x00, 0xa3,
+  0x07, 0x01, 0x00, 0x81, 0x49, 0xef, 0x00, 0x10, 0x70, 0x5b, 0x99, 0x84,
+  0x18, 0x83, 0x47, 0xf1, 0x00, 0x81, 0xcf, 0xdb, 0x97, 0x84, 0x18, 0xda,
+  0x2b, 0x45, 0xdb, 0xf8, 0x2b, 0x09, 0x8b, 0x4d, 0xd7, 0xbe, 0x2b, 0xe3,
+  0xe3, 0xf9, 0xfa, 0x71, 0xa0, 0x05, 0x46, 0x93, 0x05, 0xe1, 0x00, 0x22,
+  0x85, 0xef, 0x00, 0x30, 0x6c, 0x83, 0x27, 0x09, 0x00, 0x85, 0x09, 0xc2,
+  0x09, 0x93, 0xd9, 0x09, 0x01, 0x81, 0xeb, 0x13, 0x06, 0xf1, 0x00, 0xa5,
+  0x45, 0x22, 0x85, 0xef, 0x00, 0xb0, 0x6b, 0x7d, 0xbf, 0x83, 0x56, 0x49,
+  0x01, 0x83, 0x27, 0xc9, 0x00, 0x03, 0x47, 0xe1, 0x00, 0xb6, 0x97, 0x98,
+  0xa3, 0x83, 0x57, 0x49, 0x01, 0x03, 0x57, 0x09, 0x01, 0x85, 0x07, 0xa1,
+  0x9f, 0x23, 0x1a, 0xf9, 0x00, 0xe3, 0xe9, 0xe7, 0xfc, 0x81, 0x45, 0x22,
+  0x85, 0xd5, 0x33, 0xe1, 0xb7, 0x13, 0x06, 0xf1, 0x00, 0xa5, 0x45, 0x9f,
+  0x04, 0x70, 0x66, 0xa0, 0x00, 0x23, 0x07, 0x01, 0x00, 0xa3, 0x07, 0x01,
+  0x00, 0x81, 0x49, 0xef, 0x00, 0x30, 0x67, 0x5b, 0x99, 0x84, 0x18, 0x83,
+  0x47, 0xf1, 0x00, 0x91, 0xcf, 0xdb, 0x97, 0x84, 0x18, 0xda, 0x2b, 0xe3,
+  0x01, 0x07, 0xf2, 0xf8, 0x2b, 0x93, 0x76, 0x17, 0x00, 0xb5, 0xd6, 0x81,
+  0x45, 0x22, 0x85, 0x5d, 0x33, 0x01, 0xbf, 0x05, 0x46, 0x93, 0x05, 0xe1,
+  0x00, 0x22, 0x85, 0xef, 0x00, 0x10, 0x63, 0x83, 0x27, 0x09, 0x00, 0x85,
+  0x09, 0xc2, 0x09, 0x93, 0xd9, 0x09, 0x01, 0x81, 0xeb, 0x13, 0x06, 0xf1,
+  0x00, 0xa5, 0x45, 0x22, 0x85, 0xef, 0x00, 0x90, 0x62, 0x6d, 0xbf, 0x83,
+  0x56, 0x49, 0x01, 0x83, 0x27, 0xc9, 0x00, 0x03, 0x47, 0xe1, 0x00, 0xb6,
+  0x97, 0x98, 0xa3, 0x83, 0x57, 0x49, 0x01, 0x03, 0x57, 0x09, 0x01, 0x85,
+  0x07, 0xa1, 0x9f, 0x23, 0x1a, 0xf9, 0x00, 0xe3, 0xe9, 0xe7, 0xfc, 0x81,
+  0x45, 0x22, 0x85, 0x89, 0x3b, 0xe1, 0xb7, 0x9f, 0x07, 0x70, 0x66, 0xa0,
+  0x00, 0xdb, 0x97, 0xa7, 0x18, 0xdc, 0x43, 0x81, 0xc7, 0x81, 0x45, 0x01,
+  0x45, 0x82, 0x97, 0x22, 0x85, 0xf5, 0x33, 0x4d, 0xb5, 0x9f, 0x07, 0x70,
+  0x66, 0xa0, 0x00, 0xdb, 0x97, 0xa7, 0x18, 0x9c, 0x47, 0xdd, 0xb7, 0x58,
+  0x81, 0x89, 0x47, 0x63, 0xed, 0xa7, 0x0a, 0xdd, 0xc9, 0x83, 0xc8, 0x15,
+  0x00, 0x13, 0x08, 0x20, 0x07, 0x63, 0x66, 0x18, 0x0b, 0x83, 0xc8, 0x05,
+  0x00, 0x63, 0x62, 0x18, 0x0b, 0x45, 0xc2, 0x03, 0x48, 0x46, 0x00, 0xbb,
+  0x76, 0x28, 0x04, 0x03, 0x48, 0x66, 0x00, 0x63, 0xe9, 0x07, 0x09, 0x5c,
+  0x32, 0x3b, 0xf3, 0x27, 0x02, 0x37, 0x69, 0xa0, 0x00, 0x93, 0x07, 0xc9,
+  0x66, 0xaa, 0x97, 0x9c, 0x23, 0xaa, 0x84, 0x13, 0x09, 0xc9, 0x66, 0x01,
+  0x44, 0xa5, 0xeb, 0xba, 0x89, 0x36, 0xc6, 0x32, 0x84, 0x2e, 0xc4, 0xef,
+  0x10, 0x30, 0x0b, 0x63, 0x87, 0x09, 0x06, 0x83, 0xa6, 0x09, 0x00, 0xbd,
+  0xc2, 0x03, 0xa7, 0x49, 0x00, 0x25, 0xc3, 0x13, 0x05, 0xc0, 0x04, 0x33,
+  0x85, 0xa4, 0x02, 0x1f, 0x07, 0x70, 0x66, 0xa0, 0x00, 0x5b, 0x17, 0x97,
+  0x18, 0x54, 0xc7, 0x83, 0xa6, 0x49, 0x00, 0xb2, 0x47, 0x22, 0x46, 0x16,
+  0xab, 0x1f, 0x07, 0xb8, 0x66, 0xa0, 0x00, 0xa2, 0x86, 0x93, 0x05, 0xc5,
+  0x00, 0xba, 0x95, 0x2a, 0x97, 0x0c, 0xc3, 0x4c, 0xc3, 0x26, 0x85, 0x11,
+  0x47, 0x9f, 0x05, 0x62, 0x25, 0xa2, 0x00, 0xef, 0x00, 0x70, 0x4b, 0x2a,
+  0x84, 0x01, 0xe9, 0x26, 0x99, 0x85, 0x47, 0x26, 0x85, 0x23, 0x00, 0xf9,
+  0x00, 0xef, 0x10, 0x10, 0x06, 0x22, 0x85, 0x54, 0x81, 0x37, 0x04, 0x00,
+  0x80, 0x05, 0x04, 0xdd, 0xbf, 0x1f, 0x04, 0x44, 0x10, 0x00, 0x80, 0xfd,
+  0xb7, 0x48, 0x80, 0xbb, 0x75, 0x15, 0x03, 0x1f, 0x09, 0x6c, 0x66, 0xa0,
+  0x00, 0x2a, 0x99, 0x83, 0x47, 0x09, 0x00, 0x2a, 0x84, 0x81, 0x44, 0x9d,
+  0xcf, 0xef, 0x00, 0x30, 0x4b, 0xaa, 0x84, 0x22, 0x85, 0xef, 0x10, 0xb0,
+  0x02, 0x1f, 0x05, 0x70, 0x66, 0x89, 0xf4, 0x02, 0x0b, 0xf4, 0xa0, 0x00,
+  0xe1, 0x46, 0x01, 0x46, 0xe1, 0x45, 0x5b, 0x15, 0x85, 0x18, 0xef, 0x20,
+  0xf0, 0x5a, 0x1f, 0x05, 0xb8, 0x66, 0xa0, 0x00, 0x93, 0x06, 0xc0, 0x04,
+  0x01, 0x46, 0x93, 0x05, 0xc0, 0x04, 0x5b, 0x15, 0x85, 0x4c, 0xef, 0x20,
+  0x70, 0x59, 0x23, 0x00, 0x09, 0x00, 0x26, 0x85, 0x44, 0x80, 0xb7, 0x04,
+  0x00, 0x80, 0x85, 0x04, 0xdd, 0xbf, 0x78, 0x81, 0xa3, 0x07, 0x01, 0x00,
+  0x3b, 0x77, 0x15, 0x03, 0xa1, 0xcd, 0x39, 0xca, 0x9f, 0x07, 0x6c, 0x66,
+  0xa0, 0x00, 0xaa, 0x97, 0x9c, 0x23, 0xaa, 0x84, 0xa1, 0xcb, 0xae, 0x89,
+  0x32, 0x89, 0xef, 0x10, 0xc0, 0x7f, 0xaa, 0x8a, 0x4e, 0x99, 0x4e, 0x8a,
+  0x33, 0x04, 0x3a, 0x41, 0x63, 0x18, 0x2a, 0x01, 0xd6, 0x85, 0x26, 0x85,
+  0xef, 0x10, 0xa0, 0x7e, 0x22, 0x85, 0x74, 0x81, 0x13, 0x06, 0xf1, 0x00,
+  0x9d, 0x45, 0x26, 0x85, 0xef, 0x00, 0xb0, 0x45, 0x83, 0x47, 0xf1, 0x00,
+  0xe5, 0xf3, 0xd2, 0x85, 0x13, 0x04, 0x1a, 0x00, 0x05, 0x46, 0x26, 0x85,
+  0xef, 0x00, 0x30, 0x42, 0x22, 0x8a, 0xe9, 0xb7, 0x37, 0x04, 0x00, 0x80,
+  0x05, 0x04, 0xc9, 0xbf, 0x1f, 0x04, 0x40, 0x10, 0x00, 0x80, 0xe9, 0xb7,
+  0x78, 0x81, 0x3b, 0x78, 0x15, 0x03, 0xb1, 0xcd, 0x29, 0xce, 0x9f, 0x07,
+  0x6c, 0x66, 0xa0, 0x00, 0xaa, 0x97, 0x9c, 0x23, 0xaa, 0x84, 0xb1, 0xcb,
+  0xae, 0x89, 0x32, 0x89, 0xa3, 0x07, 0x01, 0x00, 0xef, 0x10, 0xa0, 0x78,
+  0xaa, 0x8a, 0x4e, 0x99, 0x4e, 0x8a, 0x33, 0x04, 0x3a, 0x41, 0x63, 0x18,
+  0x49, 0x01, 0xd6, 0x85, 0x26, 0x85, 0xef, 0x10, 0x80, 0x77, 0x22, 0x85,
+  0x74, 0x81, 0x13, 0x06, 0xf1, 0x00, 0xa5, 0x45, 0x26, 0x85, 0xef, 0x00,
+  0x90, 0x3e, 0x83, 0x47, 0xf1, 0x00, 0xe5, 0xf3, 0xd2, 0x85, 0x13, 0x04,
+  0x1a, 0x00, 0x05, 0x46, 0x26, 0x85, 0xef, 0x00, 0x30, 0x3c, 0x22, 0x8a,
+  0xe9, 0xb7, 0x37, 0x04, 0x00, 0x80, 0x05, 0x04, 0xc9, 0xbf, 0x1f, 0x04,
+  0x40, 0x10, 0x00, 0x80, 0xe9, 0xb7, 0x3b, 0x7a, 0x05, 0x03, 0x9f, 0x07,
+  0x6c, 0x66, 0xa0, 0x00, 0xaa, 0x97, 0x9c, 0x23, 0x91, 0xcf, 0x18, 0x81,
+  0x13, 0x06, 0xf1, 0x00, 0xa5, 0x45, 0xa3, 0x07, 0x01, 0x00, 0xef, 0x00,
+  0x10, 0x3a, 0x83, 0x47, 0xf1, 0x00, 0x3e, 0x85, 0x14, 0x81, 0x81, 0x47,
+  0x3e, 0x85, 0x82, 0x80, 0x58, 0x80, 0xaa, 0x89, 0xef, 0x10, 0x60, 0x74,
+  0xef, 0x10, 0x20, 0x75, 0xef, 0xf0, 0x4f, 0xf4, 0xaa, 0x84, 0xef, 0x00,
+  0x70, 0x7c, 0x1c, 0x41, 0x1f, 0x09, 0x9c, 0x67, 0xa0, 0x00, 0x23, 0x20,
+  0xa9, 0x00, 0x82, 0x97, 0x19, 0xc5, 0x2a, 0x84, 0x26, 0x85, 0xef, 0xf0,
+  0xef, 0xf2, 0x22, 0x85, 0x54, 0x80, 0x83, 0x27, 0x09, 0x00, 0x4e, 0x85,
+  0x9c, 0x47, 0x82, 0x97, 0x2a, 0x84, 0x26, 0x85, 0xef, 0xf0, 0x8f, 0xf1,
+  0x6d, 0xf4, 0x9f, 0x07, 0xa1, 0x67, 0xa0, 0x00, 0x05, 0x47, 0x98, 0xa3,
+  0xf9, 0xbf, 0x9f, 0x07, 0xa1, 0x67, 0xa0, 0x00, 0x9c, 0x23, 0x9d, 0xcb,
+  0x48, 0x80, 0x85, 0x44, 0xfd, 0x57, 0x63, 0xe5, 0xa4, 0x02, 0x2a, 0x84,
+  0xef, 0xf0, 0x8f, 0xee, 0x9f, 0x07, 0x9c, 0x67, 0xa0, 0x00, 0x9c, 0x43,
+  0x2a, 0x89, 0x22, 0x85, 0x9c, 0x4b, 0x82, 0x97, 0x4a, 0x85, 0xef, 0xf0,
+  0xaf, 0xed, 0x9f, 0x07, 0xa0, 0x67, 0xa0, 0x00, 0x84, 0xa3, 0x81, 0x47,
+  0x3e, 0x85, 0x44, 0x80, 0xfd, 0x57, 0x3e, 0x85, 0x82, 0x80, 0x9f, 0x07,
+  0xa1, 0x67, 0xa0, 0x00, 0x9c, 0x23, 0x99, 0xe3, 0x7d, 0x55, 0x82, 0x80,
+  0x18, 0x81, 0xef, 0xf0, 0xaf, 0xea, 0x9f, 0x07, 0x9c, 0x67, 0xa0, 0x00,
+  0x9c, 0x43, 0x2a, 0xc6, 0xdc, 0x4b, 0x82, 0x97, 0x32, 0x45, 0xef, 0xf0,
+  0xef, 0xe9, 0x9f, 0x07, 0xa0, 0x67, 0xa0, 0x00, 0x23, 0x80, 0x07, 0x00,
+  0x01, 0x45, 0x14, 0x81, 0xb7, 0x67, 0xa0, 0x00, 0x03, 0xc7, 0x17, 0x7a,
+  0x1d, 0xc7, 0x28, 0x80, 0x13, 0x84, 0x17, 0x7a, 0x9f, 0x07, 0xa0, 0x67,
+  0xa0, 0x00, 0x9c, 0x23, 0x91, 0xc3, 0x45, 0x3f, 0x9f, 0x07, 0x9c, 0x67,
+  0xa0, 0x00, 0x9c, 0x43, 0x99, 0xc3, 0xdc, 0x43, 0x82, 0x97, 0xef, 0x10,
+  0x00, 0x66, 0x01, 0x45, 0x23, 0x00, 0x04, 0x00, 0x24, 0x80, 0x01, 0x45,
+  0x82, 0x80, 0x9f, 0x07, 0xa0, 0x67, 0xa0, 0x00, 0x9c, 0x23, 0x99, 0xe3,
+  0x7d, 0x55, 0x82, 0x80, 0x18, 0x81, 0xef, 0xf0, 0xaf, 0xe3, 0x9f, 0x07,
+  0x9c, 0x67, 0xa0, 0x00, 0x9c, 0x43, 0x2a, 0xc6, 0x9c, 0x4f, 0x82, 0x97,
+  0x32, 0x45, 0xef, 0xf0, 0xef, 0xe2, 0x01, 0x45, 0x14, 0x81, 0x18, 0x80,
+  0xef, 0x10, 0x70, 0x62, 0xa9, 0x22, 0x03, 0x23, 0x05, 0x00, 0x10, 0x80,
+  0x02, 0x83, 0x68, 0x81, 0xa3, 0x07, 0x01, 0x00, 0x7d, 0x54, 0x93, 0x07,
+  0xf0, 0x0f, 0x63, 0xee, 0xb7, 0x02, 0x05, 0xcd, 0xbb, 0x7d, 0x06, 0x08,
+  0x2e, 0x84, 0x32, 0x89, 0xaa, 0x84, 0x15, 0x22, 0x2a, 0x8a, 0xef, 0xf0,
+  0xef, 0xde, 0x83, 0x27, 0x0a, 0x01, 0xaa, 0x89, 0x93, 0x05, 0xf1, 0x00,
+  0x22, 0x85, 0x82, 0x97, 0x2a, 0x84, 0x01, 0xed, 0x83, 0x47, 0xf1, 0x00,
+  0x4e, 0x85, 0x33, 0xd6, 0x27, 0x41, 0x05, 0x8a, 0x90, 0xa0, 0xef, 0xf0,
+  0x2f, 0xdd, 0x22, 0x85, 0x64, 0x81, 0x4e, 0x85, 0xef, 0xf0, 0x8f, 0xdc,
+  0x7d, 0x54, 0xd5, 0xbf, 0x88, 0x80, 0x7d, 0x54, 0x31, 0xc2, 0x93, 0x07,
+  0xf0, 0x0f, 0x63, 0xef, 0xb7, 0x02, 0xb3, 0x87, 0xc5, 0x00, 0x13, 0x07,
+  0x00, 0x10, 0x63, 0x69, 0xf7, 0x02, 0x1d, 0xc5, 0x32, 0x89, 0xae, 0x89,
+  0x2a, 0x8a, 0xe1, 0x20, 0x2a, 0x8b, 0xef, 0xf0, 0x2f, 0xd9, 0xaa, 0x8a,
+  0x81, 0x44, 0x83, 0x27, 0x0b, 0x01, 0xb3, 0x05, 0x9a, 0x00, 0x33, 0x85,
+  0x99, 0x00, 0x82, 0x97, 0x2a, 0x84, 0x19, 0xc5, 0x56, 0x85, 0xef, 0xf0,
+  0xef, 0xd7, 0x7d, 0x54, 0x22, 0x85, 0x84, 0x80, 0x85, 0x04, 0xe3, 0xe0,
+  0x24, 0xff, 0x56, 0x85, 0xef, 0xf0, 0xcf, 0xd6, 0xc5, 0xbf, 0x68, 0x81,
+  0x7d, 0x54, 0x93, 0x07, 0xf0, 0x0f, 0x63, 0xe4, 0xa7, 0x04, 0x3b, 0xf1,
+  0x15, 0x08, 0x2e, 0x89, 0xaa, 0x84, 0xa3, 0x07, 0x01, 0x00, 0xa5, 0x28,
+  0x2a, 0x8a, 0xef, 0xf0, 0x2f, 0xd4, 0x83, 0x27, 0x0a, 0x01, 0xaa, 0x89,
+  0x93, 0x05, 0xf1, 0x00, 0x26, 0x85, 0x82, 0x97, 0x09, 0xc5, 0x4e, 0x85,
+  0xef, 0xf0, 0x4f, 0xd3, 0x29, 0xa8, 0x83, 0x47, 0xf1, 0x00, 0xb3, 0xd7,
+  0x27, 0x01, 0x85, 0x8b, 0x89, 0xcb, 0x4e, 0x85, 0x37, 0x04, 0x00, 0x80,
+  0xef, 0xf0, 0xcf, 0xd1, 0x05, 0x04, 0x22, 0x85, 0x64, 0x81, 0x26, 0x85,
+  0xef, 0x10, 0xf0, 0x51, 0x85, 0x45, 0x83, 0x27, 0xca, 0x01, 0xb3, 0x95,
+  0x25, 0x01, 0x2a, 0x86, 0x81, 0x9d, 0x26, 0x85, 0x82, 0x97, 0x2a, 0x84,
+  0x4e, 0x85, 0x69, 0xd0, 0xef, 0xf0, 0x4f, 0xcf, 0x7d, 0x54, 0xe1, 0xbf,
+  0x19, 0xc5, 0x9f, 0x07, 0xa4, 0x67, 0xa0, 0x00, 0x88, 0xc3, 0x01, 0x45,
+  0x82, 0x80, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05, 0x82, 0x80, 0x9f, 0x07,
+  0xa4, 0x67, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0x9f, 0x07, 0xa8, 0x67,
+  0xa0, 0x00, 0x23, 0x80, 0x07, 0x00, 0x82, 0x80, 0x38, 0x80, 0xaa, 0x84,
+  0xef, 0x10, 0xb0, 0x4c, 0x2a, 0x84, 0x26, 0x85, 0xef, 0x10, 0x90, 0x4c,
+  0x9f, 0x07, 0x90, 0x24, 0xa0, 0x00, 0x9b, 0x87, 0x87, 0x04, 0x9c, 0x43,
+  0x05, 0x81, 0xc5, 0xd9, 0x02, 0x0c, 0xf3, 0x21, 0x9d, 0x1b, 0x85, 0xa7,
+  0x04, 0x34, 0x80, 0x18, 0x80, 0x01, 0x45, 0x55, 0x22, 0xb7, 0x67, 0xa0,
+  0x00, 0x03, 0xa7, 0x07, 0x7b, 0x9f, 0x06, 0x00, 0x24, 0xa0, 0x00, 0x94,
+  0x22, 0x5c, 0x43, 0x01, 0x45, 0x93, 0xf7, 0x07, 0xf0, 0xd5, 0x8f, 0x5c,
+  0xc3, 0x9f, 0x07, 0xa8, 0x67, 0xa0, 0x00, 0x05, 0x47, 0x98, 0xa3, 0x14,
+  0x80, 0x9f, 0x07, 0xa8, 0x67, 0xa0, 0x00, 0x9c, 0x23, 0xa1, 0xc7, 0x48,
+  0x80, 0x2a, 0x84, 0x93, 0x07, 0xf0, 0x0f, 0x63, 0xe3, 0xa7, 0x04, 0xa9,
+  0xc1, 0xae, 0x84, 0x49, 0x3f, 0x2a, 0x89, 0x22, 0x85, 0xef, 0x10, 0xb0,
+  0x45, 0x9f, 0x07, 0xb0, 0x67, 0xa0, 0x00, 0x1b, 0x85, 0xa7, 0x04, 0x18,
+  0x41, 0xc1, 0x76, 0x05, 0x88, 0x1c, 0x43, 0xf5, 0x8f, 0x9f, 0x06, 0x5a,
+  0x5a, 0x00, 0x00, 0xd5, 0x8f, 0x1c, 0xc3, 0x83, 0x27, 0x09, 0x00, 0x11,
+  0xc0, 0xa1, 0x83, 0x9c, 0xa0, 0x01, 0x45, 0x44, 0x80, 0x1f, 0x05, 0x91,
+  0x13, 0x00, 0x80, 0x82, 0x80, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05, 0xc5,
+  0xbf, 0x9f, 0x07, 0xa8, 0x67, 0xa0, 0x00, 0x9c, 0x23, 0x99, 0xef, 0x1f,
+  0x05, 0x91, 0x13, 0x00, 0x80, 0x82, 0x80, 0xb3, 0x05, 0x89, 0x00, 0x22,
+  0x85, 0x61, 0x37, 0x19, 0xe9, 0x05, 0x04, 0xe3, 0x6a, 0x94, 0xfe, 0x01,
+  0x45, 0x44, 0x80, 0x48, 0x80, 0x2a, 0x89, 0xae, 0x84, 0x01, 0x44, 0xc5,
+  0xbf, 0x7d, 0x55, 0xcd, 0xbf, 0x9f, 0x07, 0xa8, 0x67, 0xa0, 0x00, 0x9c,
+  0x23, 0xc1, 0xc3, 0x58, 0x80, 0x2a, 0x84, 0x93, 0x07, 0xf0, 0x0f, 0x63,
+  0xef, 0xa7, 0x06, 0xb7, 0x64, 0xa0, 0x00, 0x2e, 0x89, 0x93, 0x89, 0x04,
+  0x7b, 0xef, 0x10, 0x70, 0x3c, 0x1b, 0x85, 0xa9, 0x04, 0x18, 0x41, 0xc1,
+  0x76, 0x22, 0x85, 0x1c, 0x43, 0x93, 0x84, 0x04, 0x7b, 0xf5, 0x8f, 0x9f,
+  0x06, 0xa5, 0xa5, 0x00, 0x00, 0xd5, 0x8f, 0x1c, 0xc3, 0xef, 0x10, 0x70,
+  0x3a, 0x1b, 0x85, 0xa9, 0x04, 0x18, 0x41, 0x13, 0x05, 0x40, 0x06, 0x5c,
+  0x47, 0x93, 0xe7, 0x17, 0x00, 0x5c, 0xc7, 0xef, 0xf0, 0x2f, 0xed, 0x22,
+  0x85, 0x75, 0x3d, 0x93, 0x77, 0x14, 0x00, 0x91, 0xc3, 0x22, 0x09, 0x23,
+  0x20, 0x25, 0x01, 0x22, 0x85, 0xef, 0x10, 0xb0, 0x37, 0x9b, 0x84, 0xa4,
+  0x04, 0x98, 0x40, 0x13, 0x05, 0x40, 0x06, 0x5c, 0x47, 0xf9, 0x9b, 0x5c,
+  0xc7, 0xef, 0xf0, 0x8f, 0xea, 0x01, 0x45, 0x54, 0x80, 0x1f, 0x05, 0x91,
+  0x13, 0x00, 0x80, 0x82, 0x80, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05, 0xc5,
+  0xbf, 0x9f, 0x07, 0xa8, 0x67, 0xa0, 0x00, 0x9c, 0x23, 0x95, 0xc7, 0x58,
+  0x80, 0xb2, 0x89, 0x2e, 0x84, 0xae, 0x84, 0x33, 0x09, 0xb5, 0x40, 0xb3,
+  0x87, 0x84, 0x40, 0x63, 0xe4, 0x37, 0x01, 0x01, 0x45, 0x54, 0x80, 0x8c,
+  0x20, 0x33, 0x05, 0x99, 0x00, 0x01, 0x46, 0x3d, 0x3f, 0x85, 0x04, 0x65,
+  0xd5, 0x7d, 0x55, 0xfd, 0xb7, 0x1f, 0x05, 0x91, 0x13, 0x00, 0x80, 0x82,
+  0x80, 0x9f, 0x07, 0x00, 0x24, 0xa0, 0x00, 0x88, 0xc3, 0x82, 0x80, 0x1f,
+  0x05, 0x04, 0x24, 0xa0, 0x00, 0x82, 0x80, 0x63, 0x47, 0xa0, 0x02, 0x0a,
+  0x05, 0x1f, 0x07, 0x88, 0x24, 0xa0, 0x00, 0x9f, 0x07, 0xb0, 0x67, 0xa0,
+  0x00, 0xaa, 0x97, 0x3a, 0x95, 0x18, 0x41, 0x01, 0x45, 0x98, 0xc3, 0xb7,
+  0x27, 0xa0, 0x00, 0x03, 0xa7, 0xc7, 0x48, 0x9f, 0x07, 0xac, 0x67, 0xa0,
+  0x00, 0x98, 0xc3, 0x82, 0x80, 0x7d, 0x55, 0x82, 0x80, 0x18, 0x80, 0xef,
+  0xf0, 0x6f, 0xab, 0xef, 0x20, 0x80, 0x66, 0xef, 0x10, 0x10, 0x33, 0x01,
+  0xa0, 0x82, 0x80, 0x01, 0x45, 0x82, 0x80, 0x9f, 0x07, 0xbc, 0x67, 0xa0,
+  0x00, 0x94, 0x43, 0x05, 0x47, 0x63, 0x83, 0xe6, 0x00, 0x98, 0xc3, 0x01,
+  0x45, 0x82, 0x80, 0x9f, 0x07, 0xbc, 0x67, 0xa0, 0x00, 0x98, 0x43, 0x3b,
+  0x13, 0x07, 0x01, 0x23, 0xa0, 0x07, 0x00, 0x01, 0x45, 0x82, 0x80, 0x1f,
+  0x05, 0x02, 0x00, 0x30, 0x65, 0x82, 0x80, 0x37, 0x17, 0x11, 0x44, 0x83,
+  0x27, 0x07, 0x81, 0x93, 0xe7, 0x37, 0x00, 0x23, 0x28, 0xf7, 0x80, 0x0f,
+  0x00, 0xf0, 0x0f, 0x82, 0x80, 0x1c, 0x41, 0x1f, 0x07, 0xc4, 0x67, 0xa0,
+  0x00, 0xdb, 0x17, 0xf7, 0x1c, 0xd8, 0x3b, 0x3b, 0x13, 0x07, 0x01, 0xa3,
+  0x8a, 0x07, 0x00, 0x05, 0x45, 0x82, 0x80, 0x01, 0x45, 0x82, 0x80, 0x48,
+  0x80, 0x9f, 0x04, 0xc0, 0x67, 0xa0, 0x00, 0x9c, 0x20, 0x05, 0x49, 0x63,
+  0x85, 0x27, 0x05, 0x37, 0x65, 0xa0, 0x00, 0x13, 0x04, 0x45, 0x7c, 0x93,
+  0x06, 0x40, 0x05, 0x01, 0x46, 0x93, 0x05, 0x40, 0x05, 0x13, 0x05, 0x45,
+  0x7c, 0xef, 0x20, 0x80, 0x73, 0x9f, 0x07, 0x18, 0x68, 0xa0, 0x00, 0x09,
+  0x47, 0x93, 0x86, 0x07, 0x02, 0x1c, 0xc0, 0x93, 0x87, 0x07, 0x04, 0x18,
+  0xc4, 0x23, 0x22, 0x04, 0x00, 0x54, 0xcc, 0x58, 0xd0, 0x23, 0x20, 0x04,
+  0x02, 0x1c, 0xdc, 0x38, 0xc0, 0x23, 0x2e, 0x04, 0x02, 0x23, 0x80, 0x24,
+  0x01, 0x01, 0x45, 0x44, 0x80, 0xb7, 0x07, 0x10, 0x44, 0xb8, 0x43, 0x93,
+  0x16, 0x25, 0x00, 0x3d, 0x45, 0x33, 0x15, 0xd5, 0x00, 0x13, 0x45, 0xf5,
+  0xff, 0x79, 0x8d, 0xa8, 0xc3, 0x0f, 0x00, 0xf0, 0x0f, 0x01, 0x45, 0x82,
+  0x80, 0x38, 0x80, 0x1f, 0x04, 0xc0, 0x67, 0xa0, 0x00, 0x1c, 0x20, 0x8d,
+  0xc7, 0x9f, 0x07, 0xc4, 0x67, 0xa0, 0x00, 0x01, 0x45, 0x84, 0x43, 0xe9,
+  0x37, 0x05, 0x45, 0xd9, 0x37, 0x09, 0x45, 0xc9, 0x37, 0x93, 0x06, 0x00,
+  0x06, 0x01, 0x46, 0x93, 0x05, 0x00, 0x06, 0x26, 0x85, 0xef, 0x20, 0x80,
+  0x6b, 0x23, 0x00, 0x04, 0x00, 0x01, 0x45, 0x34, 0x80, 0x9f, 0x07, 0xc0,
+  0x67, 0xa0, 0x00, 0x9c, 0x23, 0x2a, 0x87, 0x7d, 0x55, 0x3b, 0x9a, 0x27,
+  0x01, 0x3b, 0x74, 0x37, 0x04, 0x71, 0xc6, 0x93, 0xd7, 0x25, 0x01, 0xb7,
+  0x76, 0xa2, 0x00, 0x93, 0xf7, 0xc7, 0x03, 0x93, 0x86, 0x46, 0xec, 0xb6,
+  0x97, 0x9c, 0x43, 0x82, 0x87, 0x93, 0x06, 0x00, 0x02, 0xad, 0x45, 0x01,
+  0x45, 0x29, 0xa8, 0xe1, 0x81, 0xbd, 0x89, 0x3b, 0x85, 0x25, 0x01, 0xbb,
+  0x86, 0x25, 0x02, 0x7d, 0x55, 0x82, 0x80, 0x93, 0x06, 0x00, 0x04, 0xad,
+  0x45, 0x0d, 0x45, 0x1f, 0x08, 0xff, 0xff, 0xff, 0x00, 0xb3, 0x07, 0x07,
+  0x01, 0x1f, 0x08, 0x10, 0x51, 0x10, 0x44, 0x1b, 0x08, 0xf8, 0x10, 0x83,
+  0x27, 0x08, 0x00, 0x9f, 0x08, 0xff, 0xff, 0x0f, 0xff, 0xb3, 0xf7, 0x17,
+  0x01, 0x9b, 0xa7, 0xa7, 0x28, 0x1f, 0x05, 0xff, 0xff, 0xf0, 0xff, 0xe9,
+  0x8f, 0x9b, 0xa7, 0xb7, 0x20, 0x23, 0x20, 0xf8, 0x00, 0x0f, 0x00, 0xf0,
+  0x0f, 0x37, 0xa5, 0x10, 0x44, 0x1e, 0x07, 0x93, 0x05, 0x45, 0x00, 0xba,
+  0x95, 0x89, 0x82, 0x2a, 0x97, 0x81, 0x47, 0x9c, 0xc1, 0x0f, 0x00, 0xf0,
+  0x0f, 0x08, 0x42, 0x08, 0xc3, 0x0f, 0x00, 0xf0, 0x0f, 0x85, 0x07, 0x11,
+  0x06, 0xe3, 0x97, 0xf6, 0xfe, 0x01, 0x45, 0x82, 0x80, 0x82, 0x80, 0x1f,
+  0x05, 0x03, 0x00, 0x20, 0x65, 0x82, 0x80, 0xd1, 0x46, 0xa9, 0x45, 0x85,
+  0xbf, 0x93, 0x06, 0x00, 0x04, 0xad, 0x45, 0x09, 0x45, 0x49, 0xb7, 0x93,
+  0x06, 0x00, 0x02, 0xad, 0x45, 0x05, 0x45, 0xa5, 0xbf, 0x93, 0x06, 0x00,
+  0x02, 0xb1, 0x45, 0x91, 0xbf, 0x82, 0x80, 0xb5, 0xc5, 0x68, 0x80, 0x1f,
+  0x04, 0xc4, 0x67, 0xa0, 0x00, 0x5b, 0x14, 0xa4, 0x1c, 0x58, 0x40, 0x2b,
+  0x67, 0x02, 0x0d, 0xf2, 0x36, 0x89, 0x14, 0x44, 0x93, 0x07, 0x17, 0x00,
+  0x04, 0x40, 0xb3, 0xf7, 0xd7, 0x02, 0x32, 0x8a, 0x9b, 0x84, 0xe4, 0x08,
+  0xae, 0x89, 0xc1, 0x46, 0x01, 0x46, 0xc1, 0x45, 0x26, 0x85, 0x5c, 0xc0,
+  0xef, 0x20, 0xa0, 0x59, 0x9c, 0x40, 0x93, 0x76, 0x19, 0x00, 0x13, 0x79,
+  0x49, 0x00, 0xf1, 0x9b, 0x33, 0x37, 0x20, 0x01, 0xd5, 0x8f, 0x9b, 0xa7,
+  0xe7, 0x02, 0x9c, 0xc0, 0xdc, 0x24, 0x23, 0xa4, 0x34, 0x01, 0x23, 0xa2,
+  0x44, 0x01, 0xc1, 0x9b, 0xdc, 0xa4, 0x63, 0x06, 0x09, 0x00, 0x85, 0x47,
+  0x7c, 0xb8, 0x01, 0x45, 0x64, 0x80, 0xa3, 0x0b, 0x04, 0x00, 0xe5, 0xbf,
+  0x1f, 0x05, 0xa4, 0x00, 0x20, 0x65, 0x82, 0x80, 0x68, 0x80, 0xb7, 0x69,
+  0xa0, 0x00, 0x13, 0x89, 0x49, 0x7c, 0x5b, 0x19, 0xa9, 0x1c, 0x83, 0x27,
+  0x09, 0x01, 0x05, 0x4a, 0x2a, 0x84, 0xb3, 0x14, 0xaa, 0x00, 0x93, 0x89,
+  0x49, 0x7c, 0xad, 0xcb, 0xa5, 0xc9, 0x83, 0x47, 0x49, 0x01, 0xad, 0xc7,
+  0xef, 0xf0, 0x9f, 0xd6, 0x35, 0xc1, 0xa3, 0x0a, 0x09, 0x00, 0x23, 0x0b,
+  0x49, 0x01, 0xb7, 0x87, 0x10, 0x44, 0x03, 0xa7, 0x47, 0x60, 0xd9, 0x8c,
+  0x23, 0xa2, 0x97, 0x60, 0x0f, 0x00, 0xf0, 0x0f, 0x1f, 0x09, 0xff, 0xff,
+  0xff, 0x00, 0xb3, 0x07, 0x24, 0x01, 0x1f, 0x09, 0x30, 0x51, 0x10, 0x44,
+  0x1b, 0x09, 0xf9, 0x10, 0x03, 0x27, 0x09, 0x00, 0x5b, 0x94, 0x89, 0x1c,
+  0x14, 0x44, 0x93, 0x77, 0xf7, 0x0f, 0x85, 0x07, 0xb3, 0xf7, 0xd7, 0x02,
+  0x08, 0x40, 0x13, 0x77, 0x07, 0xf0, 0x93, 0x05, 0x00, 0x02, 0x81, 0x9f,
+  0xb3, 0x64, 0xf7, 0x00, 0xef, 0xf0, 0xff, 0xd0, 0x23, 0x20, 0x99, 0x00,
+  0x0f, 0x00, 0xf0, 0x0f, 0x01, 0x45, 0x64, 0x80, 0xdb, 0x97, 0x89, 0x1c,
+  0x23, 0x8b, 0x07, 0x00, 0xb7, 0x87, 0x10, 0x44, 0x03, 0xa7, 0x47, 0x60,
+  0x93, 0xc4, 0xf4, 0xff, 0xf9, 0x8c, 0x69, 0xbf, 0x37, 0x87, 0x10, 0x44,
+  0x83, 0x26, 0x07, 0x60, 0x85, 0x47, 0x33, 0x95, 0xa7, 0x00, 0x75, 0x8d,
+  0x23, 0x20, 0xa7, 0x60, 0x0f, 0x00, 0xf0, 0x0f, 0x82, 0x80, 0x93, 0x07,
+  0xf5, 0xff, 0x3b, 0xf0, 0x47, 0x03, 0x58, 0x80, 0x2a, 0x84, 0xef, 0xf0,
+  0xaf, 0x8f, 0x37, 0x07, 0x10, 0x44, 0x2c, 0x43, 0x93, 0x16, 0x24, 0x00,
+  0x13, 0x35, 0x15, 0x00, 0x33, 0xd6, 0xd5, 0x00, 0x3d, 0x8a, 0x05, 0x05,
+  0x09, 0xc6, 0x1f, 0x05, 0x05, 0x00, 0x20, 0x65, 0x54, 0x80, 0xb3, 0x17,
+  0xd5, 0x00, 0xcd, 0x8f, 0x3c, 0xc3, 0x0f, 0x00, 0xf0, 0x0f, 0x3c, 0x43,
+  0xb3, 0xd7, 0xd7, 0x00, 0xbd, 0x8b, 0xe3, 0x12, 0xf5, 0xfe, 0xb7, 0x86,
+  0x10, 0x44, 0x03, 0xa6, 0x46, 0x60, 0x85, 0x44, 0xb3, 0x94, 0x84, 0x00,
+  0x93, 0xc7, 0xf4, 0xff, 0xf1, 0x8f, 0x23, 0xa2, 0xf6, 0x60, 0x0f, 0x00,
+  0xf0, 0x0f, 0x24, 0xd7, 0x0f, 0x00, 0xf0, 0x0f, 0x1f, 0x09, 0x80, 0x96,
+  0x98, 0x00, 0xb7, 0x09, 0x10, 0x44, 0x83, 0xa7, 0x49, 0x01, 0xe5, 0x8f,
+  0xa5, 0xcb, 0x23, 0xaa, 0x99, 0x00, 0x0f, 0x00, 0xf0, 0x0f, 0x37, 0x09,
+  0x00, 0x80, 0xef, 0xf0, 0xef, 0x87, 0x35, 0xe5, 0x13, 0x69, 0x09, 0x50,
+  0x9f, 0x04, 0x50, 0x10, 0x44, 0x00, 0xa2, 0x94, 0xa2, 0x04, 0x23, 0xa0,
+  0x24, 0x01, 0x0f, 0x00, 0xf0, 0x0f, 0x1f, 0x09, 0xc4, 0x67, 0xa0, 0x00,
+  0x5b, 0x19, 0x89, 0x1c, 0x03, 0x25, 0x09, 0x00, 0xef, 0xf0, 0xaf, 0x81,
+  0xc8, 0xd0, 0x0f, 0x00, 0xf0, 0x0f, 0x23, 0xa0, 0x04, 0x02, 0x0f, 0x00,
+  0xf0, 0x0f, 0x89, 0x47, 0xdc, 0xd4, 0x0f, 0x00, 0xf0, 0x0f, 0x22, 0x85,
+  0x21, 0x3f, 0x03, 0x25, 0x09, 0x00, 0x23, 0x22, 0x09, 0x00, 0x93, 0x06,
+  0x00, 0x02, 0x01, 0x46, 0x93, 0x05, 0x00, 0x02, 0xef, 0x20, 0x20, 0x3b,
+  0x01, 0x45, 0x99, 0xb7, 0x05, 0x45, 0x7d, 0x19, 0xef, 0xf0, 0xef, 0x9d,
+  0xe3, 0x11, 0x09, 0xf8, 0x79, 0xb7, 0x9f, 0x07, 0x00, 0x0a, 0x00, 0x00,
+  0x33, 0x69, 0xf9, 0x00, 0x41, 0xbf, 0x7d, 0x55, 0x82, 0x80, 0xbb, 0x77,
+  0x05, 0x03, 0x9f, 0x07, 0x04, 0xa0, 0x10, 0x44, 0x1b, 0x85, 0xa7, 0x0e,
+  0x41, 0x47, 0x81, 0x47, 0x1c, 0xc1, 0x0f, 0x00, 0xf0, 0x0f, 0x85, 0x07,
+  0xe3, 0x9c, 0xe7, 0xfe, 0x82, 0x80, 0x3b, 0x78, 0x46, 0x44, 0xa8, 0x81,
+  0x9f, 0x07, 0xc4, 0x67, 0xa0, 0x00, 0xdb, 0x97, 0xa7, 0x1c, 0xf8, 0x3b,
+  0xb2, 0x89, 0x2e, 0x89, 0x2a, 0x84, 0x41, 0xcf, 0xf8, 0x2b, 0x2a, 0xc6,
+  0x81, 0x44, 0x3b, 0x19, 0x17, 0x01, 0x98, 0x4b, 0x39, 0xcf, 0x94, 0x4f,
+  0xc8, 0x47, 0x70, 0x00, 0x9f, 0x05, 0x3e, 0x2e, 0xa2, 0x00, 0x02, 0x97,
+  0x63, 0x46, 0xa0, 0x0c, 0xb7, 0x07, 0x10, 0x44, 0xbc, 0x43, 0x22, 0x85,
+  0x79, 0x3f, 0x1f, 0x05, 0xb2, 0x00, 0x20, 0x65, 0x37, 0x87, 0x10, 0x44,
+  0x83, 0x26, 0x47, 0x60, 0x85, 0x47, 0xb3, 0x97, 0x87, 0x00, 0x93, 0xc7,
+  0xf7, 0xff, 0xf5, 0x8f, 0x23, 0x22, 0xf7, 0x60, 0x0f, 0x00, 0xf0, 0x0f,
+  0x63, 0x0e, 0x09, 0x00, 0xb7, 0xa7, 0x10, 0x44, 0x1e, 0x04, 0x13, 0x87,
+  0x47, 0x00, 0x22, 0x97, 0x93, 0xd9, 0x29, 0x00, 0x3e, 0x94, 0x81, 0x47,
+  0x63, 0x98, 0xf9, 0x08, 0xa4, 0x81, 0x93, 0x0a, 0x80, 0x3e, 0x1f, 0x0a,
+  0x70, 0x17, 0x00, 0x00, 0x32, 0x45, 0x3d, 0x35, 0x19, 0xc1, 0x01, 0x45,
+  0x55, 0xbf, 0x05, 0x45, 0x63, 0xe8, 0x9a, 0x00, 0xef, 0xf0, 0x6f, 0x90,
+  0x85, 0x04, 0xe3, 0x95, 0x44, 0xff, 0x49, 0xbf, 0xef, 0xf0, 0xaf, 0x8a,
+  0xd5, 0xbf, 0x9f, 0x04, 0xff, 0xff, 0xff, 0x00, 0xb7, 0x57, 0x10, 0x44,
+  0xaa, 0x94, 0xa2, 0x04, 0x13, 0x8b, 0x47, 0x13, 0x93, 0x87, 0x07, 0x13,
+  0x26, 0x9b, 0x33, 0x8a, 0xf4, 0x00, 0x81, 0x4a, 0x13, 0x0c, 0x80, 0x3e,
+  0x9f, 0x0b, 0x70, 0x17, 0x00, 0x00, 0x03, 0x27, 0x0b, 0x00, 0x83, 0x27,
+  0x0a, 0x00, 0x05, 0x45, 0x63, 0x01, 0xf7, 0x04, 0x63, 0x68, 0x5c, 0x01,
+  0xef, 0xf0, 0xaf, 0x8b, 0x85, 0x0a, 0xe3, 0x94, 0x7a, 0xff, 0x99, 0xb7,
+  0xef, 0xf0, 0xef, 0x85, 0xd5, 0xbf, 0xef, 0xf0, 0x8f, 0x85, 0xa9, 0xa0,
+  0x9f, 0x07, 0xb2, 0x00, 0x20, 0x65, 0xe3, 0x16, 0xf5, 0xf8, 0x3d, 0xb7,
+  0x1c, 0xc3, 0x0f, 0x00, 0xf0, 0x0f, 0x14, 0x40, 0x85, 0x07, 0x11, 0x09,
+  0x23, 0x2e, 0xd9, 0xfe, 0x85, 0xb7, 0x7d, 0x55, 0x82, 0x80, 0xef, 0xf0,
+  0x0f, 0x88, 0x9f, 0x07, 0xc0, 0x51, 0x10, 0x44, 0x01, 0x4a, 0xbe, 0x94,
+  0x13, 0x0b, 0x80, 0x3e, 0x9f, 0x0a, 0x70, 0x17, 0x00, 0x00, 0x9c, 0x40,
+  0xb9, 0xdb, 0x05, 0x45, 0xe3, 0x6d, 0x4b, 0xfb, 0xef, 0xf0, 0xef, 0x85,
+  0x05, 0x0a, 0xe3, 0x18, 0x5a, 0xff, 0xed, 0xb5, 0x9f, 0x07, 0x78, 0x68,
+  0xa0, 0x00, 0x05, 0x47, 0x98, 0xa3, 0x01, 0x45, 0x82, 0x80, 0x9f, 0x07,
+  0x78, 0x68, 0xa0, 0x00, 0x23, 0x80, 0x07, 0x00, 0x01, 0x45, 0x82, 0x80,
+  0x18, 0x80, 0xa9, 0x28, 0x05, 0xe1, 0x37, 0x77, 0xa0, 0x00, 0x83, 0x26,
+  0xc7, 0x87, 0x9c, 0x42, 0x93, 0xe7, 0x47, 0x00, 0x9c, 0xc2, 0x03, 0x27,
+  0xc7, 0x87, 0x1c, 0x43, 0x93, 0xe7, 0x27, 0x00, 0x1c, 0xc3, 0x14, 0x80,
+  0x1f, 0x05, 0x80, 0x11, 0x00, 0x80, 0xe5, 0xbf, 0xb7, 0x77, 0xa0, 0x00,
+  0x83, 0xa6, 0xc7, 0x87, 0x05, 0x46, 0x98, 0x42, 0x13, 0x67, 0x17, 0x00,
+  0x98, 0xc2, 0xfd, 0x56, 0x3e, 0x87, 0x83, 0x27, 0x72, 0x3e, 0x02, 0x0e,
+  0xf1, 0xc7, 0x87, 0x9c, 0x43, 0x91, 0x83, 0x85, 0x8b, 0x63, 0x87, 0xc7,
+  0x00, 0xfd, 0x16, 0xe5, 0xfa, 0x01, 0x45, 0x81, 0x45, 0x82, 0x80, 0x0d,
+  0xa0, 0x18, 0x80, 0xef, 0x00, 0xf0, 0x45, 0x09, 0xc9, 0xef, 0x00, 0x90,
+  0x45, 0x9f, 0x07, 0x7c, 0x68, 0xa0, 0x00, 0x88, 0xc3, 0x01, 0x45, 0x14,
+  0x80, 0x1f, 0x05, 0x80, 0x11, 0x00, 0x80, 0xe5, 0xbf, 0x9f, 0x07, 0x7c,
+  0x68, 0xa0, 0x00, 0x9c, 0x43, 0x8c, 0x47, 0xc8, 0x43, 0x82, 0x80, 0xbb,
+  0x75, 0x05, 0x03, 0x89, 0xc9, 0x9f, 0x07, 0x80, 0x68, 0xa0, 0x00, 0x1b,
+  0x85, 0xa7, 0x04, 0x0c, 0xc1, 0x01, 0x45, 0x82, 0x80, 0x37, 0x05, 0x00,
+  0x80, 0x05, 0x05, 0x82, 0x80, 0x28, 0x82, 0x2a, 0x84, 0x2e, 0xce, 0x32,
+  0xcc, 0x36, 0xca, 0x3a, 0xc8, 0x3e, 0xc6, 0xef, 0x00, 0x90, 0x37, 0x1f,
+  0x05, 0x80, 0x68, 0xa0, 0x00, 0x1b, 0x05, 0x85, 0x04, 0x08, 0x41, 0x01,
+  0xcd, 0xd2, 0x46, 0x91, 0xca, 0x03, 0x23, 0x05, 0x00, 0xb2, 0x47, 0x42,
+  0x47, 0x62, 0x46, 0xf2, 0x45, 0x22, 0x85, 0x20, 0x82, 0x02, 0x83, 0x1f,
+  0x05, 0x47, 0x10, 0x00, 0x80, 0x24, 0x82, 0x9f, 0x07, 0x80, 0x68, 0xa0,
+  0x00, 0x9b, 0x87, 0xa7, 0x04, 0x9c, 0x43, 0x03, 0xa3, 0x47, 0x00, 0x02,
+  0x83, 0x9f, 0x07, 0x80, 0x68, 0xa0, 0x00, 0x9b, 0x87, 0xa7, 0x04, 0x9c,
+  0x43, 0x03, 0xa3, 0xc7, 0x00, 0x02, 0x83, 0x9f, 0x07, 0x80, 0x68, 0xa0,
+  0x00, 0x9b, 0x87, 0xa7, 0x04, 0x9c, 0x43, 0x03, 0xa3, 0x07, 0x01, 0x02,
+  0x83, 0x9f, 0x07, 0x80, 0x68, 0xa0, 0x00, 0x9b, 0x87, 0xa7, 0x04, 0x9c,
+  0x43, 0x81, 0xc7, 0x03, 0xa3, 0x87, 0x00, 0x02, 0x83, 0x1f, 0x05, 0x47,
+  0x10, 0x00, 0x80, 0x82, 0x80, 0x09, 0xc6, 0xfd, 0x57, 0x1c, 0xc2, 0x01,
+  0x45, 0x82, 0x80, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05, 0x82, 0x80, 0x9f,
+  0x07, 0xa8, 0x68, 0xa0, 0x00, 0x3e, 0x95, 0x14, 0x21, 0x13, 0x07, 0xe0,
+  0x03, 0xbb, 0xf3, 0x06, 0x03, 0x9f, 0x07, 0x3c, 0x6f, 0xa2, 0x00, 0xb6,
+  0x97, 0x98, 0x23, 0x18, 0xc2, 0x01, 0x45, 0x82, 0x80, 0x9f, 0x07, 0x8c,
+  0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7, 0x04, 0x23, 0x20, 0x05, 0x00, 0x01,
+  0x45, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7,
+  0x04, 0x18, 0x41, 0x85, 0x89, 0x1c, 0x47, 0xf9, 0x9b, 0xcd, 0x8f, 0x1c,
+  0xc7, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7,
+  0x04, 0x1c, 0x41, 0x01, 0x45, 0xfc, 0x43, 0x85, 0x8b, 0x1c, 0xa2, 0x82,
+  0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7, 0x04, 0x1c,
+  0x41, 0x01, 0x45, 0xfc, 0x43, 0x85, 0x83, 0x85, 0x8b, 0x1c, 0xa2, 0x82,
+  0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7, 0x04, 0x1c,
+  0x41, 0x01, 0x45, 0xfc, 0x43, 0x81, 0x9f, 0x85, 0x83, 0x93, 0xc7, 0x17,
+  0x00, 0x85, 0x8b, 0x1c, 0xa2, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0,
+  0x00, 0x1b, 0x85, 0xa7, 0x04, 0x1c, 0x41, 0x01, 0x45, 0xfc, 0x43, 0x8d,
+  0x83, 0x85, 0x8b, 0x1c, 0xa2, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0,
+  0x00, 0x1b, 0x85, 0xa7, 0x04, 0x19, 0xe2, 0x01, 0x45, 0x82, 0x80, 0x18,
+  0x41, 0x7c, 0x43, 0x85, 0x8b, 0xf5, 0xfb, 0x85, 0x05, 0x83, 0xc7, 0xf5,
+  0xff, 0x7d, 0x16, 0x21, 0x9e, 0x5c, 0xc3, 0xdd, 0xb7, 0x1f, 0x07, 0x9c,
+  0x68, 0xa0, 0x00, 0x81, 0x47, 0x1b, 0x05, 0xa7, 0x04, 0x63, 0xc4, 0xc7,
+  0x00, 0x3e, 0x85, 0x82, 0x80, 0x14, 0x41, 0xf8, 0x42, 0x21, 0x8b, 0x7d,
+  0xfb, 0xd4, 0x42, 0x33, 0x87, 0xf5, 0x00, 0x85, 0x07, 0x14, 0xa3, 0xdd,
+  0xb7, 0x9f, 0x07, 0x40, 0x6f, 0xa2, 0x00, 0x9b, 0x87, 0xb7, 0x04, 0x03,
+  0xa3, 0x07, 0x00, 0x63, 0x03, 0x03, 0x00, 0x02, 0x83, 0x1f, 0x05, 0x47,
+  0x10, 0x00, 0x80, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x9b,
+  0x87, 0xa7, 0x04, 0x98, 0x43, 0x93, 0xf6, 0x35, 0x00, 0x5c, 0x53, 0xcd,
+  0x9b, 0x9b, 0xa7, 0xd7, 0x04, 0xf1, 0x9b, 0x93, 0x76, 0x36, 0x00, 0xd5,
+  0x8f, 0x93, 0xe7, 0x07, 0x01, 0x5c, 0xd3, 0x9f, 0x07, 0xa8, 0x68, 0xa0,
+  0x00, 0xaa, 0x97, 0x8c, 0xa3, 0x9f, 0x07, 0xac, 0x68, 0xa0, 0x00, 0x3e,
+  0x95, 0x10, 0xa1, 0x82, 0x80, 0x3b, 0x63, 0x06, 0x04, 0x37, 0x05, 0x00,
+  0x80, 0x05, 0x05, 0x82, 0x80, 0x18, 0x80, 0x9f, 0x07, 0xa8, 0x68, 0xa0,
+  0x00, 0xaa, 0x97, 0x8c, 0x23, 0x01, 0x9e, 0x6d, 0x37, 0x01, 0x45, 0x14,
+  0x80, 0x3b, 0x63, 0x06, 0x04, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05, 0x82,
+  0x80, 0x18, 0x80, 0x9f, 0x07, 0xac, 0x68, 0xa0, 0x00, 0xaa, 0x97, 0xb2,
+  0x85, 0x90, 0x23, 0x81, 0x9d, 0x61, 0x37, 0x01, 0x45, 0x14, 0x80, 0xa9,
+  0xc1, 0x48, 0x80, 0x92, 0x05, 0x33, 0x74, 0xb6, 0x02, 0x2a, 0x89, 0xb3,
+  0x54, 0xb6, 0x02, 0x1a, 0x04, 0x33, 0x54, 0xb4, 0x02, 0x85, 0x45, 0x51,
+  0x35, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x9b, 0x87, 0x27, 0x05, 0x9c,
+  0x43, 0x13, 0xf7, 0xf4, 0x0f, 0xa1, 0x9c, 0x98, 0xcb, 0xa1, 0x80, 0xc4,
+  0xc7, 0x81, 0x45, 0x4a, 0x85, 0x13, 0x74, 0xf4, 0x03, 0xc0, 0xcb, 0x40,
+  0x80, 0x6f, 0xf0, 0xff, 0xe5, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0,
+  0x00, 0x1b, 0x85, 0xa7, 0x04, 0x18, 0x41, 0x8d, 0x89, 0x1c, 0x47, 0xcd,
+  0x9b, 0x9b, 0xa7, 0xb7, 0x04, 0x1c, 0xc7, 0x82, 0x80, 0x9f, 0x07, 0x9c,
+  0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7, 0x04, 0x18, 0x41, 0x85, 0x89, 0x1c,
+  0x47, 0x93, 0xf7, 0xf7, 0xf7, 0x9b, 0xa7, 0xb7, 0x0e, 0x1c, 0xc7, 0x82,
+  0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7, 0x04, 0x18,
+  0x41, 0x85, 0x89, 0x5c, 0x57, 0xe9, 0x9b, 0xcd, 0x8f, 0x9b, 0xa5, 0xb7,
+  0x04, 0x4c, 0xd7, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b,
+  0x85, 0xa7, 0x04, 0x14, 0x41, 0x9c, 0x4e, 0x3b, 0xf7, 0x05, 0x0e, 0x37,
+  0x77, 0xa2, 0x00, 0x13, 0x07, 0x47, 0xf0, 0x9b, 0x05, 0xb7, 0x04, 0x98,
+  0x41, 0x02, 0x87, 0x05, 0x8a, 0xdd, 0x9b, 0x9b, 0xa7, 0xc7, 0x06, 0x9c,
+  0xce, 0x82, 0x80, 0x05, 0x8a, 0xed, 0x9b, 0x9b, 0xa7, 0xc7, 0x04, 0xd5,
+  0xbf, 0x05, 0x8a, 0xf9, 0x9b, 0xd1, 0x8f, 0xf5, 0xb7, 0x05, 0x8a, 0xf5,
+  0x9b, 0x9b, 0xa7, 0xc7, 0x02, 0xcd, 0xb7, 0x18, 0x80, 0x33, 0x36, 0xc0,
+  0x00, 0xb5, 0x45, 0x7d, 0x37, 0x01, 0x45, 0x14, 0x80, 0x18, 0x80, 0x33,
+  0x36, 0xc0, 0x00, 0xb1, 0x45, 0x45, 0x37, 0x01, 0x45, 0x14, 0x80, 0x18,
+  0x80, 0x33, 0x36, 0xc0, 0x00, 0x91, 0x45, 0x49, 0x3f, 0x01, 0x45, 0x14,
+  0x80, 0x18, 0x80, 0x33, 0x36, 0xc0, 0x00, 0x89, 0x45, 0x51, 0x37, 0x01,
+  0x45, 0x14, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7,
+  0x04, 0x18, 0x41, 0x85, 0x89, 0x1c, 0x47, 0x93, 0xf7, 0xf7, 0xfd, 0x9b,
+  0xa7, 0xb7, 0x0a, 0x1c, 0xc7, 0x82, 0x80, 0x9f, 0x07, 0x9c, 0x68, 0xa0,
+  0x00, 0x1b, 0x85, 0xa7, 0x04, 0x18, 0x41, 0x85, 0x89, 0x1c, 0x47, 0xbd,
+  0x9b, 0x9b, 0xa7, 0xb7, 0x08, 0x1c, 0xc7, 0x82, 0x80, 0x28, 0x80, 0x2a,
+  0x84, 0x3b, 0x87, 0x05, 0x01, 0x81, 0xc5, 0xbb, 0x82, 0x05, 0x02, 0x24,
+  0x80, 0x20, 0x80, 0x65, 0xbf, 0x7c, 0xff, 0x02, 0x0f, 0xf0, 0x85, 0x45,
+  0x55, 0x3f, 0x85, 0x45, 0x22, 0x85, 0x20, 0x80, 0xe1, 0xb7, 0x6d, 0x37,
+  0x81, 0x45, 0xdd, 0xbf, 0x38, 0x81, 0x4c, 0x22, 0xb2, 0x84, 0x2a, 0x84,
+  0xe1, 0x35, 0xcc, 0x30, 0x22, 0x85, 0xf1, 0x3d, 0xec, 0x20, 0x22, 0x85,
+  0xd9, 0x37, 0x8c, 0x40, 0x22, 0x85, 0x2e, 0xc6, 0xef, 0x00, 0x80, 0x7d,
+  0xb2, 0x45, 0x2a, 0x86, 0x22, 0x85, 0xef, 0xf0, 0x7f, 0xe6, 0x01, 0x45,
+  0x34, 0x81, 0x9f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x1b, 0x85, 0xa7, 0x04,
+  0x18, 0x41, 0x85, 0x89, 0x3c, 0x4b, 0xf9, 0x9b, 0xcd, 0x8f, 0x3c, 0xcb,
+  0x82, 0x80, 0x68, 0x81, 0xb6, 0x84, 0x13, 0x19, 0x25, 0x00, 0x9f, 0x06,
+  0x94, 0x6f, 0xa2, 0x00, 0x2e, 0x8a, 0xb3, 0x85, 0x26, 0x01, 0x8c, 0x41,
+  0x94, 0x42, 0xba, 0x89, 0x1f, 0x07, 0x9c, 0x68, 0xa0, 0x00, 0x33, 0x06,
+  0x27, 0x01, 0x0c, 0xc2, 0x14, 0xc3, 0xcc, 0x20, 0x1f, 0x07, 0x98, 0x68,
+  0xa0, 0x00, 0x2a, 0x97, 0x3e, 0xc6, 0x23, 0x00, 0x07, 0x00, 0x2a, 0x84,
+  0xef, 0xf0, 0x1f, 0xe5, 0xcc, 0x30, 0x22, 0x85, 0xef, 0xf0, 0x3f, 0xe6,
+  0xec, 0x20, 0x22, 0x85, 0xa9, 0x37, 0x81, 0x45, 0x22, 0x85, 0x61, 0x3f,
+  0x8c, 0x40, 0x22, 0x85, 0x2e, 0xc4, 0xef, 0x00, 0x60, 0x75, 0xa2, 0x45,
+  0x2a, 0x86, 0x22, 0x85, 0xef, 0xf0, 0x5f, 0xde, 0x29, 0x45, 0xef, 0xe0,
+  0x3f, 0xb3, 0xb2, 0x47, 0x8d, 0xc7, 0x90, 0x33, 0xac, 0x33, 0x22, 0x85,
+  0xef, 0xf0, 0x3f, 0xd5, 0x9f, 0x07, 0x8c, 0x68, 0xa0, 0x00, 0xca, 0x97,
+  0x23, 0xa0, 0x47, 0x01, 0x85, 0x45, 0xbb, 0x81, 0x09, 0x03, 0x81, 0x45,
+  0x22, 0x85, 0xef, 0xf0, 0x1f, 0xe3, 0x01, 0x45, 0x64, 0x81, 0x05, 0x46,
+  0x85, 0x45, 0xe1, 0xbf, 0x1f, 0x05, 0x30, 0x24, 0xa0, 0x00, 0x82, 0x80,
+  0x19, 0xc5, 0x9f, 0x07, 0xb0, 0x68, 0xa0, 0x00, 0x88, 0xc3, 0x01, 0x45,
+  0x82, 0x80, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05, 0x82, 0x80, 0x9f, 0x07,
+  0xb0, 0x68, 0xa0, 0x00, 0x23, 0xa0, 0x07, 0x00, 0x01, 0x45, 0x82, 0x80,
+  0x9f, 0x07, 0xb0, 0x68, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0xb7, 0x27,
+  0xa0, 0x00, 0x83, 0xa7, 0x87, 0x47, 0x99, 0xc7, 0x1f, 0x07, 0xb4, 0x68,
+  0xa0, 0x00, 0x1c, 0xc3, 0x01, 0x45, 0x82, 0x80, 0x1f, 0x05, 0x00, 0x12,
+  0x00, 0x80, 0x82, 0x80, 0x9f, 0x07, 0xb4, 0x68, 0xa0, 0x00, 0x23, 0xa0,
+  0x07, 0x00, 0x82, 0x80, 0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa7, 0x47, 0x8b,
+  0x1f, 0x07, 0x5a, 0x5a, 0x5a, 0x5a, 0x98, 0xc7, 0x82, 0x80, 0x9f, 0x07,
+  0xbc, 0x68, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0x9f, 0x07, 0xb8, 0x68,
+  0xa0, 0x00, 0x88, 0xc3, 0x82, 0x80, 0xf9, 0xb7, 0x7d, 0xb7, 0x38, 0x80,
+  0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa6, 0x47, 0x8b, 0x93, 0x04, 0x10, 0x7d,
+  0x3e, 0x84, 0x98, 0x56, 0x13, 0x67, 0x17, 0x00, 0x98, 0xd6, 0x03, 0x27,
+  0x44, 0x8b, 0x1c, 0x57, 0x85, 0x83, 0x85, 0x8b, 0x99, 0xcf, 0x40, 0x4b,
+  0xef, 0x00, 0x60, 0x71, 0x93, 0x07, 0x80, 0x3e, 0x2a, 0x86, 0xb3, 0x35,
+  0xf4, 0x02, 0x81, 0x46, 0x33, 0x05, 0xf4, 0x02, 0xef, 0xc0, 0x3f, 0xc8,
+  0x34, 0x80, 0xfd, 0x14, 0x89, 0xc4, 0x05, 0x45, 0xef, 0xe0, 0xdf, 0xa2,
+  0xf9, 0xb7, 0x01, 0x45, 0xc5, 0xbf, 0xb7, 0x77, 0xa0, 0x00, 0x03, 0xa7,
+  0x47, 0x8b, 0x5c, 0x47, 0x93, 0xe7, 0x17, 0x00, 0x5c, 0xc7, 0x82, 0x80,
+  0x18, 0x80, 0xf5, 0x37, 0xb7, 0x77, 0xa0, 0x00, 0x03, 0xa7, 0x47, 0x8b,
+  0x1c, 0x4b, 0xf9, 0x9b, 0x1c, 0xcb, 0x14, 0x80, 0x48, 0x80, 0xaa, 0x84,
+  0xef, 0x00, 0x20, 0x6c, 0x89, 0xe4, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05,
+  0x44, 0x80, 0x33, 0x04, 0x95, 0x02, 0x33, 0x59, 0x94, 0x02, 0xef, 0x00,
+  0xc0, 0x6a, 0xe3, 0x16, 0xa9, 0xfe, 0x3b, 0x6a, 0xf4, 0xff, 0x9f, 0x07,
+  0xbc, 0x68, 0xa0, 0x00, 0x37, 0x79, 0xa0, 0x00, 0x84, 0xc3, 0x83, 0x27,
+  0x49, 0x8b, 0x9f, 0x04, 0x5a, 0x5a, 0x5a, 0x5a, 0x13, 0x74, 0x04, 0xf0,
+  0x84, 0xc3, 0x6d, 0x37, 0x83, 0x27, 0x49, 0x8b, 0x98, 0x4b, 0x13, 0x67,
+  0x47, 0x00, 0x98, 0xcb, 0x98, 0x4b, 0x13, 0x77, 0xf7, 0xfb, 0x98, 0xcb,
+  0x98, 0x4b, 0x13, 0x67, 0x87, 0x03, 0x98, 0xcb, 0xc8, 0x43, 0x13, 0x75,
+  0xf5, 0x0f, 0x49, 0x8c, 0xc0, 0xc3, 0x84, 0xc7, 0x01, 0x45, 0x4d, 0xb7,
+  0x28, 0x81, 0x2a, 0xc6, 0xa5, 0x3f, 0x32, 0x45, 0x37, 0x74, 0xa0, 0x00,
+  0x0d, 0xe1, 0x03, 0x27, 0x44, 0x8b, 0x1c, 0x4b, 0x93, 0xf7, 0xf7, 0xf7,
+  0x1c, 0xcb, 0x81, 0x3f, 0x03, 0x27, 0x44, 0x8b, 0x1c, 0x4b, 0x93, 0xe7,
+  0x17, 0x00, 0x1c, 0xcb, 0x20, 0x81, 0x6f, 0xf0, 0x7f, 0xec, 0x3b, 0x1b,
+  0xf5, 0x01, 0x03, 0x27, 0x44, 0x8b, 0x1c, 0x4b, 0x93, 0xe7, 0x07, 0x08,
+  0xf1, 0xbf, 0x1f, 0x05, 0x48, 0x24, 0xa0, 0x00, 0x82, 0x80, 0x58, 0x80,
+  0x2d, 0x2d, 0x9f, 0x09, 0xd0, 0x68, 0xa0, 0x00, 0x23, 0xa0, 0xa9, 0x00,
+  0x1f, 0x09, 0xc4, 0x68, 0xa0, 0x00, 0x05, 0x2d, 0x23, 0x20, 0xa9, 0x00,
+  0x9f, 0x04, 0xc0, 0x68, 0xa0, 0x00, 0x35, 0x25, 0x88, 0xc0, 0x1f, 0x04,
+  0xcc, 0x68, 0xa0, 0x00, 0x2d, 0x25, 0x08, 0xc0, 0x3d, 0x25, 0x9f, 0x07,
+  0xc8, 0x68, 0xa0, 0x00, 0x88, 0xc3, 0x83, 0xa7, 0x09, 0x00, 0x99, 0xcb,
+  0x83, 0x27, 0x09, 0x00, 0x81, 0xcb, 0x9c, 0x40, 0x91, 0xc7, 0x1c, 0x40,
+  0x81, 0xc7, 0x19, 0xc1, 0x01, 0x45, 0x54, 0x80, 0x1f, 0x05, 0x43, 0x13,
+  0x00, 0x80, 0xe5, 0xbf, 0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa6, 0xc7, 0x8c,
+  0x1f, 0x07, 0xff, 0xff, 0xff, 0x3f, 0x79, 0x8d, 0xdc, 0x46, 0x37, 0x07,
+  0x00, 0xc0, 0xf9, 0x8f, 0xc9, 0x8f, 0xdc, 0xc6, 0x82, 0x80, 0x58, 0x81,
+  0xd5, 0x2b, 0xaa, 0x84, 0xdd, 0x23, 0x92, 0x47, 0x1f, 0x07, 0xff, 0xc7,
+  0xff, 0xff, 0x2a, 0x89, 0x93, 0xf7, 0x77, 0x80, 0x93, 0xe7, 0x87, 0x02,
+  0xf9, 0x8f, 0x3e, 0xc2, 0x85, 0x47, 0x3e, 0xc4, 0x02, 0xc6, 0x01, 0x44,
+  0xb7, 0x79, 0xa0, 0x00, 0x48, 0x00, 0xad, 0x26, 0x01, 0x46, 0x85, 0x45,
+  0x05, 0x45, 0x69, 0x2e, 0xd9, 0x26, 0x83, 0xa7, 0x89, 0x8c, 0x9c, 0x43,
+  0x85, 0x8b, 0x91, 0xcf, 0x4a, 0x85, 0xef, 0xe0, 0xbf, 0x88, 0x93, 0x07,
+  0x14, 0x00, 0x63, 0x66, 0x94, 0x00, 0x1f, 0x05, 0x44, 0x13, 0x00, 0x80,
+  0x54, 0x81, 0x3e, 0x84, 0xc1, 0xbf, 0x01, 0x45, 0xe5, 0xbf, 0x48, 0x81,
+  0x9c, 0x21, 0x2a, 0x84, 0x2e, 0x89, 0x8e, 0x07, 0x93, 0xe7, 0x17, 0x00,
+  0x3e, 0xc2, 0x93, 0x07, 0xf5, 0xff, 0x3e, 0xc4, 0x02, 0xc6, 0x61, 0x37,
+  0xaa, 0x84, 0x0d, 0xe5, 0x48, 0x00, 0x19, 0x2e, 0x85, 0x47, 0x02, 0xc0,
+  0x63, 0xe2, 0x87, 0x02, 0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa7, 0x87, 0x8c,
+  0x02, 0x47, 0x93, 0x35, 0x24, 0x00, 0x01, 0x46, 0x98, 0xc3, 0x93, 0xc5,
+  0x15, 0x00, 0x01, 0x45, 0x35, 0x26, 0xa1, 0x2e, 0x26, 0x85, 0x44, 0x81,
+  0xb3, 0x06, 0xf9, 0x00, 0x94, 0x22, 0x33, 0x07, 0xf1, 0x00, 0x85, 0x07,
+  0xa3, 0x0f, 0xd7, 0xfe, 0xf1, 0xb7, 0x18, 0x81, 0xef, 0xf0, 0x3f, 0xf4,
+  0x99, 0x47, 0x6c, 0x00, 0x05, 0x45, 0x23, 0x06, 0xf1, 0x00, 0x51, 0x3f,
+  0x19, 0xe1, 0xef, 0xf0, 0x1f, 0xf3, 0x14, 0x81, 0x48, 0x86, 0x36, 0xc6,
+  0x2a, 0x89, 0x4b, 0x81, 0x02, 0x10, 0xef, 0xae, 0x84, 0x32, 0x84, 0xf1,
+  0x3f, 0xaa, 0x87, 0xb2, 0x46, 0x39, 0xe9, 0x36, 0xca, 0x48, 0x08, 0xb9,
+  0x82, 0x36, 0xce, 0x22, 0xcc, 0x55, 0x24, 0x4a, 0x85, 0xef, 0xf0, 0xdf,
+  0xee, 0xa2, 0x86, 0x26, 0x86, 0x93, 0x05, 0x00, 0x04, 0x08, 0x10, 0xef,
+  0x10, 0xb0, 0x15, 0xfd, 0x57, 0x0d, 0xe9, 0x13, 0x76, 0x34, 0x00, 0x33,
+  0x36, 0xc0, 0x00, 0x1b, 0x06, 0x86, 0x44, 0x21, 0x9e, 0x1c, 0x10, 0x01,
+  0x47, 0xb7, 0x75, 0xa0, 0x00, 0x93, 0x16, 0x07, 0x01, 0xc1, 0x82, 0x63,
+  0xec, 0xc6, 0x00, 0x05, 0x46, 0x85, 0x45, 0x01, 0x45, 0x71, 0x2c, 0xe1,
+  0x24, 0xef, 0xf0, 0xbf, 0xec, 0xaa, 0x87, 0x3e, 0x85, 0x44, 0x86, 0x83,
+  0xa6, 0x85, 0x8c, 0x88, 0x43, 0x91, 0x07, 0x9b, 0x86, 0xe6, 0x04, 0x88,
+  0xc2, 0x05, 0x07, 0xc9, 0xbf, 0x28, 0x81, 0x2a, 0x84, 0xef, 0xf0, 0x3f,
+  0xe3, 0xef, 0xf0, 0x7f, 0xea, 0x1d, 0xe9, 0x31, 0x46, 0x9f, 0x05, 0x4c,
+  0x5f, 0xa2, 0x00, 0x48, 0x00, 0xef, 0xc0, 0x5f, 0xe6, 0x48, 0x00, 0x1d,
+  0x24, 0x01, 0x46, 0x85, 0x45, 0x05, 0x45, 0x99, 0x2c, 0x49, 0x24, 0xb7,
+  0x77, 0xa0, 0x00, 0x83, 0xa7, 0x87, 0x8c, 0x1f, 0x07, 0xff, 0xff, 0xff,
+  0x00, 0x9c, 0x43, 0xf9, 0x8f, 0x1c, 0xc0, 0xef, 0xf0, 0x1f, 0xe7, 0x24,
+  0x81, 0xc1, 0x67, 0x63, 0x6c, 0xf6, 0x0c, 0x98, 0x81, 0x40, 0x49, 0xb2,
+  0x84, 0xae, 0x89, 0x2a, 0x89, 0x05, 0x4a, 0xb7, 0x7a, 0xa0, 0x00, 0x25,
+  0xe0, 0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa6, 0x47, 0x8c, 0x93, 0xd9, 0x09,
+  0x01, 0x13, 0xd6, 0xf4, 0x00, 0x9c, 0x4e, 0x01, 0x47, 0x93, 0x95, 0x07,
+  0x01, 0xc1, 0x81, 0x9b, 0xa5, 0x35, 0x21, 0x8c, 0xce, 0x93, 0x77, 0x16,
+  0x00, 0xc1, 0xcf, 0x9c, 0x4a, 0x1f, 0x06, 0xff, 0xf0, 0xff, 0xff, 0x3d,
+  0x8b, 0xf1, 0x8f, 0x9b, 0xa7, 0xe7, 0x10, 0x9c, 0xca, 0x03, 0x25, 0x49,
+  0x00, 0x0d, 0x24, 0x03, 0x25, 0xc9, 0x00, 0x93, 0x77, 0x85, 0x7f, 0x91,
+  0xc3, 0x89, 0x2c, 0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa7, 0x07, 0x8d, 0x05,
+  0x47, 0x98, 0xcb, 0xef, 0xf0, 0xdf, 0xdf, 0x01, 0x45, 0x0d, 0xa0, 0x1c,
+  0x20, 0x63, 0x80, 0x47, 0x03, 0x99, 0xc7, 0xbb, 0x86, 0xe7, 0x02, 0x1f,
+  0x05, 0x45, 0x13, 0x00, 0x80, 0x39, 0xa0, 0x08, 0x30, 0x93, 0x05, 0x24,
+  0x00, 0xef, 0xf0, 0xbf, 0xe3, 0x15, 0xcd, 0x94, 0x81, 0x38, 0x20, 0x83,
+  0x4b, 0x34, 0x00, 0x03, 0x4b, 0x44, 0x00, 0x0e, 0x07, 0x13, 0x67, 0x17,
+  0x00, 0x3a, 0xc2, 0x52, 0xc4, 0x02, 0xc6, 0xef, 0xf0, 0xdf, 0xdb, 0x48,
+  0x00, 0xb1, 0x22, 0x01, 0x46, 0x85, 0x45, 0x05, 0x45, 0xb5, 0x2a, 0x65,
+  0x22, 0x83, 0xa7, 0x8a, 0x8c, 0x9c, 0x43, 0xb3, 0xd7, 0x77, 0x01, 0x85,
+  0x8b, 0xe3, 0x9b, 0x67, 0xfb, 0x19, 0x04, 0x91, 0xb7, 0x05, 0x82, 0x05,
+  0x07, 0x85, 0xb7, 0x37, 0x05, 0x00, 0x80, 0x05, 0x05, 0x82, 0x80, 0x88,
+  0x85, 0xaa, 0x89, 0x2e, 0x8a, 0xb2, 0x84, 0x13, 0x04, 0x00, 0x04, 0x93,
+  0xda, 0xe6, 0x00, 0x36, 0x89, 0x37, 0x7b, 0xa0, 0x00, 0x99, 0xe0, 0x01,
+  0x45, 0xa1, 0xa8, 0xef, 0xf0, 0xdf, 0xd6, 0x29, 0xe9, 0x63, 0xf3, 0x84,
+  0x00, 0x26, 0x84, 0x48, 0x00, 0x4a, 0xc2, 0x22, 0xc4, 0x56, 0xc6, 0xfd,
+  0x20, 0x4e, 0x85, 0xef, 0xf0, 0x7f, 0xd3, 0x05, 0x46, 0x05, 0x45, 0x85,
+  0x45, 0x21, 0x2a, 0x91, 0x22, 0x93, 0x77, 0x34, 0x00, 0xb3, 0x37, 0xf0,
+  0x00, 0x03, 0x25, 0x8b, 0x8c, 0x9b, 0x87, 0x87, 0x44, 0x14, 0x08, 0xa1,
+  0x9f, 0x01, 0x47, 0x36, 0x86, 0x93, 0x15, 0x07, 0x01, 0xc1, 0x81, 0x63,
+  0xea, 0xf5, 0x00, 0xa2, 0x86, 0xa2, 0x85, 0x52, 0x85, 0xef, 0x10, 0xc0,
+  0x77, 0x19, 0xc9, 0x7d, 0x55, 0x84, 0x85, 0x9b, 0x05, 0xe5, 0x04, 0x8c,
+  0x41, 0x05, 0x07, 0x91, 0x06, 0x23, 0xae, 0xb6, 0xfe, 0xe1, 0xbf, 0xa2,
+  0x99, 0x22, 0x9a, 0x81, 0x8c, 0x71, 0xb7, 0x88, 0x80, 0x93, 0x77, 0xf5,
+  0x03, 0x13, 0x04, 0x00, 0x04, 0x1d, 0x8c, 0xaa, 0x89, 0x2e, 0x89, 0xb2,
+  0x84, 0xb6, 0x8a, 0x63, 0x73, 0x86, 0x00, 0x32, 0x84, 0xd6, 0x86, 0x22,
+  0x86, 0xca, 0x85, 0x4e, 0x85, 0xef, 0xf0, 0x1f, 0xdb, 0x2a, 0x8a, 0x05,
+  0xe9, 0x81, 0x8c, 0x95, 0xc4, 0x22, 0x99, 0x13, 0x0b, 0x00, 0x04, 0x4e,
+  0x94, 0xa6, 0x89, 0x63, 0x74, 0x9b, 0x00, 0x93, 0x09, 0x00, 0x04, 0xd6,
+  0x86, 0x4e, 0x86, 0xca, 0x85, 0x22, 0x85, 0xef, 0xf0, 0xbf, 0xd8, 0x01,
+  0xe9, 0xb3, 0x84, 0x34, 0x41, 0x4e, 0x99, 0x4e, 0x94, 0xe5, 0xf0, 0x52,
+  0x85, 0x84, 0x80, 0x2a, 0x8a, 0xed, 0xbf, 0x38, 0x82, 0x2e, 0xc6, 0xaa,
+  0x84, 0x32, 0x84, 0xef, 0xf0, 0x1f, 0xd5, 0xb2, 0x45, 0x0d, 0xe1, 0x48,
+  0x08, 0x2e, 0xca, 0x02, 0xcc, 0x02, 0xce, 0x29, 0x28, 0x26, 0x85, 0xef,
+  0xf0, 0x3f, 0xc6, 0x13, 0x46, 0x14, 0x00, 0x81, 0x45, 0x01, 0x45, 0x89,
+  0x20, 0xbd, 0x20, 0xef, 0xf0, 0x1f, 0xc7, 0x34, 0x82, 0xb7, 0x77, 0xa0,
+  0x00, 0x03, 0xa6, 0xc7, 0x8c, 0x1c, 0x41, 0x0c, 0x45, 0x18, 0x46, 0x93,
+  0xd6, 0x37, 0x00, 0x81, 0x9e, 0x13, 0x77, 0x07, 0xf0, 0x55, 0x8f, 0x54,
+  0x41, 0xad, 0x83, 0x9d, 0x8b, 0x9d, 0x89, 0xc6, 0x07, 0xfd, 0x16, 0x93,
+  0xf6, 0xf6, 0x03, 0x9b, 0xa7, 0xb7, 0x08, 0x9b, 0xa7, 0xd7, 0x12, 0x18,
+  0xc6, 0x1c, 0xc2, 0x82, 0x80, 0xb7, 0x77, 0xa0, 0x00, 0x03, 0xa7, 0xc7,
+  0x8c, 0x05, 0x89, 0x85, 0x89, 0x1c, 0x43, 0x05, 0x8a, 0x93, 0xf7, 0xf7,
+  0xef, 0x9b, 0xa7, 0xa7, 0x10, 0x93, 0xf7, 0xf7, 0xf7, 0x9b, 0xa7, 0xb7,
+  0x0e, 0xdd, 0x9b, 0x9b, 0xa7, 0xc7, 0x06, 0x93, 0xe7, 0x37, 0x00, 0x1c,
+  0xc3, 0x82, 0x80, 0xb7, 0x77, 0xa0, 0x00, 0x03, 0xa7, 0xc7, 0x8c, 0x1c,
+  0x43, 0x85, 0x8b, 0xf5, 0xff, 0x82, 0x80, 0xb7, 0x77, 0xa0, 0x00, 0x03,
+  0xa6, 0x47, 0x8c, 0x37, 0x07, 0x00, 0x80, 0x9f, 0x06, 0xff, 0x00, 0xff,
+  0xff, 0x1c, 0x42, 0xd9, 0x8f, 0x13, 0x57, 0x35, 0x00, 0x01, 0x9f, 0xf5,
+  0x8f, 0x9b, 0xa7, 0xe7, 0x10, 0x93, 0x56, 0xb5, 0x00, 0x9d, 0x8a, 0x2d,
+  0x81, 0x93, 0xf7, 0x07, 0xfc, 0x13, 0x77, 0x85, 0x03, 0x33, 0xe5, 0xd7,
+  0x00, 0x59, 0x8d, 0x08, 0xc2, 0x82, 0x80, 0xb7, 0x77, 0xa0, 0x00, 0x83,
+  0xa6, 0x47, 0x8c, 0x13, 0x57, 0x35, 0x00, 0x1f, 0x06, 0xff, 0xff, 0x3f,
+  0xc0, 0x9c, 0x42, 0x01, 0x9f, 0x2d, 0x81, 0xf1, 0x8f, 0x9b, 0xa7, 0xe7,
+  0x2c, 0x1f, 0x07, 0xff, 0xff, 0xf8, 0xff, 0xf9, 0x8f, 0x1d, 0x89, 0x9b,
+  0xa7, 0xa7, 0x20, 0x37, 0x07, 0x00, 0x40, 0xd9, 0x8f, 0x9c, 0xc2, 0x82,
+  0x80, 0x38, 0x80, 0x37, 0x74, 0xa0, 0x00, 0x2e, 0x87, 0xaa, 0x86, 0x13,
+  0x06, 0xf0, 0x07, 0x93, 0x05, 0x00, 0x08, 0x13, 0x05, 0x84, 0x8d, 0xef,
+  0x10, 0x50, 0x74, 0x2a, 0x86, 0x93, 0x07, 0x84, 0x8d, 0x3b, 0x13, 0x05,
+  0xff, 0x93, 0x04, 0x84, 0x8d, 0x98, 0x20, 0x11, 0xcf, 0xb2, 0x97, 0x23,
+  0x80, 0x07, 0x00, 0x9f, 0x07, 0xd4, 0x68, 0xa0, 0x00, 0x88, 0x23, 0x81,
+  0x46, 0x93, 0x05, 0x84, 0x8d, 0x30, 0x80, 0x6f, 0xe0, 0x5f, 0x85, 0x34,
+  0x80, 0x28, 0x80, 0x2a, 0x84, 0xef, 0xf0, 0x9f, 0x90, 0xaa, 0x85, 0x22,
+  0x85, 0x20, 0x80, 0x6f, 0xf0, 0xef, 0xc4, 0x9f, 0x07, 0x6c, 0x24, 0xf2,
+  0x6f, 0x02, 0x11, 0xee, 0xa0, 0x00, 0x8c, 0xc3, 0x82, 0x80, 0x9f, 0x07,
+  0x6c, 0x24, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0xbb, 0x13, 0x05, 0x02,
+  0xb7, 0xd7, 0x00, 0x44, 0x05, 0x47, 0x98, 0xdb, 0xd8, 0xdb, 0x82, 0x80,
+  0x82, 0x80, 0x82, 0x80, 0x39, 0x71, 0x06, 0xce, 0x22, 0xcc, 0x2e, 0xd2,
+  0x32, 0xd4, 0x36, 0xd6, 0x3a, 0xd8, 0x3e, 0xda, 0x42, 0xdc, 0x46, 0xde,
+  0x11, 0xc9, 0x2a, 0x84, 0xef, 0xc0, 0x1f, 0xd7, 0x11, 0xc5, 0x4c, 0x10,
+  0x22, 0x85, 0x2e, 0xc6, 0xef, 0xf0, 0xbf, 0xf5, 0xf2, 0x40, 0x62, 0x44,
+  0x21, 0x61, 0x82, 0x80, 0x6f, 0xe0, 0x6f, 0x84, 0x2e, 0x85, 0x6f, 0xe0,
+  0x8f, 0x84, 0xb7, 0x57, 0x00, 0x40, 0xd8, 0x4f, 0x98, 0x4f, 0xc8, 0x4f,
+  0x8c, 0x4f, 0xa1, 0x9d, 0x82, 0x80, 0x9f, 0x07, 0x70, 0x24, 0xa0, 0x00,
+  0x88, 0x43, 0x82, 0x80, 0x1f, 0x05, 0xc0, 0x04, 0x00, 0x44, 0x82, 0x80,
+  0x9f, 0x07, 0x74, 0x24, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0x9f, 0x07,
+  0x74, 0x24, 0xa0, 0x00, 0x88, 0xc3, 0x82, 0x80, 0x18, 0x80, 0xef, 0xf0,
+  0xff, 0xa0, 0x10, 0x80, 0x6f, 0xf0, 0x3f, 0x86, 0x6f, 0xf0, 0x5f, 0x87,
+  0x82, 0x80, 0x28, 0x80, 0x2a, 0x84, 0xef, 0xd0, 0x1f, 0xff, 0x9f, 0x07,
+  0x7c, 0x24, 0xa0, 0x00, 0x80, 0xc3, 0x20, 0x80, 0x6f, 0xd0, 0xbf, 0xfe,
+  0x9f, 0x07, 0x7c, 0x24, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0x1f, 0x05,
+  0x14, 0x70, 0xa2, 0x00, 0x82, 0x80, 0x05, 0x45, 0x82, 0x80, 0x1f, 0x05,
+  0x30, 0x70, 0xa2, 0x00, 0x82, 0x80, 0x37, 0x05, 0x20, 0x00, 0x82, 0x80,
+  0x1f, 0x05, 0xff, 0xff, 0x9f, 0x00, 0x82, 0x80, 0x1f, 0x05, 0x00, 0x01,
+  0x00, 0x48, 0x82, 0x80, 0x1f, 0x05, 0x00, 0x02, 0x00, 0x48, 0x82, 0x80,
+  0x1f, 0x05, 0x40, 0x02, 0x00, 0x48, 0x82, 0x80, 0x1f, 0x05, 0x00, 0x03,
+  0x00, 0x48, 0x82, 0x80, 0x1f, 0x05, 0x00, 0x04, 0x00, 0x48, 0x82, 0x80,
+  0x9f, 0x07, 0x80, 0x24, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0x9f, 0x07,
+  0x84, 0x24, 0xa0, 0x00, 0x88, 0x43, 0x82, 0x80, 0x82, 0x80, 0x01, 0x45,
+  0x82, 0x80, 0x82, 0x80, 0x58, 0x81, 0xef, 0xf0, 0xdf, 0xfe, 0xaa, 0x84,
+  0xef, 0xf0, 0xdf, 0xfd, 0x93, 0x07, 0x80, 0x02, 0x3e, 0xc2, 0x85, 0x47,
+  0x2a, 0x89, 0x02, 0xc6, 0x3e, 0xc4, 0x01, 0x44, 0xb7, 0x79, 0xa0, 0x00,
+  0x48, 0x00, 0xef, 0xf0, 0xdf, 0xd6, 0x01, 0x46, 0x85, 0x45, 0x05, 0x45,
+  0xef, 0xf0, 0xbf, 0xd9, 0xef, 0xf0, 0x5f, 0xdc, 0x83, 0xa7, 0x89, 0x8c,
+  0x9c, 0x43, 0x85, 0x8b, 0x91, 0xcf, 0x4a, 0x85, 0xef, 0xe0, 0x6f, 0xa8,
+  0x93, 0x07, 0x14, 0x00, 0x63, 0x66, 0x94, 0x00, 0x1f, 0x05, 0x44, 0x13,
+  0x00, 0x80, 0x54, 0x81, 0x3e, 0x84, 0xe9, 0xb7, 0x01, 0x45, 0xe5, 0xbf,
+  0x48, 0x81, 0x2a, 0x89, 0x2e, 0x84, 0xb2, 0x84, 0xef, 0xf0, 0xdf, 0xf9,
+  0x92, 0x47, 0x19, 0x47, 0xe1, 0x9b, 0x93, 0xe7, 0x17, 0x00, 0x3e, 0xc2,
+  0x63, 0x04, 0x09, 0x00, 0x13, 0x07, 0x00, 0x05, 0x92, 0x47, 0x48, 0x00,
+  0x02, 0xc4, 0x93, 0xf7, 0x77, 0x80, 0x9b, 0xa7, 0xe7, 0x06, 0x93, 0xf7,
+  0xf7, 0x7f, 0x3e, 0xc2, 0x02, 0xc6, 0xef, 0xf0, 0xdf, 0xcf, 0x01, 0x46,
+  0x81, 0x45, 0x01, 0x45, 0xef, 0xf0, 0xbf, 0xd2, 0xef, 0xf0, 0x5f, 0xd5,
+  0x85, 0x47, 0x3e, 0xc4, 0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa7, 0x87, 0x8c,
+  0x0e, 0x04, 0x13, 0x64, 0x14, 0x00, 0x22, 0xc2, 0x02, 0xc6, 0x84, 0xc3,
+  0x48, 0x00, 0xef, 0xf0, 0x1f, 0xcd, 0x01, 0x46, 0x85, 0x45, 0x01, 0x45,
+  0xef, 0xf0, 0xff, 0xcf, 0xef, 0xf0, 0x9f, 0xd2, 0x44, 0x81, 0x18, 0x81,
+  0x01, 0x9d, 0x85, 0x47, 0x0e, 0x05, 0x3e, 0xc4, 0x02, 0xc6, 0x2a, 0xc2,
+  0xef, 0xf0, 0x1f, 0xf2, 0x48, 0x00, 0xef, 0xf0, 0x9f, 0xca, 0x01, 0x46,
+  0x85, 0x45, 0x05, 0x45, 0xef, 0xf0, 0x7f, 0xcd, 0xef, 0xf0, 0x1f, 0xd0,
+  0xb7, 0x77, 0xa0, 0x00, 0x83, 0xa7, 0x87, 0x8c, 0x88, 0x43, 0x14, 0x81,
+  0xb7, 0x07, 0x02, 0x00, 0x63, 0x68, 0xf5, 0x00, 0xb7, 0x07, 0x40, 0x00,
+  0x63, 0xec, 0xb7, 0x00, 0x81, 0x47, 0x05, 0xa0, 0xa1, 0x67, 0x63, 0x69,
+  0xf5, 0x00, 0x37, 0x07, 0x40, 0x00, 0x85, 0x47, 0x63, 0x79, 0xb7, 0x00,
+  0x01, 0x45, 0x82, 0x80, 0xb7, 0x07, 0x40, 0x00, 0xe3, 0xec, 0xb7, 0xfe,
+  0x89, 0x47, 0x18, 0x80, 0x1f, 0x07, 0x4c, 0x70, 0xa2, 0x00, 0xdb, 0x17,
+  0xf7, 0x0c, 0x90, 0x33, 0x85, 0x45, 0x05, 0x45, 0xef, 0xf0, 0x5f, 0xf1,
+  0x09, 0x46, 0x93, 0x05, 0x10, 0x03, 0x05, 0x45, 0xef, 0xf0, 0x9f, 0xf0,
+  0x01, 0x45, 0x14, 0x80, 0x18, 0x80, 0x71, 0x46, 0x85, 0x45, 0x05, 0x45,
+  0xef, 0xf0, 0x9f, 0xef, 0x09, 0x46, 0x93, 0x05, 0x10, 0x03, 0x05, 0x45,
+  0x10, 0x80, 0x6f, 0xf0, 0xbf, 0xee, 0x18, 0x81, 0x68, 0x00, 0x02, 0xc6,
+  0xef, 0xf0, 0xff, 0x9c, 0x01, 0xe9, 0x32, 0x47, 0x9f, 0x07, 0xc8, 0x40,
+  0x16, 0x00, 0x63, 0x14, 0xf7, 0x00, 0x79, 0x20, 0x14, 0x81, 0x37, 0x05,
+  0x00, 0x80, 0x09, 0x05, 0xe5, 0xbf, 0x78, 0x80, 0x2a, 0x89, 0x8d, 0x44,
+  0x95, 0x49, 0x13, 0x0a, 0x50, 0x03, 0xb7, 0x7a, 0xa2, 0x00, 0x4a, 0x85,
+  0xef, 0xf0, 0x7f, 0xf2, 0x13, 0x74, 0xf5, 0x0f, 0x63, 0x1f, 0x39, 0x03,
+  0x13, 0x74, 0xc4, 0x09, 0x11, 0x14, 0x13, 0x34, 0x14, 0x00, 0x85, 0x45,
+  0xf1, 0x46, 0x19, 0xe4, 0x13, 0x76, 0xf5, 0x0f, 0x13, 0x85, 0x8a, 0x09,
+  0xef, 0xf0, 0x9f, 0xd2, 0xef, 0xe0, 0x8f, 0x87, 0x13, 0x06, 0x40, 0x06,
+  0x81, 0x46, 0xef, 0xc0, 0x6f, 0xb3, 0x05, 0x05, 0xef, 0xe0, 0x2f, 0x8e,
+  0x05, 0xc8, 0xfd, 0x14, 0xdd, 0xfc, 0x01, 0x45, 0x74, 0x80, 0x63, 0x1a,
+  0x49, 0x01, 0x13, 0x74, 0x34, 0x04, 0x79, 0x14, 0x13, 0x34, 0x14, 0x00,
+  0x89, 0x45, 0x89, 0x46, 0xc9, 0xb7, 0x13, 0x74, 0x14, 0x06, 0x01, 0x14,
+  0x13, 0x34, 0x14, 0x00, 0x8d, 0x45, 0x93, 0x06, 0x00, 0x02, 0x45, 0xbf,
+  0x7d, 0x55, 0xd9, 0xbf, 0x68, 0x80, 0x81, 0x44, 0x8d, 0x49, 0x15, 0x45,
+  0xef, 0xf0, 0x7f, 0xf7, 0x2a, 0x8a, 0x13, 0x05, 0x50, 0x03, 0xef, 0xf0,
+  0xdf, 0xf6, 0x2a, 0x89, 0x55, 0x45, 0xef, 0xf0, 0x5f, 0xf6, 0x2a, 0x84,
+  0x63, 0x17, 0x0a, 0x04, 0x63, 0x08, 0x09, 0x02, 0x09, 0x46, 0x93, 0x05,
+  0x10, 0x03, 0x01, 0x45, 0xef, 0xf0, 0x1f, 0xe1, 0x19, 0xc4, 0x13, 0x06,
+  0x00, 0x02, 0xc5, 0x45, 0x01, 0x45, 0xef, 0xf0, 0x3f, 0xe0, 0x13, 0x05,
+  0xc0, 0x03, 0x85, 0x04, 0xef, 0xe0, 0x2f, 0x81, 0xe3, 0x9d, 0x34, 0xfb,
+  0x7d, 0x54, 0x01, 0xa8, 0x6d, 0xf1, 0x81, 0xe8, 0x1f, 0x05, 0x70, 0x70,
+  0xa2, 0x00, 0xef, 0x00, 0xe0, 0x7a, 0x22, 0x85, 0x64, 0x80, 0x1f, 0x05,
+  0x88, 0x70, 0xa2, 0x00, 0xcd, 0xbf, 0x71, 0x46, 0x85, 0x45, 0x01, 0x45,
+  0xef, 0xf0, 0xdf, 0xdc, 0xe3, 0x0e, 0x09, 0xfa, 0x75, 0xb7, 0x5c, 0x45,
+  0x9b, 0x85, 0xb7, 0x04, 0x94, 0x41, 0x1c, 0x49, 0x1b, 0x86, 0xc7, 0x04,
+  0x93, 0xf7, 0x76, 0x00, 0x18, 0x42, 0xbb, 0x9b, 0x07, 0x01, 0x1d, 0x8b,
+  0x63, 0x14, 0xf7, 0x02, 0x9f, 0x07, 0x58, 0x69, 0xa0, 0x00, 0xd4, 0xc3,
+  0x14, 0x42, 0xd4, 0xc7, 0x54, 0x49, 0x94, 0xcb, 0x54, 0x41, 0x94, 0xc3,
+  0x14, 0x45, 0x63, 0x7b, 0xd7, 0x00, 0x18, 0x4d, 0x26, 0xb8, 0x02, 0x12,
+  0xed, 0x94, 0xc7, 0x01, 0x45, 0xd8, 0xcb, 0x82, 0x80, 0x1f, 0x05, 0x46,
+  0x13, 0x00, 0x80, 0x82, 0x80, 0x1f, 0x05, 0x49, 0x13, 0x00, 0x80, 0x82,
+  0x80, 0x9f, 0x07, 0x70, 0x69, 0xa0, 0x00, 0x9c, 0x23, 0x99, 0xcf, 0x1f,
+  0x07, 0x58, 0x69, 0xa0, 0x00, 0x18, 0x43, 0xb3, 0x07, 0xb5, 0x00, 0x63,
+  0x6c, 0xf7, 0x00, 0x63, 0x7a, 0xf5, 0x00, 0x63, 0xe8, 0xb7, 0x00, 0x01,
+  0x45, 0x82, 0x80, 0x1f, 0x05, 0x40, 0x13, 0x00, 0x80, 0x82, 0x80, 0x37,
+  0x05, 0x00, 0x80, 0x05, 0x05, 0x82, 0x80, 0x78, 0x80, 0x83, 0x2a, 0x45,
+  0x00, 0x37, 0x79, 0xa0, 0x00, 0xaa, 0x89, 0x03, 0x24, 0x89, 0x95, 0x03,
+  0x2a, 0x85, 0x00, 0xef, 0xf0, 0x9f, 0xc7, 0x63, 0xf6, 0xaa, 0x00, 0x1f,
+  0x05, 0x42, 0x13, 0x00, 0x80, 0x74, 0x80, 0x13, 0x09, 0x89, 0x95, 0x63,
+  0x73, 0x8a, 0x00, 0x52, 0x84, 0x83, 0xa4, 0x49, 0x00, 0xfd, 0x14, 0xa2,
+  0x94, 0xef, 0xf0, 0xdf, 0xc5, 0xe3, 0x61, 0x95, 0xfe, 0x23, 0x20, 0x89,
+  0x00, 0x01, 0x45, 0xf9, 0xbf, 0xb7, 0x77, 0xa0, 0x00, 0x03, 0xc7, 0x07,
+  0x97, 0x59, 0xef, 0x58, 0x82, 0x2a, 0x84, 0x13, 0x89, 0x07, 0x97, 0xef,
+  0xf0, 0xff, 0xc7, 0x68, 0x08, 0xef, 0xf0, 0xaf, 0xfc, 0x51, 0xe1, 0x0c,
+  0x20, 0x10, 0x30, 0xf2, 0x49, 0x2e, 0xc6, 0x32, 0xc4, 0xef, 0xf0, 0xbf,
+  0xc0, 0xaa, 0x84, 0xef, 0xf0, 0xdf, 0xc0, 0x22, 0x46, 0xb2, 0x45, 0xaa,
+  0x86, 0xa6, 0x87, 0x01, 0x47, 0x63, 0x99, 0xe6, 0x04, 0xef, 0xf0, 0xff,
+  0xbf, 0x05, 0x46, 0x81, 0x45, 0xef, 0xf0, 0xbf, 0xee, 0x31, 0xe9, 0x9f,
+  0x07, 0x71, 0x69, 0xa0, 0x00, 0x05, 0x47, 0x98, 0xa3, 0x22, 0x85, 0xef,
+  0xf0, 0x1f, 0xf6, 0x29, 0xe1, 0x37, 0x75, 0xa0, 0x00, 0x03, 0x26, 0x85,
+  0x95, 0x4c, 0x40, 0x13, 0x05, 0x85, 0x95, 0xef, 0xf0, 0x8f, 0xfb, 0x1d,
+  0xe5, 0x85, 0x47, 0x23, 0x00, 0xf9, 0x00, 0x9f, 0x07, 0x71, 0x69, 0xa0,
+  0x00, 0x9c, 0x23, 0x01, 0x45, 0x91, 0xcf, 0x1f, 0x05, 0x41, 0x13, 0x00,
+  0x80, 0x11, 0xa8, 0x3e, 0x85, 0xf1, 0x07, 0x03, 0xa8, 0x47, 0xfe, 0x63,
+  0x96, 0x09, 0x01, 0xef, 0xf0, 0x9f, 0xe9, 0x4d, 0xdd, 0x54, 0x82, 0x05,
+  0x07, 0x61, 0xbf, 0x01, 0x45, 0x82, 0x80, 0x88, 0x81, 0x2e, 0x8a, 0xb2,
+  0x85, 0x2a, 0x89, 0xb2, 0x84, 0xef, 0xf0, 0x1f, 0xed, 0x3d, 0xe1, 0xef,
+  0xf0, 0x9f, 0xbd, 0x13, 0x7b, 0x39, 0x00, 0xaa, 0x8a, 0x63, 0x02, 0x0b,
+  0x06, 0x91, 0x47, 0xb3, 0x87, 0x67, 0x41, 0x33, 0x09, 0x69, 0x41, 0x93,
+  0xf9, 0xf4, 0x0f, 0x63, 0xe7, 0xf4, 0x00, 0x91, 0x49, 0xb3, 0x89, 0x69,
+  0x41, 0x93, 0xf9, 0xf9, 0x0f, 0x9f, 0x07, 0x58, 0x69, 0xa0, 0x00, 0xd4,
+  0x43, 0x11, 0x46, 0x6c, 0x00, 0x4a, 0x85, 0x02, 0xc6, 0xef, 0xf0, 0x5f,
+  0x81, 0x2a, 0x84, 0x11, 0xed, 0x7c, 0x00, 0xce, 0x86, 0x33, 0x86, 0x67,
+  0x01, 0xce, 0x85, 0x52, 0x85, 0xef, 0x00, 0x70, 0x7e, 0x11, 0xc9, 0x37,
+  0x05, 0x00, 0x80, 0x13, 0x04, 0x45, 0x00, 0x56, 0x85, 0xef, 0xf0, 0xff,
+  0xb7, 0x22, 0x85, 0x84, 0x81, 0x11, 0x09, 0x4e, 0x9a, 0xb3, 0x84, 0x34,
+  0x41, 0x93, 0xf9, 0xc4, 0xff, 0x63, 0x81, 0x09, 0x02, 0x9f, 0x07, 0x58,
+  0x69, 0xa0, 0x00, 0xd4, 0x43, 0x4e, 0x86, 0xd2, 0x85, 0x4a, 0x85, 0xef,
+  0xf0, 0xaf, 0xfc, 0x2a, 0x84, 0x69, 0xf9, 0x4e, 0x9a, 0x4e, 0x99, 0xb3,
+  0x84, 0x34, 0x41, 0x01, 0x44, 0xf9, 0xd0, 0x9f, 0x07, 0x58, 0x69, 0xa0,
+  0x00, 0xd4, 0x43, 0x11, 0x46, 0x6c, 0x00, 0x4a, 0x85, 0x02, 0xc6, 0xef,
+  0xf0, 0x6f, 0xfa, 0x2a, 0x84, 0xa6, 0x86, 0x70, 0x00, 0xa6, 0x85, 0x52,
+  0x85, 0xef, 0x00, 0xf0, 0x77, 0x4d, 0xd1, 0x37, 0x04, 0x00, 0x80, 0x11,
+  0x04, 0x69, 0xbf, 0x98, 0x81, 0x2e, 0x8a, 0xb2, 0x85, 0xaa, 0x84, 0x32,
+  0x89, 0xef, 0xf0, 0xdf, 0xdf, 0x2a, 0x84, 0x71, 0xe5, 0xb3, 0x85, 0x24,
+  0x01, 0x26, 0x85, 0xef, 0xf0, 0x7f, 0xc0, 0x93, 0xfa, 0x34, 0x00, 0x2a,
+  0x8b, 0x63, 0x88, 0x0a, 0x06, 0x91, 0x47, 0xb3, 0x87, 0x57, 0x41, 0xb3,
+  0x84, 0x54, 0x41, 0x93, 0x79, 0xf9, 0x0f, 0x63, 0x67, 0xf9, 0x00, 0x91,
+  0x49, 0xb3, 0x89, 0x59, 0x41, 0x93, 0xf9, 0xf9, 0x0f, 0x9f, 0x0b, 0x58,
+  0x69, 0xa0, 0x00, 0x83, 0xa6, 0x4b, 0x00, 0x11, 0x46, 0x6c, 0x00, 0x26,
+  0x85, 0xef, 0xf0, 0x8f, 0xf3, 0x2a, 0x84, 0x09, 0xed, 0x7c, 0x00, 0xce,
+  0x86, 0x52, 0x86, 0xce, 0x85, 0x33, 0x85, 0x57, 0x01, 0xef, 0x00, 0xb0,
+  0x70, 0x01, 0xc9, 0x37, 0x04, 0x00, 0x80, 0x11, 0x04, 0x5a, 0x85, 0xef,
+  0xf0, 0x3f, 0xc0, 0x95, 0xa0, 0x83, 0xa6, 0xcb, 0x00, 0x26, 0x85, 0x11,
+  0x46, 0x6c, 0x00, 0xef, 0xf0, 0x2f, 0xf9, 0x2a, 0x84, 0x91, 0x04, 0x4e,
+  0x9a, 0x33, 0x09, 0x39, 0x41, 0x93, 0x79, 0xc9, 0xff, 0x71, 0xfc, 0x63,
+  0x80, 0x09, 0x02, 0x9f, 0x07, 0x58, 0x69, 0xa0, 0x00, 0xd4, 0x47, 0xd2,
+  0x85, 0x26, 0x85, 0x4e, 0x86, 0xef, 0xf0, 0xcf, 0xf6, 0x4e, 0x9a, 0xce,
+  0x94, 0x33, 0x09, 0x39, 0x41, 0x31, 0xe1, 0xe3, 0x0d, 0x09, 0xfa, 0x1f,
+  0x04, 0x58, 0x69, 0xa0, 0x00, 0x54, 0x40, 0x11, 0x46, 0x6c, 0x00, 0x26,
+  0x85, 0xef, 0xf0, 0x0f, 0xec, 0x09, 0xc9, 0x5a, 0x85, 0x37, 0x04, 0x00,
+  0x80, 0xef, 0xf0, 0x1f, 0xba, 0x11, 0x04, 0x22, 0x85, 0x94, 0x81, 0xca,
+  0x86, 0x52, 0x86, 0x91, 0x45, 0x68, 0x00, 0xef, 0x00, 0x90, 0x68, 0x75,
+  0xf1, 0x54, 0x44, 0x11, 0x46, 0x6c, 0x00, 0x26, 0x85, 0xef, 0xf0, 0x0f,
+  0xf2, 0x2a, 0x84, 0x9d, 0xbf, 0xa8, 0x80, 0x2a, 0x89, 0x2e, 0x84, 0xef,
+  0xf0, 0x3f, 0xd0, 0x21, 0xe9, 0xb3, 0x05, 0x89, 0x00, 0xfd, 0x77, 0x13,
+  0x97, 0x45, 0x01, 0xb3, 0x74, 0xf9, 0x00, 0x41, 0xcf, 0xed, 0x8f, 0x05,
+  0x67, 0x37, 0x05, 0x00, 0x80, 0xba, 0x97, 0x05, 0x05, 0x63, 0x19, 0x99,
+  0x02, 0x63, 0x97, 0xf5, 0x02, 0x26, 0x85, 0x33, 0x8a, 0x95, 0x40, 0x11,
+  0x6b, 0xef, 0xf0, 0x9f, 0xae, 0x2a, 0x8c, 0x01, 0x49, 0x81, 0x49, 0x81,
+  0x4a, 0x9f, 0x0b, 0x58, 0x69, 0xa0, 0x00, 0x7d, 0x1b, 0x63, 0x1d, 0x0a,
+  0x04, 0x01, 0x44, 0x62, 0x85, 0xef, 0xf0, 0x5f, 0xb2, 0x22, 0x85, 0xa4,
+  0x80, 0x03, 0xa7, 0x0b, 0x01, 0x1b, 0x07, 0xf7, 0x04, 0x03, 0x29, 0x07,
+  0x00, 0x93, 0x59, 0xe9, 0x00, 0xce, 0x8a, 0x63, 0x66, 0x3a, 0x01, 0x13,
+  0x87, 0xf9, 0xff, 0x65, 0x8f, 0x01, 0xcb, 0x85, 0x07, 0x03, 0xa7, 0x8b,
+  0x00, 0xe3, 0xee, 0xe7, 0xfc, 0x63, 0x83, 0xe7, 0x02, 0x33, 0x79, 0x69,
+  0x01, 0x1b, 0x29, 0x39, 0x1d, 0x01, 0x46, 0xca, 0x85, 0x26, 0x85, 0xef,
+  0xf0, 0x2f, 0xee, 0x2a, 0x84, 0x5d, 0xf9, 0x33, 0x0a, 0x5a, 0x41, 0xd6,
+  0x94, 0x65, 0xb7, 0x85, 0x47, 0xd1, 0xbf, 0x1f, 0x04, 0x47, 0x13, 0x00,
+  0x80, 0x4d, 0xb7, 0xe3, 0x0f, 0x99, 0xf6, 0x37, 0x05, 0x00, 0x80, 0x05,
+  0x05, 0x79, 0xbf, 0x38, 0x80, 0x9f, 0x07, 0x70, 0x69, 0xa0, 0x00, 0x9c,
+  0x23, 0x95, 0xc7, 0xb7, 0x05, 0x40, 0x00, 0x01, 0x45, 0xef, 0xf0, 0x1f,
+  0xa5, 0x9f, 0x07, 0x58, 0x69, 0xa0, 0x00, 0x9c, 0x4b, 0xaa, 0x84, 0x05,
+  0x46, 0x8c, 0x43, 0x01, 0x45, 0xef, 0xf0, 0x4f, 0xe9, 0x2a, 0x84, 0x26,
+  0x85, 0xef, 0xf0, 0xdf, 0xa8, 0x39, 0xac, 0x02, 0x13, 0xec, 0x22, 0x85,
+  0x34, 0x80, 0x1f, 0x04, 0x40, 0x13, 0x00, 0x80, 0xdd, 0xbf, 0x88, 0x81,
+  0x9f, 0x07, 0xc0, 0x70, 0xa2, 0x00, 0x5b, 0x95, 0xa7, 0x06, 0x26, 0x21,
+  0x13, 0x8a, 0x74, 0x00, 0x13, 0x5a, 0x3a, 0x00, 0x63, 0x6f, 0x46, 0x07,
+  0x03, 0x59, 0x05, 0x00, 0xb2, 0x86, 0xae, 0x89, 0x01, 0x46, 0xb6, 0x85,
+  0x4e, 0x85, 0xef, 0x00, 0x70, 0x58, 0xb3, 0x67, 0x99, 0x00, 0x9d, 0x8b,
+  0x4a, 0x84, 0x91, 0xcb, 0x41, 0x6a, 0xca, 0x94, 0xa1, 0x4a, 0x7d, 0x1a,
+  0x05, 0x4b, 0x63, 0x4b, 0x94, 0x00, 0x01, 0x45, 0x39, 0xa0, 0x52, 0x86,
+  0x93, 0x55, 0x39, 0x00, 0x4e, 0x85, 0xef, 0xe0, 0x6f, 0xa8, 0x84, 0x81,
+  0x13, 0x76, 0x74, 0x00, 0x93, 0x55, 0x34, 0x00, 0x13, 0x05, 0xf1, 0x00,
+  0xef, 0xe0, 0xef, 0xa1, 0x7d, 0xf5, 0x83, 0x47, 0xf1, 0x00, 0x8d, 0xc3,
+  0xb3, 0x07, 0x24, 0x41, 0x33, 0xc7, 0x57, 0x03, 0xb3, 0xe7, 0x57, 0x03,
+  0x33, 0x77, 0x47, 0x01, 0x4e, 0x97, 0x14, 0x23, 0xb3, 0xf7, 0x47, 0x01,
+  0xb3, 0x17, 0xfb, 0x00, 0xd5, 0x8f, 0x1c, 0xa3, 0x05, 0x04, 0x21, 0x9c,
+  0x7d, 0xb7, 0x7d, 0x55, 0x7d, 0xbf, 0x18, 0x80, 0xef, 0xe0, 0x2f, 0xd0,
+  0x10, 0x80, 0x6f, 0xe0, 0xaf, 0xb0, 0x21, 0x81, 0x01, 0x9d, 0x82, 0x80,
+  0x01, 0x9d, 0x82, 0x80, 0x89, 0xc5, 0x3b, 0x72, 0x05, 0x13, 0x6f, 0xf0,
+  0xdf, 0xf4, 0x7d, 0x55, 0x82, 0x80, 0x18, 0x80, 0x95, 0x28, 0xbb, 0x13,
+  0x05, 0x01, 0x13, 0x05, 0x90, 0x02, 0x10, 0x80, 0x6f, 0xe0, 0x8f, 0xcc,
+  0x65, 0x45, 0xe5, 0xbf, 0x6f, 0xd0, 0x4f, 0xf8, 0x18, 0x81, 0x9f, 0x07,
+  0x88, 0x1f, 0xa2, 0x00, 0x3e, 0xc2, 0x9f, 0x07, 0x98, 0x20, 0xa2, 0x00,
+  0x3e, 0xc6, 0x48, 0x00, 0x9f, 0x07, 0xde, 0x48, 0xa2, 0x00, 0x3e, 0xc4,
+  0xef, 0xd0, 0x6f, 0xe3, 0x37, 0x75, 0xa0, 0x00, 0x9f, 0x07, 0x60, 0x95,
+  0x01, 0x00, 0x93, 0x05, 0x05, 0xaa, 0xbe, 0x95, 0x13, 0x05, 0x05, 0xaa,
+  0xef, 0xd0, 0x2f, 0xe7, 0x14, 0x81, 0x18, 0x80, 0xef, 0xe0, 0x8f, 0x8f,
+  0x1f, 0x05, 0xb8, 0x0b, 0x00, 0x00, 0xef, 0xd0, 0xbf, 0xac, 0x37, 0x27,
+  0x00, 0x40, 0x83, 0x27, 0x07, 0x11, 0x93, 0xe7, 0x47, 0x00, 0x23, 0x28,
+  0xf7, 0x10, 0x14, 0x80, 0xb7, 0x07, 0x00, 0x40, 0xc8, 0x4b, 0x05, 0x89,
+  0x82, 0x80, 0x28, 0x80, 0xef, 0xf0, 0x5f, 0xff, 0xbb, 0x18, 0x05, 0x01,
+  0x37, 0x34, 0x6e, 0x01, 0x93, 0x05, 0x04, 0x60, 0x01, 0x45, 0xef, 0xf0,
+  0x0f, 0xea, 0x61, 0x45, 0xef, 0xf0, 0x8f, 0xf2, 0x13, 0x05, 0x04, 0x60,
+  0x20, 0x80, 0x6f, 0xf0, 0xaf, 0xf3, 0x37, 0x64, 0x62, 0x02, 0x93, 0x05,
+  0x04, 0xa0, 0x01, 0x45, 0xef, 0xf0, 0x2f, 0xe8, 0x13, 0x05, 0x80, 0x02,
+  0xef, 0xf0, 0x8f, 0xf0, 0x13, 0x05, 0x04, 0xa0, 0xc5, 0xb7, 0x28, 0x80,
+  0x37, 0x34, 0x00, 0x40, 0x85, 0x47, 0x23, 0x22, 0xf4, 0x4a, 0x05, 0x45,
+  0xef, 0xd0, 0x9f, 0xa5, 0x8d, 0x47, 0x23, 0x22, 0xf4, 0x4a, 0x37, 0x17,
+  0x00, 0x44, 0x83, 0x27, 0x47, 0x13, 0xb7, 0x06, 0x04, 0x00, 0xd5, 0x8f,
+  0x23, 0x2a, 0xf7, 0x12, 0x24, 0x80, 0xb7, 0xe7, 0x00, 0x44, 0x03, 0xa7,
+  0x87, 0x86, 0x13, 0x77, 0xf7, 0xf8, 0x13, 0x67, 0x07, 0x03, 0x23, 0xa4,
+  0xe7, 0x86, 0x03, 0xa7, 0xc7, 0x86, 0x13, 0x77, 0xf7, 0xf8, 0x13, 0x67,
+  0x07, 0x02, 0x23, 0xa6, 0xe7, 0x86, 0x03, 0xa7, 0x07, 0x87, 0x13, 0x77,
+  0xf7, 0xf8, 0x13, 0x67, 0x07, 0x02, 0x23, 0xa8, 0xe7, 0x86, 0x03, 0xa7,
+  0x47, 0x87, 0x13, 0x77, 0xf7, 0xf8, 0x13, 0x67, 0x07, 0x02, 0x23, 0xaa,
+  0xe7, 0x86, 0x03, 0xa7, 0x87, 0x87, 0x13, 0x77, 0xf7, 0xf8, 0x13, 0x67,
+  0x07, 0x02, 0x23, 0xac, 0xe7, 0x86, 0x03, 0xa7, 0xc7, 0x87, 0x13, 0x77,
+  0xf7, 0xf8, 0x13, 0x67, 0x07, 0x02, 0x23, 0xae, 0xe7, 0x86, 0x82, 0x80,
+  0x6f, 0xd0, 0x5f, 0x9d, 0x6f, 0xd0, 0x1f, 0x98, 0x18, 0x81, 0x9f, 0x07,
+  0x73, 0x69, 0xa0, 0x00, 0x9c, 0x23, 0xa3, 0x07, 0xa1, 0x00, 0x81, 0xeb,
+  0x89, 0x46, 0x05, 0x46, 0x93, 0x05, 0xf1, 0x00, 0x01, 0x45, 0xef, 0xd0,
+  0x9f, 0xdf, 0x14, 0x81, 0x9f, 0x07, 0x73, 0x69, 0xa0, 0x00, 0x9c, 0x23,
+  0x89, 0xef, 0x18, 0x81, 0x2a, 0xc6, 0xef, 0xc0, 0x8f, 0xb5, 0xb2, 0x45,
+  0x2a, 0x86, 0x93, 0x06, 0x00, 0x7d, 0x01, 0x45, 0x10, 0x81, 0x6f, 0xd0,
+  0x5f, 0xdd, 0x82, 0x80, 0x9f, 0x07, 0x73, 0x69, 0xa0, 0x00, 0x9c, 0x23,
+  0x2e, 0x86, 0x99, 0xe7, 0xaa, 0x85, 0x93, 0x06, 0x00, 0x7d, 0x01, 0x45,
+  0x6f, 0xd0, 0xbf, 0xdb, 0x82, 0x80, 0x18, 0x81, 0x89, 0x46, 0x05, 0x46,
+  0x93, 0x05, 0xf1, 0x00, 0x01, 0x45, 0xa3, 0x07, 0x01, 0x00, 0xef, 0xd0,
+  0x7f, 0xe1, 0x03, 0x45, 0xf1, 0x00, 0x14, 0x81, 0x9f, 0x07, 0x73, 0x69,
+  0xa0, 0x00, 0x9c, 0x23, 0xa9, 0xef, 0x98, 0x80, 0xaa, 0x84, 0x1f, 0x05,
+  0x3c, 0x71, 0xa2, 0x00, 0x2e, 0x8a, 0x01, 0x44, 0xef, 0xf0, 0x1f, 0xf9,
+  0x01, 0x49, 0xa5, 0x4a, 0x1d, 0x4b, 0x93, 0x0b, 0x00, 0x03, 0xa1, 0x49,
+  0x13, 0xd7, 0xc4, 0x01, 0x93, 0x77, 0xf7, 0x0f, 0x13, 0x85, 0x07, 0x03,
+  0x63, 0xf4, 0xea, 0x00, 0x13, 0x85, 0x77, 0x03, 0x92, 0x04, 0x63, 0x05,
+  0x0a, 0x00, 0xef, 0xf0, 0x7f, 0xf4, 0x11, 0xa8, 0xe3, 0x1d, 0x09, 0xfe,
+  0xe3, 0x0b, 0x64, 0xff, 0x63, 0x05, 0x75, 0x01, 0xef, 0xf0, 0x5f, 0xf3,
+  0x05, 0x49, 0x05, 0x04, 0xe3, 0x16, 0x34, 0xfd, 0x94, 0x80, 0x82, 0x80,
+  0x48, 0x80, 0xaa, 0x84, 0x2e, 0x89, 0x01, 0x44, 0x63, 0x14, 0x94, 0x00,
+  0x7d, 0x55, 0x11, 0xa8, 0x01, 0x45, 0xef, 0xd0, 0x9f, 0xe0, 0x19, 0xe5,
+  0xef, 0xf0, 0xbf, 0xf6, 0x23, 0x00, 0xa9, 0x00, 0x01, 0x45, 0x44, 0x80,
+  0x05, 0x04, 0xcd, 0xb7, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x34, 0x71,
+  0xa2, 0x00, 0xef, 0xf0, 0x3f, 0xf1, 0x81, 0x45, 0x22, 0x85, 0xef, 0xf0,
+  0x3f, 0xf6, 0x1f, 0x05, 0x68, 0x6e, 0xa2, 0x00, 0xef, 0xf0, 0x1f, 0xf0,
+  0x13, 0x05, 0x40, 0x06, 0x20, 0x80, 0x6f, 0xf0, 0x3f, 0xed, 0x18, 0x80,
+  0xef, 0xf0, 0x1f, 0xef, 0x1f, 0x05, 0x48, 0x74, 0xa2, 0x00, 0x10, 0x80,
+  0x6f, 0xf0, 0x5f, 0xee, 0x28, 0x80, 0x2e, 0x84, 0xef, 0xf0, 0xdf, 0xed,
+  0x22, 0x85, 0x81, 0x45, 0xef, 0xf0, 0xdf, 0xf2, 0x1f, 0x05, 0x48, 0x74,
+  0xa2, 0x00, 0x20, 0x80, 0x6f, 0xf0, 0x9f, 0xec, 0x28, 0x81, 0x2e, 0x84,
+  0x32, 0xc6, 0xef, 0xf0, 0xff, 0xeb, 0x81, 0x45, 0x22, 0x85, 0xef, 0xf0,
+  0xff, 0xf0, 0x1f, 0x05, 0xb4, 0x71, 0xa2, 0x00, 0xef, 0xf0, 0xdf, 0xea,
+  0x32, 0x46, 0x81, 0x45, 0x32, 0x85, 0xef, 0xf0, 0xbf, 0xef, 0x1f, 0x05,
+  0x48, 0x74, 0xa2, 0x00, 0x20, 0x81, 0x6f, 0xf0, 0x7f, 0xe9, 0x28, 0x82,
+  0x9f, 0x07, 0x94, 0x24, 0xa0, 0x00, 0x23, 0x80, 0x07, 0x00, 0x93, 0x07,
+  0x90, 0x02, 0x23, 0x06, 0xf1, 0x00, 0x93, 0x07, 0x30, 0x07, 0xa3, 0x07,
+  0xf1, 0x00, 0x23, 0x07, 0xf1, 0x00, 0x1c, 0x41, 0x13, 0x07, 0xa0, 0x02,
+  0xa3, 0x06, 0xe1, 0x00, 0x3e, 0xc8, 0x5c, 0x21, 0x78, 0x21, 0x23, 0x04,
+  0x01, 0x00, 0xed, 0x17, 0x23, 0x0a, 0xf1, 0x00, 0x93, 0x07, 0xf7, 0xff,
+  0x81, 0x9f, 0xbb, 0xfd, 0x07, 0x02, 0x23, 0x0b, 0xe1, 0x00, 0x5c, 0x31,
+  0x05, 0x44, 0x75, 0xfc, 0x02, 0x14, 0xeb, 0x38, 0x08, 0xfd, 0x17, 0xa3,
+  0x0a, 0xf1, 0x00, 0x81, 0x46, 0x3c, 0x00, 0x10, 0x08, 0x6c, 0x00, 0x01,
+  0x45, 0x3e, 0xcc, 0x22, 0xce, 0xef, 0xd0, 0x5f, 0xaf, 0x01, 0x45, 0xef,
+  0xf0, 0x6f, 0xc0, 0x9f, 0x07, 0x72, 0x69, 0xa0, 0x00, 0x80, 0xa3, 0x24,
+  0x82, 0x23, 0x0b, 0x01, 0x00, 0xf9, 0xb7, 0x18, 0x80, 0x9f, 0x07, 0x94,
+  0x24, 0xa0, 0x00, 0x88, 0x23, 0xef, 0xd0, 0xff, 0xb9, 0x9f, 0x07, 0x72,
+  0x69, 0xa0, 0x00, 0x23, 0x80, 0x07, 0x00, 0x14, 0x80, 0x6f, 0xd0, 0x7f,
+  0xe0, 0x37, 0x07, 0x00, 0x40, 0x1c, 0x47, 0x3d, 0x89, 0x93, 0xf7, 0xf7,
+  0xf0, 0x9b, 0xa7, 0xa7, 0x08, 0x1c, 0xc7, 0x82, 0x80, 0x38, 0x80, 0xb7,
+  0x07, 0x00, 0x40, 0x80, 0x47, 0x1f, 0x05, 0x40, 0x71, 0xa2, 0x00, 0x11,
+  0x80, 0x3d, 0x88, 0x93, 0x04, 0x14, 0x00, 0xa6, 0x85, 0xef, 0xf0, 0xdf,
+  0xee, 0x13, 0x05, 0x40, 0x06, 0xef, 0xd0, 0x0f, 0xf2, 0x3b, 0x03, 0x04,
+  0x0f, 0x26, 0x85, 0x30, 0x80, 0x6f, 0xf0, 0x1f, 0xfc, 0xef, 0xd0, 0xff,
+  0xd4, 0x73, 0x00, 0x50, 0x10, 0x01, 0xa0, 0x28, 0x82, 0x2a, 0x84, 0x05,
+  0x46, 0x93, 0x05, 0xb1, 0x00, 0x21, 0x45, 0xa3, 0x05, 0x01, 0x00, 0xef,
+  0xf0, 0xff, 0xc0, 0x09, 0xc9, 0xaa, 0x85, 0x1f, 0x05, 0x78, 0x71, 0xa2,
+  0x00, 0xef, 0xf0, 0xdf, 0xea, 0x7d, 0x55, 0x24, 0x82, 0x83, 0x47, 0xb1,
+  0x00, 0x13, 0xf7, 0x37, 0x00, 0x19, 0xc7, 0xb1, 0x8b, 0x89, 0xe7, 0x93,
+  0x07, 0xe0, 0x63, 0x1c, 0xc0, 0xed, 0xb7, 0x51, 0x46, 0x6c, 0x00, 0x05,
+  0x45, 0x02, 0xc6, 0x02, 0xc8, 0x02, 0xca, 0x02, 0xcc, 0x02, 0xce, 0xef,
+  0xf0, 0x3f, 0xbd, 0x11, 0xc5, 0xaa, 0x85, 0x1f, 0x05, 0x98, 0x71, 0xa2,
+  0x00, 0xd1, 0xb7, 0x03, 0x47, 0x51, 0x01, 0x83, 0x47, 0x41, 0x01, 0x9b,
+  0xa7, 0xe7, 0x10, 0x21, 0x67, 0x7d, 0x17, 0xf9, 0x8f, 0x1f, 0x07, 0x58,
+  0x30, 0x00, 0x00, 0xe3, 0x80, 0xe7, 0xfc, 0x93, 0x07, 0x30, 0x06, 0x75,
+  0xbf, 0x18, 0x82, 0x9f, 0x07, 0x80, 0x00, 0xa2, 0x00, 0xd0, 0x53, 0x02,
+  0xce, 0x15, 0xc2, 0x68, 0x08, 0x32, 0xc6, 0xef, 0xf0, 0x1f, 0xf7, 0x19,
+  0xed, 0xf2, 0x45, 0x32, 0x46, 0x63, 0x8a, 0xc5, 0x00, 0x1f, 0x05, 0x54,
+  0x71, 0xa2, 0x00, 0xef, 0xf0, 0x3f, 0xe4, 0xef, 0xd0, 0xdf, 0xc9, 0x01,
+  0xa0, 0x01, 0x45, 0x14, 0x82, 0x7d, 0x55, 0xf5, 0xbf, 0x6f, 0xf0, 0x1f,
+  0xb9, 0x6f, 0xd0, 0xcf, 0xb0, 0x28, 0x80, 0xb7, 0x07, 0x00, 0x04, 0xf3,
+  0xb7, 0x47, 0x30, 0x37, 0x74, 0xa0, 0x00, 0x13, 0x07, 0x44, 0x97, 0x1c,
+  0x43, 0x13, 0x04, 0x44, 0x97, 0x85, 0x07, 0x1c, 0xc3, 0xc9, 0x22, 0x38,
+  0x55, 0x9f, 0x07, 0x4a, 0x53, 0xa2, 0x00, 0x63, 0x05, 0xf7, 0x00, 0x55,
+  0x2a, 0x3c, 0x55, 0x82, 0x97, 0xb7, 0x07, 0x00, 0x04, 0xf3, 0xa7, 0x47,
+  0x30, 0x1c, 0x40, 0xfd, 0x17, 0x1c, 0xc0, 0x24, 0x80, 0x28, 0x80, 0xb7,
+  0x07, 0x00, 0x08, 0xf3, 0xb7, 0x47, 0x30, 0x37, 0x74, 0xa0, 0x00, 0x13,
+  0x07, 0x44, 0x97, 0x1c, 0x43, 0x13, 0x04, 0x44, 0x97, 0x85, 0x07, 0x1c,
+  0xc3, 0x49, 0x22, 0x78, 0x55, 0x9f, 0x07, 0x4a, 0x53, 0xa2, 0x00, 0x63,
+  0x05, 0xf7, 0x00, 0x95, 0x2a, 0x7c, 0x55, 0x82, 0x97, 0xb7, 0x07, 0x00,
+  0x08, 0xf3, 0xa7, 0x47, 0x30, 0x1c, 0x40, 0xfd, 0x17, 0x1c, 0xc0, 0x24,
+  0x80, 0x28, 0x80, 0xb7, 0x07, 0x00, 0x10, 0xf3, 0xb7, 0x47, 0x30, 0x37,
+  0x74, 0xa0, 0x00, 0x13, 0x07, 0x44, 0x97, 0x1c, 0x43, 0x13, 0x04, 0x44,
+  0x97, 0x85, 0x07, 0x1c, 0xc3, 0x89, 0x22, 0x38, 0x59, 0x9f, 0x07, 0x4a,
+  0x53, 0xa2, 0x00, 0x63, 0x05, 0xf7, 0x00, 0x15, 0x2a, 0x3c, 0x59, 0x82,
+  0x97, 0xb7, 0x07, 0x00, 0x10, 0xf3, 0xa7, 0x47, 0x30, 0x1c, 0x40, 0xfd,
+  0x17, 0x1c, 0xc0, 0x24, 0x80, 0x28, 0x80, 0xb7, 0x07, 0x00, 0x20, 0xf3,
+  0xb7, 0x47, 0x30, 0x37, 0x74, 0xa0, 0x00, 0x13, 0x07, 0x44, 0x97, 0x1c,
+  0x43, 0x13, 0x04, 0x44, 0x97, 0x85, 0x07, 0x1c, 0xc3, 0x09, 0x22, 0x78,
+  0x59, 0x9f, 0x07, 0x4a, 0x53, 0xa2, 0x00, 0x63, 0x05, 0xf7, 0x00, 0xd5,
+  0x28, 0x7c, 0x59, 0x82, 0x97, 0xb7, 0x07, 0x00, 0x20, 0xf3, 0xa7, 0x47,
+  0x30, 0x1c, 0x40, 0xfd, 0x17, 0x1c, 0xc0, 0x24, 0x80, 0x28, 0x80, 0xb7,
+  0x07, 0x00, 0x40, 0xf3, 0xb7, 0x47, 0x30, 0x37, 0x74, 0xa0, 0x00, 0x13,
+  0x07, 0x44, 0x97, 0x1c, 0x43, 0x13, 0x04, 0x44, 0x97, 0x85, 0x07, 0x1c,
+  0xc3, 0xc9, 0x20, 0x38, 0x5d, 0x9f, 0x07, 0x4a, 0x53, 0xa2, 0x00, 0x63,
+  0x05, 0xf7, 0x00, 0x55, 0x28, 0x3c, 0x5d, 0x82, 0x97, 0xb7, 0x07, 0x00,
+  0x40, 0xf3, 0xa7, 0x47, 0x30, 0x1c, 0x40, 0xfd, 0x17, 0x1c, 0xc0, 0x24,
+  0x80, 0x28, 0x80, 0xb7, 0x07, 0x00, 0x80, 0xf3, 0xb7, 0x47, 0x30, 0x37,
+  0x74, 0xa0, 0x00, 0x13, 0x07, 0x44, 0x97, 0x1c, 0x43, 0x13, 0x04, 0x44,
+  0x97, 0x85, 0x07, 0x1c, 0xc3, 0x49, 0x20, 0x78, 0x5d, 0x9f, 0x07, 0x4a,
+  0x53, 0xa2, 0x00, 0x63, 0x05, 0xf7, 0x00, 0x95, 0x28, 0x7c, 0x5d, 0x82,
+  0x97, 0xb7, 0x07, 0x00, 0x80, 0xf3, 0xa7, 0x47, 0x30, 0x1c, 0x40, 0xfd,
+  0x17, 0x1c, 0xc0, 0x24, 0x80, 0x38, 0x80, 0xef, 0x10, 0xd0, 0x0e, 0xb7,
+  0x74, 0xa0, 0x00, 0x13, 0x87, 0x44, 0x97, 0x1c, 0x43, 0x85, 0x07, 0x1c,
+  0xc3, 0xef, 0x10, 0x30, 0x0f, 0x73, 0x24, 0x20, 0x34, 0x89, 0x20, 0x85,
+  0x67, 0xfd, 0x17, 0x7d, 0x8c, 0x0a, 0x04, 0x22, 0x95, 0x18, 0x41, 0x9f,
+  0x07, 0x36, 0x4f, 0xa2, 0x00, 0x93, 0x84, 0x44, 0x97, 0x63, 0x06, 0xf7,
+  0x00, 0x1d, 0x20, 0x22, 0x95, 0x1c, 0x41, 0x82, 0x97, 0xef, 0x10, 0xf0,
+  0x0a, 0x9c, 0x40, 0xfd, 0x17, 0x9c, 0xc0, 0x30, 0x80, 0x6f, 0x10, 0xb0,
+  0x0b, 0x73, 0x25, 0x20, 0x34, 0x85, 0x67, 0xfd, 0x17, 0x7d, 0x8d, 0x82,
+  0x80, 0x01, 0xa0, 0x1f, 0x05, 0xbc, 0x04, 0xa2, 0x00, 0x82, 0x80, 0x39,
+  0xc9, 0x38, 0x80, 0x44, 0x41, 0x2a, 0x84, 0x1f, 0x05, 0xfc, 0x71, 0xa2,
+  0x00, 0xa6, 0x85, 0xef, 0xf0, 0x4f, 0x8d, 0xb7, 0x07, 0x00, 0x80, 0xb1,
+  0x07, 0x63, 0x9b, 0xf4, 0x02, 0x1f, 0x05, 0x10, 0x72, 0xa2, 0x00, 0xef,
+  0xf0, 0x0f, 0x8c, 0x09, 0x65, 0x21, 0x05, 0x19, 0x21, 0x5c, 0x4c, 0x22,
+  0x85, 0xc1, 0x07, 0x5c, 0xcc, 0x8d, 0x23, 0x9f, 0x07, 0x8c, 0x69, 0xa0,
+  0x00, 0x9c, 0x43, 0x81, 0xc7, 0xa2, 0x85, 0x26, 0x85, 0x82, 0x97, 0x01,
+  0x45, 0x30, 0x80, 0x6f, 0xd0, 0x1f, 0xa1, 0x09, 0x65, 0x11, 0x05, 0xe1,
+  0xbf, 0x82, 0x80, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x6c, 0x74, 0xa2,
+  0x00, 0xef, 0xf0, 0x2f, 0x88, 0x2e, 0x20, 0x1f, 0x05, 0xa4, 0x74, 0xa2,
+  0x00, 0xef, 0xf0, 0x6f, 0x87, 0x1c, 0x48, 0x1f, 0x05, 0xbc, 0x74, 0xa2,
+  0x00, 0xcc, 0x4b, 0xef, 0xf0, 0x8f, 0x86, 0x1c, 0x48, 0x1f, 0x05, 0xd4,
+  0x74, 0xa2, 0x00, 0x8c, 0x4b, 0xef, 0xf0, 0xaf, 0x85, 0x1c, 0x48, 0x1f,
+  0x05, 0xec, 0x74, 0xa2, 0x00, 0x8c, 0x47, 0xef, 0xf0, 0xcf, 0x84, 0x1c,
+  0x48, 0x1f, 0x05, 0x04, 0x75, 0xa2, 0x00, 0xcc, 0x43, 0xef, 0xf0, 0xef,
+  0x83, 0x1c, 0x48, 0x1f, 0x05, 0x1c, 0x75, 0xa2, 0x00, 0x8c, 0x43, 0xef,
+  0xf0, 0x0f, 0x83, 0x1c, 0x48, 0x1f, 0x05, 0x34, 0x75, 0xa2, 0x00, 0xb6,
+  0x5a, 0x02, 0x15, 0xea, 0x83, 0xa5, 0xc7, 0x08, 0xef, 0xf0, 0x0f, 0x82,
+  0x1c, 0x48, 0x1f, 0x05, 0x4c, 0x75, 0xa2, 0x00, 0xcc, 0x4f, 0xef, 0xf0,
+  0x2f, 0x81, 0x1c, 0x48, 0x1f, 0x05, 0x64, 0x75, 0xa2, 0x00, 0xcc, 0x47,
+  0xef, 0xf0, 0x4f, 0x80, 0x1c, 0x48, 0x1f, 0x05, 0x7c, 0x75, 0xa2, 0x00,
+  0x8c, 0x4f, 0xef, 0xe0, 0x7f, 0xff, 0x1c, 0x48, 0x1f, 0x05, 0x94, 0x75,
+  0xa2, 0x00, 0x83, 0xa5, 0x87, 0x08, 0xef, 0xe0, 0x7f, 0xfe, 0x1c, 0x48,
+  0x1f, 0x05, 0xac, 0x75, 0xa2, 0x00, 0x83, 0xa5, 0x47, 0x08, 0xef, 0xe0,
+  0x7f, 0xfd, 0x1c, 0x48, 0x1f, 0x05, 0xc4, 0x75, 0xa2, 0x00, 0x83, 0xa5,
+  0x07, 0x08, 0xef, 0xe0, 0x7f, 0xfc, 0x1c, 0x48, 0x1f, 0x05, 0xdc, 0x75,
+  0xa2, 0x00, 0xec, 0x47, 0xef, 0xe0, 0x9f, 0xfb, 0x1c, 0x48, 0x1f, 0x05,
+  0xf4, 0x75, 0xa2, 0x00, 0xac, 0x47, 0xef, 0xe0, 0xbf, 0xfa, 0x1c, 0x48,
+  0x1f, 0x05, 0x0c, 0x76, 0xa2, 0x00, 0xec, 0x5f, 0xef, 0xe0, 0xdf, 0xf9,
+  0x1c, 0x48, 0x1f, 0x05, 0x24, 0x76, 0xa2, 0x00, 0xac, 0x5f, 0xef, 0xe0,
+  0xff, 0xf8, 0x1c, 0x48, 0x1f, 0x05, 0x3c, 0x76, 0xa2, 0x00, 0xec, 0x5b,
+  0xef, 0xe0, 0x1f, 0xf8, 0x1c, 0x48, 0x1f, 0x05, 0x54, 0x76, 0xa2, 0x00,
+  0xac, 0x5b, 0xef, 0xe0, 0x3f, 0xf7, 0x1c, 0x48, 0x1f, 0x05, 0x6c, 0x76,
+  0xa2, 0x00, 0xec, 0x57, 0xef, 0xe0, 0x5f, 0xf6, 0x1c, 0x48, 0x1f, 0x05,
+  0x84, 0x76, 0xa2, 0x00, 0xac, 0x57, 0xef, 0xe0, 0x7f, 0xf5, 0x1c, 0x48,
+  0x1f, 0x05, 0x9c, 0x76, 0xa2, 0x00, 0xec, 0x53, 0xef, 0xe0, 0x9f, 0xf4,
+  0x1c, 0x48, 0x1f, 0x05, 0xb4, 0x76, 0xa2, 0x00, 0xac, 0x53, 0xef, 0xe0,
+  0xbf, 0xf3, 0x1c, 0x48, 0x1f, 0x05, 0xcc, 0x76, 0xa2, 0x00, 0xec, 0x43,
+  0xef, 0xe0, 0xdf, 0xf2, 0x1c, 0x48, 0x1f, 0x05, 0xe4, 0x76, 0xa2, 0x00,
+  0xac, 0x43, 0xef, 0xe0, 0xff, 0xf1, 0x1c, 0x48, 0x1f, 0x05, 0xfc, 0x76,
+  0xa2, 0x00, 0xcc, 0x5f, 0xef, 0xe0, 0x1f, 0xf1, 0x1c, 0x48, 0x1f, 0x05,
+  0x14, 0x77, 0xa2, 0x00, 0x8c, 0x5f, 0xef, 0xe0, 0x3f, 0xf0, 0x1c, 0x48,
+  0x1f, 0x05, 0x2c, 0x77, 0xa2, 0x00, 0xcc, 0x5b, 0xef, 0xe0, 0x5f, 0xef,
+  0x1c, 0x48, 0x1f, 0x05, 0x44, 0x77, 0xa2, 0x00, 0x8c, 0x5b, 0xef, 0xe0,
+  0x7f, 0xee, 0x1c, 0x48, 0x1f, 0x05, 0x5c, 0x77, 0xa2, 0x00, 0xcc, 0x57,
+  0xef, 0xe0, 0x9f, 0xed, 0x1c, 0x48, 0x1f, 0x05, 0x74, 0x77, 0xa2, 0x00,
+  0x8c, 0x57, 0xef, 0xe0, 0xbf, 0xec, 0x1c, 0x48, 0x1f, 0x05, 0x8c, 0x77,
+  0xa2, 0x00, 0xcc, 0x53, 0xef, 0xe0, 0xdf, 0xeb, 0x1c, 0x48, 0x1f, 0x05,
+  0xa4, 0x77, 0xa2, 0x00, 0x8c, 0x53, 0xef, 0xe0, 0xff, 0xea, 0x1c, 0x48,
+  0x1f, 0x05, 0xbc, 0x77, 0xa2, 0x00, 0xec, 0x4f, 0xef, 0xe0, 0x1f, 0xea,
+  0x1c, 0x48, 0x1f, 0x05, 0xd4, 0x77, 0xa2, 0x00, 0xac, 0x4f, 0xef, 0xe0,
+  0x3f, 0xe9, 0x1c, 0x48, 0x1f, 0x05, 0xec, 0x77, 0xa2, 0x00, 0xec, 0x4b,
+  0xef, 0xe0, 0x5f, 0xe8, 0x1c, 0x48, 0x1f, 0x05, 0x04, 0x78, 0xa2, 0x00,
+  0xac, 0x4b, 0xef, 0xe0, 0x7f, 0xe7, 0x1f, 0x05, 0x1c, 0x78, 0xa2, 0x00,
+  0x20, 0x80, 0x6f, 0xe0, 0xbf, 0xe6, 0x54, 0x41, 0xb7, 0x77, 0xa0, 0x00,
+  0x13, 0x87, 0x87, 0x97, 0x08, 0xcb, 0x13, 0x85, 0x87, 0x97, 0x36, 0xa3,
+  0x6f, 0xf0, 0x9f, 0xdc, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x4c, 0x74,
+  0xa2, 0x00, 0xef, 0xe0, 0x7f, 0xe4, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0,
+  0x9f, 0xfd, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x7c, 0x73, 0xa2, 0x00,
+  0xef, 0xe0, 0x1f, 0xe3, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0x3f, 0xfc,
+  0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x30, 0x73, 0xa2, 0x00, 0xef, 0xe0,
+  0xbf, 0xe1, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0xdf, 0xfa, 0x28, 0x80,
+  0x2a, 0x84, 0x1f, 0x05, 0x58, 0x73, 0xa2, 0x00, 0xef, 0xe0, 0x5f, 0xe0,
+  0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0x7f, 0xf9, 0x28, 0x80, 0x2a, 0x84,
+  0x1f, 0x05, 0xc8, 0x73, 0xa2, 0x00, 0xef, 0xe0, 0xff, 0xde, 0x22, 0x85,
+  0x20, 0x80, 0x6f, 0xf0, 0x1f, 0xf8, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05,
+  0xa8, 0x73, 0xa2, 0x00, 0xef, 0xe0, 0x9f, 0xdd, 0x22, 0x85, 0x20, 0x80,
+  0x6f, 0xf0, 0xbf, 0xf6, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x1c, 0x74,
+  0xa2, 0x00, 0xef, 0xe0, 0x3f, 0xdc, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0,
+  0x5f, 0xf5, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0xf0, 0x73, 0xa2, 0x00,
+  0xef, 0xe0, 0xdf, 0xda, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0xff, 0xf3,
+  0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x04, 0x73, 0xa2, 0x00, 0xef, 0xe0,
+  0x7f, 0xd9, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0x9f, 0xf2, 0x28, 0x80,
+  0x2a, 0x84, 0x1f, 0x05, 0xd8, 0x72, 0xa2, 0x00, 0xef, 0xe0, 0x1f, 0xd8,
+  0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0x3f, 0xf1, 0x28, 0x80, 0x2a, 0x84,
+  0x1f, 0x05, 0xac, 0x72, 0xa2, 0x00, 0xef, 0xe0, 0xbf, 0xd6, 0x22, 0x85,
+  0x20, 0x80, 0x6f, 0xf0, 0xdf, 0xef, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05,
+  0x98, 0x72, 0xa2, 0x00, 0xef, 0xe0, 0x5f, 0xd5, 0x22, 0x85, 0x20, 0x80,
+  0x6f, 0xf0, 0x7f, 0xee, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x20, 0x72,
+  0xa2, 0x00, 0xef, 0xe0, 0xff, 0xd3, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0,
+  0x1f, 0xed, 0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x40, 0x72, 0xa2, 0x00,
+  0xef, 0xe0, 0x9f, 0xd2, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0xbf, 0xeb,
+  0x28, 0x80, 0x2a, 0x84, 0x1f, 0x05, 0x78, 0x72, 0xa2, 0x00, 0xef, 0xe0,
+  0x3f, 0xd1, 0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0x5f, 0xea, 0x28, 0x80,
+  0x2a, 0x84, 0x1f, 0x05, 0xe4, 0x71, 0xa2, 0x00, 0xef, 0xe0, 0xdf, 0xcf,
+  0x22, 0x85, 0x20, 0x80, 0x6f, 0xf0, 0xff, 0xe8, 0x28, 0x80, 0x2a, 0x84,
+  0x1f, 0x05, 0x60, 0x72, 0xa2, 0x00, 0xef, 0xe0, 0x7f, 0xce, 0x22, 0x85,
+  0x20, 0x80, 0x6f, 0xf0, 0x9f, 0xe7, 0x18, 0x80, 0xef, 0xf0, 0xff, 0xbd,
+  0xaa, 0x85, 0x1f, 0x05, 0xb8, 0x71, 0xa2, 0x00, 0xef, 0xe0, 0xdf, 0xcc,
+  0x01, 0xa0, 0x18, 0x80, 0xef, 0xf0, 0xbf, 0xbc, 0xaa, 0x85, 0x1f, 0x05,
+  0x58, 0x78, 0xa2, 0x00, 0xef, 0xe0, 0x9f, 0xcb, 0x01, 0xa0, 0x18, 0x80,
+  0x35, 0x22, 0x10, 0x80, 0xe1, 0xa8, 0x18, 0x81, 0x01, 0x45, 0x2e, 0xc6,
+  0x0d, 0x2a, 0xb2, 0x45, 0x2e, 0x85, 0xef, 0xf0, 0xdf, 0xfe, 0x10, 0x81,
+  0x6f, 0xd0, 0x7f, 0xa5, 0x58, 0x84, 0xb2, 0x86, 0x2a, 0x89, 0xae, 0x84,
+  0x32, 0x84, 0x2e, 0x86, 0xaa, 0x85, 0x1f, 0x05, 0x80, 0x78, 0xa2, 0x00,
+  0xef, 0xe0, 0x1f, 0xc8, 0xef, 0xc0, 0x3f, 0xcf, 0x9f, 0x07, 0x90, 0x69,
+  0xa0, 0x00, 0x98, 0x23, 0xaa, 0x89, 0x21, 0xe3, 0x05, 0x47, 0x98, 0xa3,
+  0x23, 0x00, 0x21, 0x03, 0x26, 0xd2, 0xef, 0xc0, 0xbf, 0xf5, 0x2a, 0xd4,
+  0x08, 0x10, 0x22, 0xd6, 0xcd, 0x28, 0x13, 0x06, 0x00, 0x02, 0x81, 0x45,
+  0x08, 0x10, 0x02, 0xc8, 0x02, 0xca, 0x02, 0xcc, 0x02, 0xce, 0xef, 0xb0,
+  0x6f, 0xe6, 0x22, 0xda, 0xf3, 0x27, 0x10, 0x34, 0x3e, 0xdc, 0x8a, 0x87,
+  0x68, 0x00, 0x3e, 0xc6, 0x09, 0x22, 0x08, 0x10, 0x31, 0x2a, 0x9f, 0x07,
+  0x94, 0x69, 0xa0, 0x00, 0x9c, 0x43, 0x91, 0xc3, 0x20, 0xba, 0x02, 0x16,
+  0xe9, 0x82, 0x97, 0x89, 0x65, 0x8d, 0x05, 0x09, 0x45, 0xef, 0xf0, 0x3f,
+  0xf7, 0x4e, 0x85, 0xef, 0xc0, 0x5f, 0xc9, 0x54, 0x84, 0x9f, 0x07, 0x98,
+  0x24, 0xa0, 0x00, 0x03, 0xa3, 0x07, 0x00, 0x63, 0x05, 0x03, 0x00, 0x13,
+  0x86, 0xb0, 0xff, 0x02, 0x83, 0x18, 0x81, 0x85, 0x47, 0xa3, 0x07, 0xf1,
+  0x00, 0x83, 0x47, 0xf1, 0x00, 0x81, 0x9f, 0xed, 0xff, 0x14, 0x81, 0x93,
+  0x06, 0xc0, 0x0f, 0x1f, 0x06, 0xdc, 0x24, 0xa0, 0x00, 0x93, 0x05, 0xc0,
+  0x0f, 0x1f, 0x05, 0x98, 0x69, 0xa0, 0x00, 0x15, 0xaa, 0x37, 0x27, 0xa0,
+  0x00, 0x93, 0x07, 0xc7, 0x4d, 0x83, 0xd7, 0x87, 0x0d, 0x89, 0x66, 0x13,
+  0x86, 0x06, 0x04, 0x13, 0x07, 0xc7, 0x4d, 0x63, 0x89, 0xc7, 0x02, 0x63,
+  0x6c, 0xf6, 0x00, 0x8d, 0xc7, 0x85, 0x06, 0x63, 0x83, 0xd7, 0x02, 0x9f,
+  0x07, 0xaf, 0xbe, 0xad, 0xde, 0x23, 0x24, 0xf7, 0x0e, 0x82, 0x80, 0xa1,
+  0x66, 0x85, 0x06, 0x63, 0x89, 0xd7, 0x00, 0x9f, 0x06, 0xf0, 0xf0, 0x00,
+  0x00, 0x63, 0x84, 0xd7, 0x00, 0x91, 0x66, 0xe9, 0xbf, 0x9f, 0x07, 0xad,
+  0xde, 0xad, 0xde, 0xf9, 0xbf, 0x9f, 0x07, 0xdc, 0x24, 0xa0, 0x00, 0x23,
+  0x8d, 0x07, 0x0c, 0x23, 0x9c, 0xa7, 0x0c, 0x6f, 0xf0, 0xdf, 0xf8, 0x9f,
+  0x07, 0xdc, 0x24, 0xa0, 0x00, 0x23, 0x8d, 0xa7, 0x0c, 0x82, 0x80, 0x18,
+  0x80, 0x2a, 0x86, 0x1f, 0x05, 0xdc, 0x24, 0xa0, 0x00, 0xc1, 0x46, 0xc1,
+  0x45, 0x13, 0x05, 0x45, 0x0a, 0x4d, 0x28, 0x10, 0x80, 0x6f, 0xf0, 0x7f,
+  0xf6, 0x18, 0x80, 0x2a, 0x86, 0x93, 0x06, 0x00, 0x09, 0x93, 0x05, 0x00,
+  0x09, 0x1f, 0x05, 0xdc, 0x24, 0xa0, 0x00, 0x61, 0x28, 0x10, 0x80, 0x6f,
+  0xf0, 0xdf, 0xf4, 0x11, 0xcd, 0x18, 0x80, 0x2a, 0x86, 0x1f, 0x05, 0xdc,
+  0x24, 0xa0, 0x00, 0xd1, 0x46, 0xd1, 0x45, 0x13, 0x05, 0x05, 0x09, 0xb5,
+  0x28, 0x10, 0x80, 0x6f, 0xf0, 0x1f, 0xf3, 0x82, 0x80, 0x58, 0x49, 0x9f,
+  0x07, 0xdc, 0x24, 0xa0, 0x00, 0x23, 0xa6, 0xe7, 0x08, 0x18, 0x4d, 0xd8,
+  0xcb, 0x6f, 0xf0, 0xbf, 0xf1, 0x63, 0x5b, 0xb0, 0x04, 0xaa, 0x87, 0x59,
+  0x48, 0x29, 0xc9, 0x18, 0x80, 0x32, 0x87, 0x2e, 0x86, 0x01, 0xeb, 0x81,
+  0x45, 0xef, 0xb0, 0xcf, 0xd0, 0x13, 0x08, 0x60, 0x09, 0x42, 0x85, 0x14,
+  0x80, 0x63, 0xf8, 0xd5, 0x00, 0x81, 0x45, 0xef, 0xb0, 0xaf, 0xcf, 0x13,
+  0x08, 0x20, 0x0a, 0xfd, 0xb7, 0x63, 0x76, 0xa7, 0x00, 0xb3, 0x05, 0xd7,
+  0x00, 0x63, 0x68, 0xb5, 0x00, 0x01, 0x48, 0xe3, 0xff, 0xe7, 0xfc, 0xbe,
+  0x96, 0xe3, 0x7c, 0xd7, 0xfc, 0x81, 0x45, 0x3e, 0x85, 0xef, 0xb0, 0x4f,
+  0xcd, 0x13, 0x08, 0x60, 0x0b, 0xe1, 0xb7, 0x13, 0x08, 0x20, 0x02, 0x42,
+  0x85, 0x82, 0x80, 0x63, 0xe3, 0xd5, 0x02, 0x0d, 0xc1, 0x05, 0xc2, 0x63,
+  0xcf, 0x05, 0x00, 0x89, 0xce, 0x63, 0x76, 0xa6, 0x00, 0xb3, 0x07, 0xd6,
+  0x00, 0x63, 0x7a, 0xf5, 0x00, 0x63, 0x76, 0xc5, 0x00, 0xb3, 0x07, 0xd5,
+  0x00, 0x63, 0x74, 0xf6, 0x00, 0x6f, 0xf0, 0xdf, 0xf7, 0x18, 0x80, 0xb2,
+  0x85, 0x36, 0x86, 0xef, 0xb0, 0x0f, 0xd4, 0x01, 0x45, 0x14, 0x80, 0xae,
+  0x87, 0x63, 0xc3, 0x05, 0x02, 0x28, 0x80, 0x2a, 0x84, 0x11, 0xc9, 0xb2,
+  0x85, 0x36, 0x86, 0x63, 0xe0, 0xd7, 0x02, 0xef, 0xb0, 0x6f, 0xc7, 0x01,
+  0x47, 0x3a, 0x85, 0x24, 0x80, 0x13, 0x07, 0x20, 0x02, 0xe5, 0xdd, 0x59,
+  0x47, 0xd5, 0xbf, 0x13, 0x07, 0x20, 0x02, 0x3a, 0x85, 0x82, 0x80, 0x13,
+  0x07, 0x20, 0x02, 0xfd, 0xd3, 0x3e, 0x86, 0xef, 0xb0, 0x2f, 0xc5, 0x13,
+  0x07, 0x20, 0x0a, 0xe9, 0xbf, 0x32, 0x87, 0x63, 0x46, 0xe0, 0x00, 0x9c,
+  0x42, 0x3e, 0x96, 0x90, 0xc2, 0x82, 0x80, 0x1c, 0x41, 0xfd, 0x17, 0x1c,
+  0xc1, 0x63, 0xd5, 0x07, 0x00, 0xfd, 0x57, 0x9c, 0xc2, 0x82, 0x80, 0x5c,
+  0x41, 0x7d, 0x17, 0x8c, 0xa3, 0x5c, 0x41, 0x85, 0x07, 0x5c, 0xc1, 0xe1,
+  0xbf, 0xd8, 0x9f, 0xb7, 0x8a, 0xa2, 0x00, 0x93, 0x87, 0xca, 0x8d, 0x1d,
+  0x71, 0x3e, 0xcc, 0x37, 0x8b, 0xa2, 0x00, 0xa9, 0x47, 0xaa, 0x8c, 0x32,
+  0x84, 0x02, 0xce, 0x02, 0xd0, 0x02, 0xd2, 0x3e, 0xd4, 0x02, 0xd6, 0x02,
+  0xd8, 0x02, 0xda, 0x02, 0xdc, 0x02, 0xde, 0x82, 0xc0, 0x82, 0xc2, 0x23,
+  0x14, 0x01, 0x04, 0x02, 0xca, 0x01, 0x47, 0x93, 0x8a, 0xca, 0x8d, 0x9f,
+  0x0b, 0xf0, 0x78, 0xa2, 0x00, 0x13, 0x0b, 0x8b, 0x8a, 0x1f, 0x0c, 0x9c,
+  0x24, 0xa0, 0x00, 0x1f, 0x09, 0xc8, 0x78, 0xa2, 0x00, 0x9c, 0x21, 0x81,
+  0xc7, 0xd2, 0x46, 0x63, 0xd9, 0x06, 0x00, 0x19, 0xc3, 0x3b, 0x16, 0x37,
+  0x07, 0x52, 0x45, 0x13, 0x01, 0x01, 0x25, 0xd4, 0x80, 0xb3, 0x86, 0xfb,
+  0x00, 0x94, 0x22, 0x13, 0x8a, 0x15, 0x00, 0xdb, 0xd6, 0xdb, 0x08, 0xba,
+  0x96, 0x83, 0xc9, 0x06, 0x10, 0x3b, 0xfe, 0x29, 0x08, 0x9b, 0x06, 0x3b,
+  0x05, 0x94, 0x42, 0x82, 0x86, 0x03, 0xa7, 0x0c, 0x00, 0x7d, 0x17, 0x23,
+  0xa0, 0xec, 0x00, 0x63, 0x40, 0x07, 0x02, 0x03, 0xa7, 0x4c, 0x00, 0x1c,
+  0xa3, 0x83, 0xa7, 0x4c, 0x00, 0x85, 0x07, 0x23, 0xa2, 0xfc, 0x00, 0xd2,
+  0x47, 0x85, 0x07, 0x3e, 0xca, 0xd2, 0x85, 0x4e, 0x87, 0x45, 0xb7, 0xfd,
+  0x57, 0xdd, 0xbf, 0xfd, 0x57, 0x82, 0xc2, 0x02, 0xd0, 0x02, 0xd6, 0x02,
+  0xd8, 0x3e, 0xda, 0x02, 0xd2, 0x02, 0xdc, 0x02, 0xde, 0xd5, 0xb7, 0x13,
+  0x07, 0xb0, 0x02, 0x63, 0x89, 0xe7, 0x02, 0x63, 0x6a, 0xf7, 0x00, 0x3b,
+  0x88, 0x07, 0x20, 0xbb, 0x94, 0xf7, 0x23, 0xb2, 0x57, 0x93, 0xe7, 0x07,
+  0x08, 0x21, 0xa8, 0xbb, 0x88, 0x07, 0x2d, 0xbb, 0x90, 0xf7, 0x30, 0xb2,
+  0x57, 0x93, 0xe7, 0x87, 0x00, 0x21, 0xa0, 0xb2, 0x57, 0x93, 0xe7, 0x27,
+  0x00, 0x3e, 0xd6, 0x7d, 0xb7, 0xb2, 0x57, 0x93, 0xe7, 0x17, 0x00, 0xdd,
+  0xbf, 0xb2, 0x57, 0x93, 0xe7, 0x47, 0x00, 0xfd, 0xb7, 0xbb, 0x93, 0x07,
+  0x2a, 0x14, 0x40, 0x11, 0x04, 0x36, 0xd8, 0x85, 0x46, 0x36, 0xdc, 0xe2,
+  0x56, 0x95, 0xe6, 0xbb, 0x01, 0x07, 0x03, 0x02, 0xd8, 0xc2, 0x56, 0x1f,
+  0x07, 0x14, 0xae, 0x47, 0x01, 0x63, 0x54, 0xd7, 0x00, 0x7d, 0x55, 0x35,
+  0xb7, 0x13, 0x97, 0x26, 0x00, 0x93, 0x87, 0x07, 0xfd, 0x36, 0x97, 0x81,
+  0x9f, 0x9b, 0x87, 0xe7, 0x02, 0x3e, 0xd8, 0x8d, 0xb7, 0xc2, 0x57, 0x63,
+  0xd9, 0x07, 0x00, 0x32, 0x57, 0xb3, 0x07, 0xf0, 0x40, 0x3e, 0xd8, 0x13,
+  0x67, 0x47, 0x00, 0x3a, 0xd6, 0x42, 0x57, 0x9f, 0x07, 0xc8, 0xcc, 0xcc,
+  0x0c, 0xe3, 0xd2, 0xe7, 0xf4, 0xe1, 0xb7, 0x02, 0xda, 0x35, 0xbf, 0xbb,
+  0x93, 0x07, 0x2a, 0x18, 0x40, 0x11, 0x04, 0x3a, 0xda, 0x05, 0x47, 0x3a,
+  0xde, 0xf2, 0x56, 0x52, 0x57, 0x85, 0xe2, 0x9f, 0x06, 0x14, 0xae, 0x47,
+  0x01, 0xe3, 0xc4, 0xe6, 0xfa, 0x93, 0x16, 0x27, 0x00, 0x93, 0x87, 0x07,
+  0xfd, 0x36, 0x97, 0x81, 0x9f, 0x9b, 0x87, 0xe7, 0x02, 0x3e, 0xda, 0x29,
+  0xb7, 0x63, 0x54, 0x07, 0x00, 0xfd, 0x57, 0x3e, 0xda, 0x52, 0x57, 0x55,
+  0xbf, 0x13, 0x07, 0xa0, 0x06, 0x63, 0x87, 0xe7, 0x08, 0x63, 0x60, 0xf7,
+  0x04, 0x13, 0x07, 0xc0, 0x04, 0x63, 0x86, 0xe7, 0x04, 0x63, 0x6e, 0xf7,
+  0x00, 0x3b, 0x99, 0xb7, 0x49, 0x9c, 0x31, 0xbb, 0x9f, 0x17, 0x36, 0xbc,
+  0x21, 0x3b, 0x9d, 0x27, 0x34, 0xad, 0xd0, 0x02, 0x17, 0xe8, 0x13, 0x8a,
+  0x35, 0x00, 0x21, 0x67, 0x91, 0xa0, 0xbb, 0x8f, 0x07, 0x5a, 0x3b, 0x92,
+  0xb7, 0x68, 0x94, 0x31, 0x32, 0x57, 0x63, 0x97, 0xf6, 0x0a, 0x13, 0x8a,
+  0x25, 0x00, 0x89, 0x67, 0x81, 0xa0, 0x13, 0x07, 0x40, 0x07, 0x63, 0x86,
+  0xe7, 0x04, 0x63, 0x6b, 0xf7, 0x00, 0x3b, 0x89, 0x07, 0x6c, 0x3b, 0x99,
+  0xa7, 0x71, 0xb2, 0x57, 0x1f, 0x07, 0x00, 0x14, 0x00, 0x00, 0x01, 0xa8,
+  0xbb, 0x82, 0x27, 0x77, 0xbb, 0x94, 0xa7, 0x7a, 0x37, 0x07, 0x02, 0x00,
+  0xb2, 0x57, 0xd9, 0x8f, 0xd9, 0xbd, 0x94, 0x31, 0x32, 0x57, 0x63, 0x97,
+  0xf6, 0x00, 0x13, 0x8a, 0x25, 0x00, 0x85, 0x67, 0x5d, 0x8f, 0x19, 0xa0,
+  0x13, 0x67, 0x07, 0x01, 0x3a, 0xd6, 0xb5, 0xb5, 0x37, 0x07, 0x04, 0x00,
+  0xf1, 0xbf, 0x41, 0x67, 0xe1, 0xbf, 0x3b, 0x96, 0x07, 0x33, 0xbc, 0x21,
+  0xbb, 0x9d, 0x07, 0x32, 0xb2, 0x57, 0x61, 0x77, 0x7d, 0x17, 0x13, 0x8a,
+  0x35, 0x00, 0xf9, 0x8f, 0x69, 0xbd, 0x13, 0x87, 0xc7, 0xf9, 0x93, 0x76,
+  0xf7, 0x0f, 0x3b, 0xf5, 0x06, 0x12, 0x1f, 0x07, 0x21, 0x08, 0x02, 0x00,
+  0x33, 0x57, 0xd7, 0x00, 0x05, 0x8b, 0xe3, 0x18, 0x07, 0xe2, 0x93, 0xf7,
+  0xf7, 0x0d, 0x3b, 0x8a, 0x87, 0x58, 0x83, 0xa7, 0x0c, 0x00, 0xfd, 0x17,
+  0x23, 0xa0, 0xfc, 0x00, 0x63, 0xdc, 0x07, 0x00, 0xfd, 0x57, 0x2d, 0xa0,
+  0x13, 0x67, 0x07, 0x02, 0x45, 0xb7, 0xb2, 0x57, 0x1f, 0x07, 0x00, 0x08,
+  0x00, 0x00, 0xb5, 0xbf, 0x83, 0xa7, 0x4c, 0x00, 0x13, 0x07, 0x90, 0x04,
+  0x98, 0xa3, 0x83, 0xa7, 0x4c, 0x00, 0x85, 0x07, 0x23, 0xa2, 0xfc, 0x00,
+  0xd2, 0x47, 0x85, 0x07, 0x3e, 0xca, 0x81, 0x49, 0xdd, 0xb3, 0x3b, 0xf2,
+  0x47, 0x68, 0x13, 0x07, 0x50, 0x06, 0xe3, 0xf2, 0xe7, 0xe6, 0x13, 0x07,
+  0x30, 0x05, 0x63, 0x89, 0xe7, 0x1a, 0x63, 0x6f, 0xf7, 0x08, 0x13, 0x07,
+  0x30, 0x04, 0x63, 0x8f, 0xe7, 0x14, 0x63, 0xe6, 0xe7, 0x00, 0x93, 0x87,
+  0xb7, 0xfb, 0x3b, 0xe1, 0x97, 0x03, 0x82, 0x57, 0x42, 0x56, 0x1d, 0x8e,
+  0x96, 0x47, 0x1d, 0x8e, 0xb2, 0x57, 0xb2, 0xc0, 0xb1, 0x8b, 0x89, 0xeb,
+  0x63, 0x58, 0xc0, 0x00, 0x54, 0x08, 0x93, 0x05, 0x00, 0x02, 0x66, 0x85,
+  0xef, 0xf0, 0x3f, 0xcc, 0x96, 0x46, 0x63, 0x5e, 0xd0, 0x00, 0x3c, 0x08,
+  0x33, 0x86, 0xf6, 0x00, 0x03, 0xa7, 0x0c, 0x00, 0x7d, 0x17, 0x23, 0xa0,
+  0xec, 0x00, 0x63, 0x5e, 0x07, 0x4a, 0xfd, 0x57, 0x3e, 0xca, 0xb2, 0x57,
+  0xb1, 0x8b, 0xbb, 0x95, 0x07, 0x08, 0x06, 0x46, 0x63, 0x58, 0xc0, 0x00,
+  0x54, 0x08, 0x93, 0x05, 0x00, 0x03, 0x66, 0x85, 0xef, 0xf0, 0xbf, 0xc8,
+  0x92, 0x57, 0x63, 0x8c, 0x07, 0x4a, 0xfd, 0x57, 0x3e, 0xca, 0xd2, 0x47,
+  0xe3, 0xc9, 0x07, 0xd4, 0xb2, 0x57, 0x91, 0x8b, 0xe3, 0x85, 0x07, 0xd4,
+  0x06, 0x46, 0xe3, 0x52, 0xc0, 0xd4, 0x54, 0x08, 0x93, 0x05, 0x00, 0x02,
+  0x66, 0x85, 0xef, 0xf0, 0x1f, 0xc6, 0x15, 0xbb, 0x13, 0x07, 0x30, 0x06,
+  0x63, 0x8c, 0xe7, 0x0c, 0x63, 0x61, 0xf7, 0x06, 0xbb, 0x9b, 0xd7, 0x58,
+  0x41, 0x47, 0x3a, 0xd4, 0x4a, 0xcc, 0x32, 0x57, 0xbb, 0x85, 0x57, 0x58,
+  0x3b, 0x95, 0x57, 0x70, 0x9f, 0x07, 0x90, 0x40, 0x00, 0x00, 0x5d, 0x8f,
+  0x89, 0x47, 0xbe, 0xc2, 0xe1, 0x77, 0x93, 0xc7, 0x07, 0x83, 0x02, 0xda,
+  0x3a, 0xd6, 0x23, 0x14, 0xf1, 0x04, 0xb2, 0x57, 0x25, 0x67, 0x7d, 0x8f,
+  0x63, 0x0a, 0x07, 0x16, 0x1d, 0x04, 0x93, 0x77, 0x84, 0xff, 0x13, 0x84,
+  0x87, 0x00, 0x84, 0x43, 0x03, 0xad, 0x47, 0x00, 0x45, 0xa2, 0x13, 0x07,
+  0x00, 0x07, 0xe3, 0x8b, 0xe7, 0xfa, 0x63, 0x63, 0xf7, 0x02, 0x3b, 0x82,
+  0x07, 0x69, 0x3b, 0x95, 0xc7, 0x6f, 0x93, 0x06, 0x90, 0x06, 0x32, 0x57,
+  0x63, 0x86, 0xd7, 0x00, 0x63, 0xed, 0xf6, 0x10, 0xbb, 0x90, 0xf7, 0x64,
+  0x13, 0x67, 0x07, 0x04, 0x3a, 0xd6, 0x11, 0xaa, 0xbb, 0x89, 0xf7, 0x75,
+  0x3b, 0x82, 0xe7, 0x78, 0xbb, 0x9b, 0xb7, 0x73, 0xb2, 0x57, 0x14, 0x40,
+  0x93, 0x04, 0x44, 0x00, 0x13, 0xf7, 0x77, 0xff, 0x3a, 0xd6, 0x1f, 0x07,
+  0x10, 0x08, 0x00, 0x00, 0xf9, 0x8f, 0x36, 0xce, 0x52, 0x57, 0xd9, 0xeb,
+  0x89, 0xe6, 0x9f, 0x07, 0xa4, 0x24, 0xa0, 0x00, 0x3e, 0xce, 0x72, 0x45,
+  0xbb, 0x1b, 0x17, 0xff, 0xef, 0xb0, 0xef, 0xb4, 0x63, 0x5b, 0x05, 0x06,
+  0x01, 0x45, 0x85, 0xa8, 0xb2, 0x57, 0x05, 0x67, 0x93, 0x06, 0x07, 0x83,
+  0xfd, 0x8e, 0x89, 0xe6, 0x13, 0x07, 0x07, 0x80, 0xd9, 0x8f, 0x3e, 0xd6,
+  0xb2, 0x57, 0x05, 0x46, 0x32, 0xd0, 0x93, 0xf5, 0x77, 0xff, 0x2e, 0xd6,
+  0x9f, 0x05, 0x10, 0x08, 0x00, 0x00, 0xed, 0x8f, 0x13, 0x07, 0x44, 0x00,
+  0x14, 0x40, 0x99, 0xc7, 0xfc, 0x00, 0xb6, 0xc6, 0x3e, 0xce, 0x32, 0xd2,
+  0x3a, 0x84, 0xa5, 0xbd, 0xfc, 0x00, 0x23, 0x06, 0xd1, 0x04, 0x3e, 0xce,
+  0x02, 0xd2, 0xcd, 0xbf, 0xb2, 0x57, 0x05, 0x67, 0x93, 0x06, 0x07, 0x83,
+  0xfd, 0x8e, 0xbd, 0xfa, 0x13, 0x07, 0x07, 0x80, 0xd9, 0x8f, 0x3e, 0xd6,
+  0xb5, 0xb7, 0x2a, 0x97, 0xaa, 0x87, 0x63, 0x84, 0xe7, 0x00, 0x94, 0x23,
+  0x91, 0xe6, 0x33, 0x85, 0xa7, 0x40, 0x2a, 0xd0, 0x26, 0x84, 0x81, 0xb5,
+  0x85, 0x07, 0xf5, 0xb7, 0x85, 0x47, 0x3e, 0xd2, 0x89, 0xe6, 0x9f, 0x07,
+  0xac, 0x24, 0xa0, 0x00, 0x3e, 0xce, 0xf2, 0x46, 0x81, 0x47, 0x63, 0x84,
+  0xe7, 0x00, 0x90, 0x42, 0x01, 0xea, 0x37, 0x07, 0x00, 0x20, 0x63, 0xe3,
+  0xe7, 0x00, 0x81, 0x47, 0x3e, 0xd0, 0xc9, 0xbf, 0x85, 0x07, 0x91, 0x06,
+  0xdd, 0xb7, 0x56, 0xcc, 0x13, 0x77, 0x07, 0x08, 0xe3, 0x0b, 0x07, 0xee,
+  0x13, 0x07, 0x00, 0x03, 0x23, 0x04, 0xe1, 0x04, 0x62, 0x47, 0x18, 0x2b,
+  0xa3, 0x04, 0xe1, 0x04, 0x09, 0x47, 0xba, 0xc2, 0xf9, 0xbd, 0x3b, 0x84,
+  0x07, 0x6f, 0x3b, 0x9a, 0xa7, 0x75, 0xa9, 0x47, 0x3e, 0xd4, 0x4a, 0xcc,
+  0x79, 0xbd, 0xa1, 0x47, 0x3e, 0xd4, 0x4a, 0xcc, 0x93, 0x77, 0x07, 0x08,
+  0xe3, 0x89, 0x07, 0xe8, 0x13, 0x67, 0x07, 0x20, 0x3a, 0xd6, 0x61, 0xb5,
+  0x93, 0xf6, 0x07, 0x01, 0x13, 0xf7, 0x07, 0x04, 0x89, 0xc6, 0x04, 0x40,
+  0x11, 0x04, 0x4d, 0xcb, 0x65, 0xa0, 0x93, 0x96, 0x27, 0x01, 0x63, 0xd9,
+  0x06, 0x08, 0x14, 0x40, 0x01, 0x4d, 0x11, 0x04, 0x93, 0xf4, 0xf6, 0x0f,
+  0x11, 0xcf, 0xe2, 0x06, 0xe1, 0x86, 0x63, 0xdb, 0x06, 0x00, 0x93, 0xc4,
+  0xf4, 0xff, 0x81, 0x9c, 0x85, 0x04, 0x93, 0xe7, 0x07, 0x10, 0x13, 0xdd,
+  0xf4, 0x41, 0x3e, 0xd6, 0xb2, 0x57, 0xa6, 0x8d, 0x6a, 0x87, 0x93, 0xf6,
+  0x07, 0x04, 0x89, 0xce, 0x63, 0x5c, 0x0d, 0x00, 0xb3, 0x0d, 0x90, 0x40,
+  0xb3, 0x36, 0xb0, 0x01, 0x33, 0x07, 0xa0, 0x41, 0x93, 0xe7, 0x07, 0x10,
+  0x15, 0x8f, 0x3e, 0xd6, 0xb2, 0x56, 0xb7, 0x97, 0x04, 0x00, 0xf5, 0x8f,
+  0x91, 0xe3, 0x01, 0x47, 0x13, 0x08, 0xc1, 0x24, 0x42, 0xce, 0xb3, 0xe7,
+  0xed, 0x00, 0xc1, 0xe3, 0x82, 0xc2, 0x02, 0xd0, 0x52, 0x57, 0x85, 0x46,
+  0x63, 0x4f, 0x07, 0x00, 0xb2, 0x57, 0x93, 0x96, 0x17, 0x01, 0x63, 0xc4,
+  0x06, 0x00, 0xdd, 0x9b, 0x3e, 0xd6, 0x93, 0x07, 0x00, 0x20, 0x63, 0xd3,
+  0xe7, 0x00, 0x3e, 0xda, 0xd2, 0x56, 0x13, 0x06, 0x00, 0x03, 0x69, 0xaa,
+  0x93, 0xf6, 0x91, 0x1e, 0x02, 0x18, 0xe7, 0x07, 0x02, 0x81, 0xce, 0x04,
+  0x40, 0x11, 0x04, 0x11, 0xc7, 0xc2, 0x04, 0xc1, 0x84, 0x13, 0xdd, 0xf4,
+  0x41, 0x51, 0xb7, 0xa1, 0x9c, 0x01, 0x4d, 0xbd, 0xbf, 0x93, 0x96, 0xf7,
+  0x00, 0x63, 0xd7, 0x06, 0x00, 0x04, 0x40, 0x11, 0x04, 0x13, 0xdd, 0xf4,
+  0x41, 0xb5, 0xb7, 0x93, 0x96, 0xe7, 0x00, 0x63, 0xdb, 0x06, 0x00, 0x04,
+  0x40, 0x93, 0x07, 0x44, 0x00, 0x13, 0xdd, 0xf4, 0x41, 0x11, 0xe3, 0x01,
+  0x4d, 0x3e, 0x84, 0x89, 0xbf, 0x93, 0x96, 0xd7, 0x00, 0xe3, 0xdb, 0x06,
+  0xf0, 0x61, 0xbb, 0xa2, 0x57, 0x49, 0xef, 0xbb, 0x91, 0x17, 0x0a, 0xa9,
+  0x46, 0x25, 0x46, 0x72, 0x47, 0x93, 0x07, 0xf7, 0xff, 0x3e, 0xce, 0xb3,
+  0xf7, 0xdd, 0x02, 0xca, 0x97, 0x9c, 0x23, 0xa3, 0x0f, 0xf7, 0xfe, 0x93,
+  0xd7, 0x2d, 0x00, 0x9b, 0x87, 0xb7, 0x43, 0x9b, 0x87, 0xf7, 0x48, 0x9b,
+  0x87, 0xf7, 0x50, 0x9b, 0x87, 0xf7, 0x60, 0x8d, 0x83, 0x13, 0x95, 0x27,
+  0x00, 0x3e, 0x95, 0x1b, 0x95, 0xad, 0x02, 0x63, 0x7c, 0xa6, 0x04, 0x85,
+  0x07, 0xbe, 0x8d, 0xd1, 0xb7, 0xbb, 0x89, 0x07, 0x10, 0x3b, 0x90, 0x17,
+  0x08, 0x72, 0x47, 0x93, 0x07, 0xf7, 0xff, 0x3e, 0xce, 0x93, 0xf7, 0x7d,
+  0x00, 0xca, 0x97, 0x9c, 0x23, 0x93, 0xdd, 0x3d, 0x00, 0xa3, 0x0f, 0xf7,
+  0xfe, 0xe3, 0x94, 0x0d, 0xfe, 0x05, 0xa0, 0x72, 0x47, 0x93, 0xf6, 0xfd,
+  0x00, 0x93, 0xdd, 0x4d, 0x00, 0x93, 0x07, 0xf7, 0xff, 0x3e, 0xce, 0xe2,
+  0x47, 0xb6, 0x97, 0x9c, 0x23, 0xa3, 0x0f, 0xf7, 0xfe, 0xe3, 0x93, 0x0d,
+  0xfe, 0xf2, 0x47, 0x33, 0x08, 0xf8, 0x40, 0x42, 0xd0, 0xc5, 0xbd, 0xdd,
+  0xf7, 0xd5, 0xbf, 0xbb, 0x8c, 0x07, 0x0a, 0x3b, 0x8b, 0x17, 0x10, 0xbb,
+  0x9a, 0xf7, 0x08, 0xf2, 0x46, 0x93, 0x87, 0xf6, 0xff, 0x3e, 0xce, 0x93,
+  0xf7, 0x7d, 0x00, 0xca, 0x97, 0x9c, 0x23, 0x93, 0xdd, 0x3d, 0x00, 0x9b,
+  0xad, 0xed, 0x3a, 0x0d, 0x83, 0xa3, 0x8f, 0xf6, 0xfe, 0xb3, 0xe7, 0xed,
+  0x00, 0xf9, 0xff, 0xc9, 0xb7, 0xf2, 0x47, 0x29, 0x46, 0x6e, 0x85, 0x93,
+  0x86, 0xf7, 0xff, 0x36, 0xce, 0xba, 0x85, 0x81, 0x46, 0x42, 0xc6, 0x3e,
+  0xc4, 0x3a, 0xc2, 0xef, 0xa0, 0xdf, 0x90, 0x4a, 0x95, 0x14, 0x21, 0x12,
+  0x47, 0xa2, 0x47, 0x6e, 0x85, 0xba, 0x85, 0xa3, 0x8f, 0xd7, 0xfe, 0x29,
+  0x46, 0x81, 0x46, 0xef, 0xa0, 0x1f, 0x8f, 0x2e, 0x87, 0xc9, 0x8d, 0xaa,
+  0x8d, 0x32, 0x48, 0xf9, 0xf1, 0x51, 0xb7, 0xf2, 0x46, 0x13, 0xf6, 0xfd,
+  0x00, 0x93, 0xdd, 0x4d, 0x00, 0x93, 0x87, 0xf6, 0xff, 0x3e, 0xce, 0xe2,
+  0x47, 0x9b, 0xad, 0xed, 0x38, 0x11, 0x83, 0xb2, 0x97, 0x9c, 0x23, 0xa3,
+  0x8f, 0xf6, 0xfe, 0xb3, 0xe7, 0xed, 0x00, 0xf1, 0xff, 0xb1, 0xbf, 0xf2,
+  0x47, 0x13, 0x87, 0xf7, 0xff, 0x3a, 0xce, 0xa3, 0x8f, 0xc7, 0xfe, 0x82,
+  0x57, 0x85, 0x07, 0x3e, 0xd0, 0x02, 0x57, 0xe3, 0x46, 0xd7, 0xfe, 0xb2,
+  0x57, 0x93, 0xf7, 0x07, 0x20, 0x85, 0xc3, 0xf2, 0x47, 0x01, 0xc7, 0x98,
+  0x23, 0x3b, 0x06, 0x07, 0x30, 0x13, 0x87, 0xf7, 0xff, 0x3a, 0xce, 0x13,
+  0x07, 0x00, 0x03, 0xa3, 0x8f, 0xe7, 0xfe, 0x82, 0x57, 0x85, 0x07, 0x3e,
+  0xd0, 0xb2, 0x57, 0x13, 0xf7, 0x07, 0x04, 0x11, 0xcb, 0x13, 0xf7, 0x07,
+  0x10, 0x0d, 0xc7, 0x13, 0x07, 0xd0, 0x02, 0x23, 0x04, 0xe1, 0x04, 0x05,
+  0x47, 0xba, 0xc2, 0xb3, 0xe4, 0xa4, 0x01, 0xe3, 0x9e, 0x04, 0xb2, 0x13,
+  0x97, 0x17, 0x01, 0xe3, 0x5a, 0x07, 0xb2, 0x15, 0x47, 0xdd, 0x9b, 0x62,
+  0xce, 0x3a, 0xd0, 0x3e, 0xd6, 0x1d, 0xb6, 0x13, 0xf7, 0x17, 0x00, 0x01,
+  0xc7, 0x13, 0x07, 0xb0, 0x02, 0xc9, 0xbf, 0x13, 0xf7, 0x27, 0x00, 0x71,
+  0xdb, 0x13, 0x07, 0x00, 0x02, 0xd9, 0xb7, 0x03, 0xa7, 0x4c, 0x00, 0x83,
+  0xc5, 0x07, 0x03, 0x85, 0x07, 0x0c, 0xa3, 0x03, 0xa7, 0x4c, 0x00, 0x05,
+  0x07, 0x23, 0xa2, 0xec, 0x00, 0xe3, 0x12, 0xf6, 0xb2, 0xd2, 0x47, 0xb6,
+  0x97, 0x35, 0xb6, 0xf2, 0x45, 0x82, 0x54, 0x03, 0xa7, 0x0c, 0x00, 0xae,
+  0x87, 0xb3, 0x86, 0x95, 0x00, 0x63, 0x49, 0x97, 0x06, 0xbb, 0xdd, 0x04,
+  0x0c, 0xae, 0x87, 0x19, 0xa8, 0x03, 0xa7, 0x4c, 0x00, 0x94, 0x23, 0x85,
+  0x07, 0x14, 0xa3, 0x03, 0xa7, 0x4c, 0x00, 0x05, 0x07, 0x23, 0xa2, 0xec,
+  0x00, 0x33, 0x87, 0xb7, 0x40, 0xe3, 0x44, 0x97, 0xfe, 0x83, 0xa7, 0x0c,
+  0x00, 0x85, 0x8f, 0x23, 0xa0, 0xfc, 0x00, 0xd2, 0x47, 0xbe, 0x94, 0x26,
+  0xca, 0x29, 0xb6, 0x03, 0xa5, 0x4c, 0x00, 0x26, 0x86, 0xef, 0xa0, 0x5f,
+  0xc7, 0x83, 0xa7, 0x4c, 0x00, 0xa6, 0x97, 0x23, 0xa2, 0xfc, 0x00, 0xe9,
+  0xbf, 0x03, 0xa7, 0x0c, 0x00, 0x7d, 0x17, 0x23, 0xa0, 0xec, 0x00, 0xe3,
+  0x42, 0x07, 0xae, 0x03, 0xa7, 0x4c, 0x00, 0x90, 0x23, 0x85, 0x07, 0x10,
+  0xa3, 0x03, 0xa7, 0x4c, 0x00, 0x05, 0x07, 0x23, 0xa2, 0xec, 0x00, 0x33,
+  0x87, 0xf6, 0x40, 0xe3, 0x4d, 0xe0, 0xfc, 0x65, 0xbf, 0x38, 0x81, 0xae,
+  0x84, 0x2a, 0x84, 0xb2, 0x85, 0x2a, 0xc6, 0x36, 0x86, 0x28, 0x00, 0x26,
+  0xc4, 0xef, 0xf0, 0xef, 0xf5, 0x63, 0x4b, 0x05, 0x00, 0xa2, 0x47, 0xfd,
+  0x17, 0x3e, 0xc4, 0x63, 0xc6, 0x07, 0x00, 0xb2, 0x47, 0x23, 0x80, 0x07,
+  0x00, 0x34, 0x81, 0xa2, 0x47, 0x63, 0xd7, 0x07, 0x00, 0x26, 0x94, 0xa3,
+  0x0f, 0x04, 0xfe, 0x79, 0x55, 0xc5, 0xbf, 0x23, 0x00, 0x04, 0x00, 0x7d,
+  0x55, 0xe5, 0xb7, 0x28, 0x80, 0x32, 0x88, 0x2a, 0x84, 0xae, 0x87, 0x36,
+  0x86, 0x8d, 0xca, 0x19, 0xe1, 0x7d, 0x55, 0x24, 0x80, 0xf5, 0xdd, 0xe3,
+  0xcd, 0x05, 0xfe, 0xb7, 0x08, 0x00, 0x80, 0x93, 0xc8, 0xe8, 0xff, 0x63,
+  0xe0, 0x08, 0x03, 0xba, 0x86, 0x63, 0x72, 0xb8, 0x02, 0x93, 0x05, 0x18,
+  0x00, 0xef, 0xf0, 0x1f, 0xf9, 0x3b, 0x07, 0xf5, 0xfe, 0xe3, 0x5d, 0x05,
+  0xfc, 0x29, 0xa0, 0x69, 0xd9, 0xe1, 0xd9, 0xe3, 0xc7, 0x07, 0xfc, 0x23,
+  0x00, 0x04, 0x00, 0xd9, 0xb7, 0xef, 0xf0, 0x5f, 0xf7, 0xe5, 0xb7, 0xf9,
+  0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x51, 0xa2, 0x00, 0x00,
+  0x52, 0xa2, 0x00, 0x16, 0x52, 0xa2, 0x00, 0xc6, 0x52, 0xa2, 0x00, 0x2c,
+  0x52, 0xa2, 0x00, 0x42, 0x52, 0xa2, 0x00, 0x58, 0x52, 0xa2, 0x00, 0x6e,
+  0x52, 0xa2, 0x00, 0x84, 0x52, 0xa2, 0x00, 0x9a, 0x52, 0xa2, 0x00, 0xd4,
+  0x51, 0xa2, 0x00, 0xb0, 0x52, 0xa2, 0x00, 0xdc, 0x52, 0xa2, 0x00, 0xf2,
+  0x52, 0xa2, 0x00, 0xd4, 0x51, 0xa2, 0x00, 0x08, 0x53, 0xa2, 0x00, 0x1e,
+  0x53, 0xa2, 0x00, 0x34, 0x53, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x75, 0x71, 0x6e, 0xd0, 0x6a, 0xd2, 0x66, 0xd4, 0x62,
+  0xd6, 0x5e, 0xd8, 0x5a, 0xda, 0x56, 0xdc, 0x52, 0xde, 0xce, 0xc0, 0xca,
+  0xc2, 0xa6, 0xc4, 0xa2, 0xc6, 0xfe, 0xc8, 0xfa, 0xca, 0xf6, 0xcc, 0xf2,
+  0xce, 0xc6, 0xd0, 0xc2, 0xd2, 0xbe, 0xd4, 0xba, 0xd6, 0xb6, 0xd8, 0xb2,
+  0xda, 0xae, 0xdc, 0xaa, 0xde, 0x1e, 0xc1, 0x1a, 0xc3, 0x16, 0xc5, 0x06,
+  0xc7, 0x73, 0x2a, 0x20, 0xfc, 0x52, 0xc0, 0xf3, 0x29, 0x20, 0x34, 0x4e,
+  0xc2, 0x73, 0x29, 0x30, 0x34, 0x4a, 0xc4, 0x0e, 0xc6, 0xf3, 0x24, 0x78,
+  0x92, 0x02, 0x19, 0xe6, 0x00, 0x30, 0x26, 0xc8, 0x73, 0x24, 0x10, 0x34,
+  0x22, 0xca, 0x12, 0xcc, 0x0a, 0xce, 0x73, 0x70, 0x04, 0x30, 0x73, 0x10,
+  0x01, 0x34, 0x17, 0xc1, 0xfd, 0xff, 0x13, 0x01, 0xa1, 0x3e, 0xa1, 0x42,
+  0x63, 0x94, 0x59, 0x00, 0x6f, 0xa0, 0xef, 0xdc, 0x93, 0x92, 0x29, 0x00,
+  0x17, 0x03, 0x00, 0x00, 0x13, 0x03, 0x43, 0xf3, 0x97, 0x03, 0x00, 0x00,
+  0x93, 0x83, 0x43, 0xf7, 0x73, 0x25, 0x00, 0x34, 0x9a, 0x92, 0x63, 0xff,
+  0x72, 0x04, 0x83, 0xa2, 0x02, 0x00, 0xef, 0xe0, 0x7f, 0xef, 0x73, 0x21,
+  0x00, 0x34, 0x89, 0x62, 0x93, 0x82, 0x02, 0x80, 0x73, 0xa0, 0x02, 0x30,
+  0xd2, 0x42, 0x73, 0x90, 0x12, 0x34, 0x82, 0x5d, 0x12, 0x5d, 0xa2, 0x5c,
+  0x32, 0x5c, 0xc2, 0x5b, 0x52, 0x5b, 0xe2, 0x5a, 0x72, 0x5a, 0x86, 0x49,
+  0x16, 0x49, 0xa6, 0x44, 0x36, 0x44, 0xc6, 0x4f, 0x56, 0x4f, 0xe6, 0x4e,
+  0x76, 0x4e, 0x86, 0x58, 0x16, 0x58, 0xa6, 0x57, 0x36, 0x57, 0xc6, 0x56,
+  0x56, 0x56, 0xe6, 0x55, 0x76, 0x55, 0x8a, 0x43, 0x1a, 0x43, 0xaa, 0x42,
+  0xba, 0x40, 0x49, 0x61, 0x73, 0x00, 0x20, 0x30, 0x6f, 0xf0, 0x4f, 0x93,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf0, 0x5f, 0xf0,
+  0x6f, 0xf0, 0xaf, 0xa9, 0x6f, 0xf0, 0x6f, 0xa9, 0x6f, 0xf0, 0x2f, 0xa9,
+  0x6f, 0xf0, 0xef, 0xa8, 0x6f, 0xf0, 0xaf, 0xa8, 0x6f, 0xf0, 0x6f, 0xa8,
+  0x6f, 0xf0, 0x2f, 0xa8, 0x6f, 0xf0, 0xef, 0xa7, 0x6f, 0xf0, 0xaf, 0xa7,
+  0x6f, 0xf0, 0x6f, 0xa7, 0x6f, 0xf0, 0x2f, 0xa7, 0x6f, 0x00, 0x00, 0x17,
+  0x6f, 0xf0, 0xaf, 0xa6, 0x6f, 0xf0, 0x6f, 0xa6, 0x6f, 0xf0, 0x2f, 0xa6,
+  0x6f, 0xf0, 0xef, 0xa5, 0x6f, 0xf0, 0xaf, 0xa5, 0x6f, 0xf0, 0x6f, 0xa5,
+  0x6f, 0xf0, 0x2f, 0xa5, 0x6f, 0xf0, 0xef, 0xa4, 0x6f, 0xf0, 0xaf, 0xa4,
+  0x6f, 0xf0, 0x6f, 0xa4, 0x6f, 0xf0, 0x2f, 0xa4, 0x6f, 0xf0, 0xef, 0xa3,
+  0x6f, 0xf0, 0xaf, 0xa3, 0x6f, 0x00, 0x00, 0x20, 0x6f, 0x00, 0x80, 0x2a,
+  0x6f, 0x00, 0x00, 0x35, 0x6f, 0x00, 0x80, 0x3f, 0x6f, 0x00, 0x00, 0x4a,
+  0x6f, 0x00, 0x80, 0x54, 0x6f, 0x00, 0x00, 0x5f, 0x6f, 0x00, 0xc0, 0x5e,
+  0x6f, 0x00, 0x80, 0x5e, 0x6f, 0x00, 0x40, 0x5e, 0x6f, 0x00, 0x00, 0x5e,
+  0x6f, 0x00, 0xc0, 0x5d, 0x6f, 0x00, 0x80, 0x5d, 0x6f, 0x00, 0x40, 0x5d,
+  0x6f, 0x00, 0x00, 0x5d, 0x6f, 0x00, 0xc0, 0x5c, 0x6f, 0x00, 0x80, 0x5c,
+  0x6f, 0x00, 0x40, 0x5c, 0x6f, 0x00, 0x00, 0x5c, 0x6f, 0x00, 0xc0, 0x5b,
+  0x6f, 0x00, 0x80, 0x5b, 0x6f, 0x00, 0x40, 0x5b, 0x6f, 0x00, 0x00, 0x5b,
+  0x6f, 0x00, 0xc0, 0x5a, 0x6f, 0x00, 0x80, 0x5a, 0x6f, 0x00, 0x40, 0x5a,
+  0x6f, 0x00, 0x00, 0x5a, 0x6f, 0x00, 0xc0, 0x59, 0x6f, 0x00, 0x80, 0x59,
+  0x6f, 0x00, 0x40, 0x59, 0x6f, 0x00, 0x00, 0x59, 0x6f, 0x00, 0xc0, 0x58,
+  0x6f, 0x00, 0x80, 0x58, 0x6f, 0x00, 0x40, 0x58, 0x6f, 0x00, 0x00, 0x58,
+  0x6f, 0x00, 0xc0, 0x57, 0x6f, 0x00, 0x80, 0x57, 0x6f, 0x00, 0x40, 0x57,
+  0x6f, 0x00, 0x00, 0x57, 0x6f, 0x00, 0xc0, 0x56, 0x6f, 0x00, 0x80, 0x56,
+  0x6f, 0x00, 0x40, 0x56, 0x6f, 0x00, 0x00, 0x56, 0x6f, 0x00, 0xc0, 0x55,
+  0x6f, 0x00, 0x80, 0x55, 0x6f, 0x00, 0x40, 0x55, 0x6f, 0x00, 0x00, 0x55,
+  0x6f, 0x00, 0xc0, 0x54, 0x6f, 0x00, 0x80, 0x54, 0x6f, 0x00, 0x40, 0x54,
+  0x6f, 0x00, 0x00, 0x54, 0x6f, 0x00, 0xc0, 0x53, 0x6f, 0x00, 0x80, 0x53,
+  0x6f, 0x00, 0x40, 0x53, 0x6f, 0x00, 0x00, 0x53, 0x6f, 0x00, 0xc0, 0x52,
+  0x6f, 0x00, 0x80, 0x52, 0x6f, 0x00, 0x40, 0x52, 0x6f, 0x00, 0x00, 0x52,
+  0x6f, 0x00, 0xc0, 0x51, 0x6f, 0x00, 0x80, 0x51, 0x6f, 0x00, 0x40, 0x51,
+  0x6f, 0x00, 0x00, 0x51, 0x6f, 0x00, 0xc0, 0x50, 0x6f, 0x00, 0x80, 0x50,
+  0x6f, 0x00, 0x40, 0x50, 0x6f, 0x00, 0x00, 0x50, 0x6f, 0x00, 0xc0, 0x4f,
+  0x6f, 0x00, 0x80, 0x4f, 0x6f, 0x00, 0x40, 0x4f, 0x6f, 0x00, 0x00, 0x4f,
+  0x6f, 0x00, 0xc0, 0x4e, 0x6f, 0x00, 0x80, 0x4e, 0x6f, 0x00, 0x40, 0x4e,
+  0x6f, 0x00, 0x00, 0x4e, 0x6f, 0x00, 0xc0, 0x4d, 0x6f, 0x00, 0x80, 0x4d,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x70, 0x04, 0x30, 0x75, 0x71, 0x6e, 0xd0,
+  0x6a, 0xd2, 0x66, 0xd4, 0x62, 0xd6, 0x5e, 0xd8, 0x5a, 0xda, 0x56, 0xdc,
+  0x52, 0xde, 0xce, 0xc0, 0xca, 0xc2, 0xa6, 0xc4, 0xa2, 0xc6, 0xfe, 0xc8,
+  0xfa, 0xca, 0xf6, 0xcc, 0xf2, 0xce, 0xc6, 0xd0, 0xc2, 0xd2, 0xbe, 0xd4,
+  0xba, 0xd6, 0xb6, 0xd8, 0xb2, 0xda, 0xae, 0xdc, 0xaa, 0xde, 0x1e, 0xc1,
+  0x1a, 0xc3, 0x16, 0xc5, 0x06, 0xc7, 0x73, 0x2a, 0x20, 0xfc, 0x52, 0xc0,
+  0xf3, 0x29, 0x20, 0x34, 0x4e, 0xc2, 0x73, 0x29, 0x30, 0x34, 0x4a, 0xc4,
+  0x0e, 0xc6, 0xf3, 0x24, 0x00, 0x30, 0x26, 0xc8, 0x73, 0x24, 0x10, 0x34,
+  0x22, 0xca, 0x12, 0xcc, 0x0a, 0xce, 0x73, 0x10, 0x01, 0x34, 0x17, 0xc1,
+  0xfd, 0xff, 0x13, 0x01, 0xe1, 0xd4, 0x73, 0x25, 0x00, 0x34, 0xef, 0xe0,
+  0x3f, 0xc8, 0x73, 0x21, 0x00, 0x34, 0x89, 0x62, 0x93, 0x82, 0x02, 0x88,
+  0x73, 0xa0, 0x02, 0x30, 0xd2, 0x42, 0x73, 0x90, 0x12, 0x34, 0x82, 0x5d,
+  0x12, 0x5d, 0xa2, 0x5c, 0x32, 0x5c, 0xc2, 0x5b, 0x52, 0x5b, 0xe2, 0x5a,
+  0x72, 0x5a, 0x86, 0x49, 0x16, 0x49, 0xa6, 0x44, 0x36, 0x44, 0xc6, 0x4f,
+  0x56, 0x4f, 0xe6, 0x4e, 0x76, 0x4e, 0x86, 0x58, 0x16, 0x58, 0xa6, 0x57,
+  0x36, 0x57, 0xc6, 0x56, 0x56, 0x56, 0xe6, 0x55, 0x76, 0x55, 0x8a, 0x43,
+  0x1a, 0x43, 0xaa, 0x42, 0xba, 0x40, 0x49, 0x61, 0x73, 0x00, 0x20, 0x30,
+  0x73, 0x70, 0x04, 0x30, 0x19, 0x71, 0x06, 0xc0, 0x0a, 0xc2, 0x0e, 0xc4,
+  0x12, 0xc6, 0x16, 0xc8, 0x1a, 0xca, 0x1e, 0xcc, 0x22, 0xce, 0x26, 0xd0,
+  0x2a, 0xd2, 0x2e, 0xd4, 0x32, 0xd6, 0x36, 0xd8, 0x3a, 0xda, 0x3e, 0xdc,
+  0x42, 0xde, 0xc6, 0xc0, 0xca, 0xc2, 0xce, 0xc4, 0xd2, 0xc6, 0xd6, 0xc8,
+  0xda, 0xca, 0xde, 0xcc, 0xe2, 0xce, 0xe6, 0xd0, 0xea, 0xd2, 0xee, 0xd4,
+  0xf2, 0xd6, 0xf6, 0xd8, 0xfa, 0xda, 0xfe, 0xdc, 0xf3, 0x22, 0x10, 0x34,
+  0x96, 0xde, 0x73, 0x10, 0x01, 0x34, 0x17, 0xc1, 0xfd, 0xff, 0x13, 0x01,
+  0xe1, 0xc9, 0xef, 0xe0, 0x1f, 0x9f, 0x73, 0x21, 0x00, 0x34, 0x89, 0x62,
+  0x93, 0x82, 0x02, 0x88, 0x73, 0xa0, 0x02, 0x30, 0xf6, 0x52, 0x73, 0x90,
+  0x12, 0x34, 0x82, 0x40, 0xc2, 0x42, 0x52, 0x43, 0xe2, 0x43, 0x72, 0x44,
+  0x82, 0x54, 0x12, 0x55, 0xa2, 0x55, 0x32, 0x56, 0xc2, 0x56, 0x52, 0x57,
+  0xe2, 0x57, 0x72, 0x58, 0x86, 0x48, 0x16, 0x49, 0xa6, 0x49, 0x36, 0x4a,
+  0xc6, 0x4a, 0x56, 0x4b, 0xe6, 0x4b, 0x76, 0x4c, 0x86, 0x5c, 0x16, 0x5d,
+  0xa6, 0x5d, 0x36, 0x5e, 0xc6, 0x5e, 0x56, 0x5f, 0xe6, 0x5f, 0x09, 0x61,
+  0x73, 0x00, 0x20, 0x30, 0x73, 0x70, 0x04, 0x30, 0x19, 0x71, 0x06, 0xc0,
+  0x0a, 0xc2, 0x0e, 0xc4, 0x12, 0xc6, 0x16, 0xc8, 0x1a, 0xca, 0x1e, 0xcc,
+  0x22, 0xce, 0x26, 0xd0, 0x2a, 0xd2, 0x2e, 0xd4, 0x32, 0xd6, 0x36, 0xd8,
+  0x3a, 0xda, 0x3e, 0xdc, 0x42, 0xde, 0xc6, 0xc0, 0xca, 0xc2, 0xce, 0xc4,
+  0xd2, 0xc6, 0xd6, 0xc8, 0xda, 0xca, 0xde, 0xcc, 0xe2, 0xce, 0xe6, 0xd0,
+  0xea, 0xd2, 0xee, 0xd4, 0xf2, 0xd6, 0xf6, 0xd8, 0x4f, 0x80, 0x02, 0x1a,
+  0xe5, 0xfa, 0xda, 0xfe, 0xdc, 0xf3, 0x22, 0x10, 0x34, 0x96, 0xde, 0x73,
+  0x10, 0x01, 0x34, 0x17, 0xc1, 0xfd, 0xff, 0x13, 0x01, 0x21, 0xbf, 0xef,
+  0xe0, 0x5f, 0x98, 0x73, 0x21, 0x00, 0x34, 0x89, 0x62, 0x93, 0x82, 0x02,
+  0x88, 0x73, 0xa0, 0x02, 0x30, 0xf6, 0x52, 0x73, 0x90, 0x12, 0x34, 0x82,
+  0x40, 0xc2, 0x42, 0x52, 0x43, 0xe2, 0x43, 0x72, 0x44, 0x82, 0x54, 0x12,
+  0x55, 0xa2, 0x55, 0x32, 0x56, 0xc2, 0x56, 0x52, 0x57, 0xe2, 0x57, 0x72,
+  0x58, 0x86, 0x48, 0x16, 0x49, 0xa6, 0x49, 0x36, 0x4a, 0xc6, 0x4a, 0x56,
+  0x4b, 0xe6, 0x4b, 0x76, 0x4c, 0x86, 0x5c, 0x16, 0x5d, 0xa6, 0x5d, 0x36,
+  0x5e, 0xc6, 0x5e, 0x56, 0x5f, 0xe6, 0x5f, 0x09, 0x61, 0x73, 0x00, 0x20,
+  0x30, 0x73, 0x70, 0x04, 0x30, 0x19, 0x71, 0x06, 0xc0, 0x0a, 0xc2, 0x0e,
+  0xc4, 0x12, 0xc6, 0x16, 0xc8, 0x1a, 0xca, 0x1e, 0xcc, 0x22, 0xce, 0x26,
+  0xd0, 0x2a, 0xd2, 0x2e, 0xd4, 0x32, 0xd6, 0x36, 0xd8, 0x3a, 0xda, 0x3e,
+  0xdc, 0x42, 0xde, 0xc6, 0xc0, 0xca, 0xc2, 0xce, 0xc4, 0xd2, 0xc6, 0xd6,
+  0xc8, 0xda, 0xca, 0xde, 0xcc, 0xe2, 0xce, 0xe6, 0xd0, 0xea, 0xd2, 0xee,
+  0xd4, 0xf2, 0xd6, 0xf6, 0xd8, 0xfa, 0xda, 0xfe, 0xdc, 0xf3, 0x22, 0x10,
+  0x34, 0x96, 0xde, 0x73, 0x10, 0x01, 0x34, 0x17, 0xc1, 0xfd, 0xff, 0x13,
+  0x01, 0x61, 0xb4, 0xef, 0xe0, 0x9f, 0x91, 0x73, 0x21, 0x00, 0x34, 0x89,
+  0x62, 0x93, 0x82, 0x02, 0x88, 0x73, 0xa0, 0x02, 0x30, 0xf6, 0x52, 0x73,
+  0x90, 0x12, 0x34, 0x82, 0x40, 0xc2, 0x42, 0x52, 0x43, 0xe2, 0x43, 0x72,
+  0x44, 0x82, 0x54, 0x12, 0x55, 0xa2, 0x55, 0x32, 0x56, 0xc2, 0x56, 0x52,
+  0x57, 0xe2, 0x57, 0x72, 0x58, 0x86, 0x48, 0x16, 0x49, 0xa6, 0x49, 0x36,
+  0x4a, 0xc6, 0x4a, 0x56, 0x4b, 0xe6, 0x4b, 0x76, 0x4c, 0x86, 0x5c, 0x16,
+  0x5d, 0xa6, 0x5d, 0x36, 0x5e, 0xc6, 0x5e, 0x56, 0x5f, 0xe6, 0x5f, 0x09,
+  0x61, 0x73, 0x00, 0x20, 0x30, 0x73, 0x70, 0x04, 0x30, 0x19, 0x71, 0x06,
+  0xc0, 0x0a, 0xc2, 0x0e, 0xc4, 0x12, 0xc6, 0x16, 0xc8, 0x1a, 0xca, 0x1e,
+  0xcc, 0x22, 0xce, 0x26, 0xd0, 0x2a, 0xd2, 0x2e, 0xd4, 0x32, 0xd6, 0x36,
+  0xd8, 0x3a, 0xda, 0x3e, 0xdc, 0x42, 0xde, 0xc6, 0xc0, 0xca, 0xc2, 0xce,
+  0xc4, 0xd2, 0xc6, 0xd6, 0xc8, 0xda, 0xca, 0xde, 0xcc, 0xe2, 0xce, 0xe6,
+  0xd0, 0xea, 0xd2, 0xee, 0xd4, 0xf2, 0xd6, 0xf6, 0xd8, 0xfa, 0xda, 0xfe,
+  0xdc, 0xf3, 0x22, 0x10, 0x34, 0x96, 0xde, 0x73, 0x10, 0x01, 0x34, 0x17,
+  0xc1, 0xfd, 0xff, 0x13, 0x01, 0xa1, 0xa9, 0xef, 0xe0, 0xdf, 0x8a, 0x73,
+  0x21, 0x00, 0x34, 0x89, 0x62, 0x93, 0x82, 0x02, 0x88, 0x73, 0xa0, 0x02,
+  0x30, 0xf6, 0x52, 0x73, 0x90, 0x12, 0x34, 0x82, 0x40, 0xc2, 0x42, 0x52,
+  0x43, 0xe2, 0x43, 0x72, 0x44, 0x82, 0x54, 0x12, 0x55, 0xa2, 0x55, 0x32,
+  0x56, 0xc2, 0x56, 0x52, 0x57, 0xe2, 0x57, 0x72, 0x58, 0x86, 0x48, 0x16,
+  0x49, 0xa6, 0x49, 0x36, 0x4a, 0xc6, 0x4a, 0x56, 0x4b, 0xe6, 0x4b, 0x76,
+  0x4c, 0x86, 0x5c, 0x16, 0x5d, 0xa6, 0x5d, 0x36, 0x5e, 0xc6, 0x5e, 0x56,
+  0x5f, 0xe6, 0x5f, 0x09, 0x61, 0x73, 0x00, 0x20, 0x30, 0x73, 0x70, 0x04,
+  0x30, 0x19, 0x71, 0x06, 0xc0, 0x0a, 0xc2, 0x0e, 0xc4, 0x12, 0xc6, 0x16,
+  0xc8, 0x1a, 0xca, 0x1e, 0xcc, 0x22, 0xce, 0x26, 0xd0, 0x2a, 0xd2, 0x2e,
+  0xd4, 0x32, 0xd6, 0x36, 0xd8, 0x3a, 0xda, 0x3e, 0xdc, 0x42, 0xde, 0xc6,
+  0xc0, 0xca, 0xc2, 0xce, 0xc4, 0xd2, 0xc6, 0xd6, 0xc8, 0xda, 0xca, 0xde,
+  0xcc, 0xe2, 0xce, 0xe6, 0xd0, 0xea, 0xd2, 0xee, 0xd4, 0xf2, 0xd6, 0xf6,
+  0xd8, 0xfa, 0xda, 0xfe, 0xdc, 0xf3, 0x22, 0x10, 0x34, 0x96, 0xde, 0x73,
+  0x10, 0x01, 0x34, 0x17, 0xc1, 0xfd, 0xff, 0x13, 0x01, 0xe1, 0x9e, 0xef,
+  0xe0, 0x1f, 0x84, 0x73, 0x21, 0x00, 0x34, 0x89, 0x62, 0x93, 0x82, 0x02,
+  0x88, 0x73, 0xa0, 0x02, 0x30, 0xf6, 0x52, 0x73, 0x90, 0x12, 0x34, 0x82,
+  0x40, 0xc2, 0x42, 0x52, 0x43, 0xe2, 0x43, 0x72, 0x44, 0x82, 0x54, 0x12,
+  0x55, 0xa2, 0x55, 0x32, 0x56, 0xc2, 0x56, 0x52, 0x57, 0xe2, 0x57, 0x72,
+  0x58, 0x86, 0x48, 0x16, 0x49, 0xa6, 0x49, 0x36, 0x4a, 0xc6, 0x4a, 0x56,
+  0x4b, 0xe6, 0x4b, 0x76, 0x4c, 0x86, 0x5c, 0x16, 0x5d, 0xa6, 0x5d, 0x36,
+  0x5e, 0xc6, 0x5e, 0x56, 0x5f, 0xe6, 0x5f, 0x09, 0x61, 0x73, 0x00, 0x20,
+  0x30, 0x73, 0x70, 0x04, 0x30, 0x19, 0x71, 0x06, 0xc0, 0x0a, 0xc2, 0x0e,
+  0xc4, 0x12, 0xc6, 0x16, 0xc8, 0x1a, 0xca, 0x1e, 0xcc, 0x22, 0xce, 0x26,
+  0xd0, 0x2a, 0xd2, 0x2e, 0xd4, 0x32, 0xd6, 0x36, 0xd8, 0x3a, 0xda, 0x3e,
+  0xdc, 0x42, 0xde, 0xc6, 0xc0, 0xca, 0xc2, 0xce, 0xc4, 0xd2, 0xc6, 0xd6,
+  0xc8, 0xda, 0xca, 0xde, 0xcc, 0xe2, 0xce, 0xe6, 0xd0, 0xea, 0xd2, 0xee,
+  0xd4, 0xf2, 0xd6, 0xf6, 0xd8, 0xfa, 0xda, 0xfe, 0xdc, 0xf3, 0x22, 0x10,
+  0x34, 0x96, 0xde, 0x73, 0x10, 0x01, 0x34, 0x17, 0xc1, 0xfd, 0xff, 0x13,
+  0x01, 0x21, 0x94, 0xef, 0xe0, 0x4f, 0xfd, 0x73, 0x21, 0x00, 0x34, 0x89,
+  0x62, 0x93, 0x82, 0x02, 0x88, 0x73, 0xa0, 0x02, 0x30, 0xf6, 0x52, 0x73,
+  0x90, 0x12, 0x34, 0x82, 0x40, 0xc2, 0x42, 0x52, 0x43, 0xe2, 0x43, 0x72,
+  0x44, 0x82, 0x54, 0x12, 0x55, 0xa2, 0x55, 0x32, 0x56, 0xc2, 0x56, 0x52,
+  0x57, 0xe2, 0x57, 0x72, 0x58, 0x86, 0x48, 0x16, 0x49, 0xa6, 0x49, 0x36,
+  0x4a, 0xc6, 0x4a, 0x56, 0x4b, 0xe6, 0x4b, 0x76, 0x4c, 0x86, 0x5c, 0x16,
+  0x5d, 0xa6, 0x5d, 0x36, 0x5e, 0xc6, 0x5e, 0x56, 0x5f, 0xe6, 0x5f, 0x09,
+  0x61, 0x73, 0x00, 0x20, 0x30, 0x73, 0x70, 0x04, 0x30, 0x19, 0x71, 0x06,
+  0xc0, 0x0a, 0xc2, 0x0e, 0xc4, 0x12, 0xc6, 0x16, 0xc8, 0x1a, 0xca, 0x1e,
+  0xcc, 0x22, 0xce, 0x26, 0xd0, 0x2a, 0xd2, 0x2e, 0xd4, 0x32, 0xd6, 0x36,
+  0xd8, 0x3a, 0xda, 0x3e, 0xdc, 0x42, 0xde, 0xc6, 0xc0, 0xca, 0xc2, 0xce,
+  0xc4, 0xd2, 0xc6, 0xd6, 0xc8, 0xda, 0xca, 0xde, 0xcc, 0xe2, 0xce, 0xe6,
+  0xd0, 0xea, 0xd2, 0xee, 0xd4, 0xf2, 0xd6, 0xf6, 0xd8, 0xfa, 0xda, 0xfe,
+  0xdc, 0xf3, 0x22, 0x10, 0x34, 0x96, 0xde, 0x73, 0x10, 0x01, 0x34, 0x17,
+  0xc1, 0xfd, 0xff, 0x13, 0x01, 0x61, 0x89, 0xef, 0xe0, 0x8f, 0xf6, 0x73,
+  0x21, 0x00, 0x34, 0x89, 0x62, 0x93, 0x82, 0x02, 0x88, 0x73, 0xa0, 0x02,
+  0x30, 0xf6, 0x52, 0x73, 0x90, 0x12, 0x34, 0x82, 0x40, 0xc2, 0x42, 0x52,
+  0x43, 0xe2, 0x43, 0x72, 0x44, 0x82, 0x54, 0x12, 0x55, 0xa2, 0x55, 0x32,
+  0x56, 0xc2, 0x56, 0x52, 0x57, 0xe2, 0x57, 0x72, 0x58, 0x86, 0x48, 0x16,
+  0x49, 0xa6, 0x49, 0x36, 0x4a, 0xc6, 0x4a, 0x56, 0x4b, 0xe6, 0x4b, 0x76,
+  0x4c, 0x86, 0x5c, 0x16, 0x5d, 0xa6, 0x5d, 0x36, 0x5e, 0xc6, 0x5e, 0x56,
+  0x5f, 0xe6, 0x5f, 0x09, 0x61, 0x73, 0x00, 0x20, 0x30, 0x73, 0x25, 0x00,
+  0x30, 0xa1, 0x42, 0x73, 0xb0, 0x02, 0x30, 0x82, 0x80, 0x73, 0x25, 0x00,
+  0x30, 0xa1, 0x42, 0x73, 0xa0, 0x02, 0x30, 0x82, 0x80, 0x73, 0x10, 0x05,
+  0x30, 0x82, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x34, 0x3c, 0x02, 0x1b, 0xe4, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x82, 0x11, 0xa2, 0x00, 0xf6, 0x10, 0xa2, 0x00, 0x88, 0x11,
+  0xa2, 0x00, 0x88, 0x11, 0xa2, 0x00, 0x8c, 0x11, 0xa2, 0x00, 0x98, 0x11,
+  0xa2, 0x00, 0x52, 0x65, 0x61, 0x64, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x00, 0x75, 0x70,
+  0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x62, 0x69, 0x6e, 0x00, 0x00, 0x55, 0x6e,
+  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x43, 0x4d, 0x44, 0x3a,
+  0x00, 0x00, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x53, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6c, 0x00, 0x00,
+  0x00, 0x00, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xbc, 0x11,
+  0xa2, 0x00, 0x87, 0x00, 0x00, 0x00, 0x1c, 0x13, 0xa2, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0xbc, 0x11, 0xa2, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc2, 0x19,
+  0xa2, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x4a, 0x1b, 0xa2, 0x00, 0xb4, 0x00,
+  0x00, 0x00, 0x70, 0x12, 0xa2, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xb2, 0x12,
+  0xa2, 0x00, 0x43, 0x68, 0x69, 0x70, 0x20, 0x45, 0x72, 0x61, 0x73, 0x65,
+  0x20, 0x66, 0x61, 0x69, 0x6c, 0x75, 0x72, 0x65, 0x21, 0x00, 0x49, 0x6e,
+  0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73,
+  0x00, 0x00, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x61,
+  0x64, 0x64, 0x72, 0x20, 0x00, 0x00, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x5f,
+  0x6c, 0x65, 0x6e, 0x20, 0x00, 0x00, 0x20, 0x65, 0x72, 0x61, 0x73, 0x65,
+  0x5f, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x52,
+  0x65, 0x73, 0x65, 0x74, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e,
+  0x2e, 0x2e, 0x0a, 0x00, 0x00, 0x00, 0x55, 0x70, 0x6c, 0x6f, 0x61, 0x64,
+  0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6f,
+  0x72, 0x00, 0x55, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x61, 0x64, 0x64,
+  0x72, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x55, 0x70,
+  0x6c, 0x6f, 0x61, 0x64, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x65, 0x78,
+  0x63, 0x65, 0x65, 0x64, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x73, 0x68, 0x20,
+  0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x10, 0x42, 0x20, 0x63, 0x30, 0x84, 0x40, 0xa5, 0x50, 0xc6, 0x60,
+  0xe7, 0x70, 0x08, 0x81, 0x29, 0x91, 0x4a, 0xa1, 0x6b, 0xb1, 0x8c, 0xc1,
+  0xad, 0xd1, 0xce, 0xe1, 0xef, 0xf1, 0x31, 0x12, 0x10, 0x02, 0x73, 0x32,
+  0x52, 0x22, 0xb5, 0x52, 0x94, 0x42, 0xf7, 0x72, 0xd6, 0x62, 0x39, 0x93,
+  0x18, 0x83, 0x7b, 0xb3, 0x5a, 0xa3, 0xbd, 0xd3, 0x9c, 0xc3, 0xff, 0xf3,
+  0xde, 0xe3, 0x62, 0x24, 0x43, 0x34, 0x20, 0x04, 0x01, 0x14, 0xe6, 0x64,
+  0xc7, 0x74, 0xa4, 0x44, 0x85, 0x54, 0x6a, 0xa5, 0x4b, 0xb5, 0x28, 0x85,
+  0x09, 0x95, 0xee, 0xe5, 0xcf, 0xf5, 0xac, 0xc5, 0x8d, 0xd5, 0x53, 0x36,
+  0x72, 0x26, 0x11, 0x16, 0x30, 0x06, 0xd7, 0x76, 0xf6, 0x66, 0x95, 0x56,
+  0xb4, 0x46, 0x5b, 0xb7, 0x7a, 0xa7, 0x19, 0x97, 0x38, 0x87, 0xdf, 0xf7,
+  0xfe, 0xe7, 0x9d, 0xd7, 0xbc, 0xc7, 0xc4, 0x48, 0xe5, 0x58, 0x86, 0x68,
+  0xa7, 0x78, 0x40, 0x08, 0x61, 0x18, 0x02, 0x28, 0x23, 0x38, 0xcc, 0xc9,
+  0xed, 0xd9, 0x8e, 0xe9, 0xaf, 0xf9, 0x48, 0x89, 0x69, 0x99, 0x0a, 0xa9,
+  0x2b, 0xb9, 0xf5, 0x5a, 0xd4, 0x4a, 0xb7, 0x7a, 0x96, 0x6a, 0x71, 0x1a,
+  0x50, 0x0a, 0x33, 0x3a, 0x12, 0x2a, 0xfd, 0xdb, 0xdc, 0xcb, 0xbf, 0xfb,
+  0x9e, 0xeb, 0x79, 0x9b, 0x58, 0x8b, 0x3b, 0xbb, 0x1a, 0xab, 0xa6, 0x6c,
+  0x87, 0x7c, 0xe4, 0x4c, 0xc5, 0x5c, 0x22, 0x2c, 0x03, 0x3c, 0x60, 0x0c,
+  0x41, 0x1c, 0xae, 0xed, 0x8f, 0xfd, 0xec, 0xcd, 0xcd, 0xdd, 0x2a, 0xad,
+  0x0b, 0xbd, 0x68, 0x8d, 0x49, 0x9d, 0x97, 0x7e, 0xb6, 0x6e, 0xd5, 0x5e,
+  0xf4, 0x4e, 0x13, 0x3e, 0x32, 0x2e, 0x51, 0x1e, 0x70, 0x0e, 0x9f, 0xff,
+  0xbe, 0xef, 0xdd, 0xdf, 0xfc, 0xcf, 0x1b, 0xbf, 0x3a, 0xaf, 0x59, 0x9f,
+  0x78, 0x8f, 0x88, 0x91, 0xa9, 0x81, 0xca, 0xb1, 0xeb, 0xa1, 0x0c, 0xd1,
+  0x2d, 0xc1, 0x4e, 0xf1, 0x6f, 0xe1, 0x80, 0x10, 0xa1, 0x00, 0xc2, 0x30,
+  0xe3, 0x20, 0x04, 0x50, 0x25, 0x40, 0x46, 0x70, 0x67, 0x60, 0xb9, 0x83,
+  0x98, 0x93, 0xfb, 0xa3, 0xda, 0xb3, 0x3d, 0xc3, 0x1c, 0xd3, 0x7f, 0xe3,
+  0x5e, 0xf3, 0xb1, 0x02, 0x90, 0x12, 0xf3, 0x22, 0xd2, 0x32, 0x35, 0x42,
+  0x14, 0x52, 0x77, 0x62, 0x56, 0x72, 0xea, 0xb5, 0xcb, 0xa5, 0xa8, 0x95,
+  0x89, 0x85, 0x6e, 0xf5, 0x4f, 0xe5, 0x2c, 0xd5, 0x0d, 0xc5, 0xe2, 0x34,
+  0xc3, 0x24, 0xa0, 0x14, 0x81, 0x04, 0x66, 0x74, 0x47, 0x64, 0x24, 0x54,
+  0x05, 0x44, 0xdb, 0xa7, 0xfa, 0xb7, 0x99, 0x87, 0xb8, 0x97, 0x5f, 0xe7,
+  0x7e, 0xf7, 0x1d, 0xc7, 0x3c, 0xd7, 0xd3, 0x26, 0xf2, 0x36, 0x91, 0x06,
+  0xb0, 0x16, 0x57, 0x66, 0x76, 0x76, 0x15, 0x46, 0x34, 0x56, 0x4c, 0xd9,
+  0x6d, 0xc9, 0x0e, 0xf9, 0x2f, 0xe9, 0xc8, 0x99, 0xe9, 0x89, 0x8a, 0xb9,
+  0xab, 0xa9, 0x44, 0x58, 0x65, 0x48, 0x06, 0x78, 0x27, 0x68, 0xc0, 0x18,
+  0xe1, 0x08, 0x82, 0x38, 0xa3, 0x28, 0x7d, 0xcb, 0x5c, 0xdb, 0x3f, 0xeb,
+  0x1e, 0xfb, 0xf9, 0x8b, 0xd8, 0x9b, 0xbb, 0xab, 0x9a, 0xbb, 0x75, 0x4a,
+  0x54, 0x5a, 0x85, 0xa3, 0x02, 0x1c, 0xe3, 0x37, 0x6a, 0x16, 0x7a, 0xf1,
+  0x0a, 0xd0, 0x1a, 0xb3, 0x2a, 0x92, 0x3a, 0x2e, 0xfd, 0x0f, 0xed, 0x6c,
+  0xdd, 0x4d, 0xcd, 0xaa, 0xbd, 0x8b, 0xad, 0xe8, 0x9d, 0xc9, 0x8d, 0x26,
+  0x7c, 0x07, 0x6c, 0x64, 0x5c, 0x45, 0x4c, 0xa2, 0x3c, 0x83, 0x2c, 0xe0,
+  0x1c, 0xc1, 0x0c, 0x1f, 0xef, 0x3e, 0xff, 0x5d, 0xcf, 0x7c, 0xdf, 0x9b,
+  0xaf, 0xba, 0xbf, 0xd9, 0x8f, 0xf8, 0x9f, 0x17, 0x6e, 0x36, 0x7e, 0x55,
+  0x4e, 0x74, 0x5e, 0x93, 0x2e, 0xb2, 0x3e, 0xd1, 0x0e, 0xf0, 0x1e, 0x66,
+  0x69, 0x6c, 0x65, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x65,
+  0x72, 0x72, 0x20, 0x3a, 0x20, 0x00, 0x00, 0x66, 0x69, 0x6c, 0x65, 0x5f,
+  0x73, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x20, 0x65, 0x72, 0x61, 0x73, 0x65,
+  0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x66, 0x6c, 0x61, 0x73, 0x68,
+  0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x00,
+  0x00, 0x00, 0x00, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x3a, 0x00, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x6c, 0x65, 0x6e, 0x67,
+  0x74, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3a, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x4c, 0x6f, 0x61, 0x64, 0x79, 0x20, 0x65, 0x66, 0x75,
+  0x73, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x66, 0x61, 0x69, 0x6c,
+  0x65, 0x64, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x64, 0x72, 0x76, 0x5f, 0x72,
+  0x6f, 0x6d, 0x5f, 0x63, 0x69, 0x70, 0x68, 0x65, 0x72, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x20, 0x21, 0x21, 0x21, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d,
+  0x20, 0x00, 0x00, 0x64, 0x72, 0x76, 0x5f, 0x72, 0x6f, 0x6d, 0x5f, 0x63,
+  0x69, 0x70, 0x68, 0x65, 0x72, 0x5f, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36,
+  0x20, 0x21, 0x21, 0x21, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x64, 0x72, 0x76, 0x5f, 0x72, 0x6f, 0x6d, 0x5f, 0x63,
+  0x69, 0x70, 0x68, 0x65, 0x72, 0x5f, 0x64, 0x65, 0x69, 0x6e, 0x69, 0x74,
+  0x20, 0x21, 0x21, 0x21, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x68, 0x61, 0x73, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x6d,
+  0x70, 0x61, 0x72, 0x65, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x21, 0x21, 0x21,
+  0x00, 0x00, 0x00, 0x65, 0x78, 0x63, 0x65, 0x65, 0x64, 0x20, 0x65, 0x66,
+  0x75, 0x73, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x21, 0x21, 0x21,
+  0x00, 0x00, 0x00, 0x45, 0x66, 0x75, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+  0x66, 0x69, 0x67, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x76,
+  0x61, 0x6c, 0x69, 0x64, 0x00, 0x00, 0x00, 0x65, 0x66, 0x75, 0x73, 0x65,
+  0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72,
+  0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3a, 0x00, 0x00, 0x00, 0x53,
+  0x74, 0x61, 0x72, 0x74, 0x20, 0x62, 0x69, 0x74, 0x3a, 0x20, 0x00, 0x20,
+  0x6c, 0x65, 0x6e, 0x28, 0x62, 0x69, 0x74, 0x73, 0x29, 0x3d, 0x00, 0x45,
+  0x66, 0x75, 0x73, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x50,
+  0x61, 0x72, 0x61, 0x6d, 0x73, 0x20, 0x65, 0x72, 0x72, 0x00, 0x00, 0x20,
+  0x20, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x4c, 0x6f, 0x61, 0x64, 0x62, 0x6f, 0x6f, 0x74, 0x20,
+  0x55, 0x61, 0x72, 0x74, 0x20, 0x49, 0x6e, 0x69, 0x74, 0x20, 0x53, 0x75,
+  0x63, 0x63, 0x21, 0x00, 0x00, 0x00, 0x00, 0x46, 0x6c, 0x61, 0x73, 0x68,
+  0x20, 0x49, 0x6e, 0x69, 0x74, 0x20, 0x46, 0x61, 0x69, 0x6c, 0x21, 0x20,
+  0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x00, 0x46, 0x6c, 0x61, 0x73, 0x68,
+  0x20, 0x49, 0x6e, 0x69, 0x74, 0x20, 0x53, 0x75, 0x63, 0x63, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x53, 0x46, 0x43, 0x20, 0x66, 0x69, 0x78, 0x20, 0x53,
+  0x52, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x20, 0x4c, 0x6f, 0x61, 0x64, 0x20, 0x43, 0x6d, 0x64,
+  0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0d, 0x0a,
+  0x00, 0x00, 0x00, 0x6a, 0x09, 0xe6, 0x67, 0xbb, 0x67, 0xae, 0x85, 0x3c,
+  0x6e, 0xf3, 0x72, 0xa5, 0x4f, 0xf5, 0x3a, 0x51, 0x0e, 0x52, 0x7f, 0x9b,
+  0x05, 0x68, 0x8c, 0x1f, 0x83, 0xd9, 0xab, 0x5b, 0xe0, 0xcd, 0x19, 0x73,
+  0x80, 0x16, 0x6f, 0x49, 0x14, 0xb2, 0xb9, 0x17, 0x24, 0x42, 0xd7, 0xda,
+  0x8a, 0x06, 0x00, 0xa9, 0x6f, 0x30, 0xbc, 0x16, 0x31, 0x38, 0xaa, 0xe3,
+  0x8d, 0xee, 0x4d, 0xb0, 0xfb, 0x0e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0xc2,
+  0x25, 0xa2, 0x00, 0x80, 0x25, 0xa2, 0x00, 0x50, 0x26, 0xa2, 0x00, 0xe2,
+  0x26, 0xa2, 0x00, 0xfc, 0x26, 0xa2, 0x00, 0x3a, 0x2f, 0xa2, 0x00, 0x44,
+  0x2f, 0xa2, 0x00, 0xd2, 0x2f, 0xa2, 0x00, 0x54, 0x2f, 0xa2, 0x00, 0xc4,
+  0x2f, 0xa2, 0x00, 0xc4, 0x2f, 0xa2, 0x00, 0xc4, 0x2f, 0xa2, 0x00, 0xc4,
+  0x2f, 0xa2, 0x00, 0xc4, 0x2f, 0xa2, 0x00, 0xc4, 0x2f, 0xa2, 0x00, 0xc4,
+  0x2f, 0xa2, 0x00, 0xc4, 0x2f, 0xa2, 0x00, 0xc4, 0x2f, 0xa2, 0x00, 0xc4,
+  0x2f, 0xa2, 0x00, 0xc4, 0x2f, 0xa2, 0x00, 0xcc, 0x2f, 0xa2, 0x00, 0x74,
+  0x37, 0xa2, 0x00, 0x5e, 0x37, 0xa2, 0x00, 0x56, 0x37, 0xa2, 0x00, 0x5e,
+  0x37, 0xa2, 0x00, 0x62, 0x37, 0xa2, 0x00, 0x5e, 0x37, 0xa2, 0x00, 0x6c,
+  0x37, 0xa2, 0x00, 0x5e, 0x37, 0xa2, 0x00, 0x5e, 0x37, 0xa2, 0x00, 0x5e,
+  0x37, 0xa2, 0x00, 0x5e, 0x37, 0xa2, 0x00, 0x5e, 0x37, 0xa2, 0x00, 0x62,
+  0x37, 0xa2, 0x00, 0x6c, 0x37, 0xa2, 0x00, 0x01, 0x10, 0x20, 0x00, 0x12,
+  0x38, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x37, 0xa2, 0x00, 0x9a,
+  0x37, 0xa2, 0x00, 0x8c, 0x37, 0xa2, 0x00, 0x7e, 0x37, 0xa2, 0x00, 0x7e,
+  0x37, 0xa2, 0x00, 0x52, 0x35, 0xa2, 0x00, 0x68, 0x35, 0xa2, 0x00, 0x9e,
+  0x35, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x36, 0xa2, 0x00, 0x5c,
+  0x36, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x35, 0xa2, 0x00, 0xf4,
+  0x34, 0xa2, 0x00, 0x06, 0x35, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x44, 0x00, 0x10, 0x01, 0x44, 0x00, 0x20, 0x01, 0x44, 0x39,
+  0xc6, 0xff, 0xff, 0xc1, 0x06, 0x00, 0x40, 0x01, 0x01, 0x00, 0x04, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x39, 0xc6, 0xff, 0xff, 0xc1,
+  0x06, 0x00, 0x40, 0x91, 0x02, 0x00, 0x20, 0x01, 0x01, 0x00, 0x04, 0x19,
+  0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0xd9, 0x49, 0x00, 0x00, 0xd9,
+  0x55, 0x00, 0x00, 0x59, 0x6b, 0x00, 0x00, 0x59, 0xf7, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x91, 0x29, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc3,
+  0x1d, 0x02, 0x1d, 0xe2, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x01, 0x03,
+  0x35, 0x01, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x40, 0x16, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xd0, 0x6f, 0xa2, 0x00, 0xe8, 0x6f, 0xa2, 0x00, 0xc0, 0x6f, 0xa2, 0x00,
+  0x00, 0x70, 0xa2, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xb4, 0x6f, 0xa2, 0x00, 0xb8, 0x6f, 0xa2, 0x00,
+  0xa0, 0x6f, 0xa2, 0x00, 0xac, 0x6f, 0xa2, 0x00, 0x02, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x78, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x4e, 0x6f, 0x20, 0x6e,
+  0x65, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x78, 0x20, 0x53,
+  0x52, 0x21, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x53, 0x52, 0x20, 0x66,
+  0x69, 0x78, 0x20, 0x6f, 0x6b, 0x21, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x53, 0x52, 0x25, 0x64, 0x5b, 0x30, 0x78, 0x25, 0x78, 0x5d, 0x20, 0x6e,
+  0x65, 0x65, 0x64, 0x73, 0x20, 0x66, 0x69, 0x78, 0x69, 0x6e, 0x67, 0x2c,
+  0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x5b, 0x30, 0x78, 0x25, 0x78,
+  0x5d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x08, 0x00,
+  0xa0, 0x00, 0x03, 0x00, 0x70, 0x02, 0x20, 0x00, 0x03, 0x00, 0x90, 0x02,
+  0x08, 0x00, 0x03, 0x00, 0x98, 0x02, 0x08, 0x00, 0x03, 0x00, 0xa0, 0x02,
+  0x00, 0x01, 0x03, 0x00, 0xa0, 0x03, 0x20, 0x00, 0x03, 0x00, 0xc0, 0x03,
+  0x01, 0x00, 0x03, 0x00, 0xe8, 0x03, 0x08, 0x00, 0x03, 0x00, 0x30, 0x06,
+  0x30, 0x00, 0x03, 0x00, 0x60, 0x06, 0x30, 0x00, 0x03, 0x00, 0x90, 0x06,
+  0x30, 0x00, 0x03, 0x00, 0xc0, 0x06, 0x30, 0x00, 0x03, 0x00, 0xf0, 0x06,
+  0x80, 0x00, 0x03, 0x00, 0xa0, 0x02, 0x00, 0x01, 0x03, 0x00, 0x6f, 0x04,
+  0x01, 0x00, 0x03, 0x00, 0x60, 0x04, 0x0f, 0x00, 0x03, 0x00, 0x70, 0x04,
+  0x10, 0x00, 0x03, 0x00, 0x70, 0x07, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0a, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x3d, 0x00, 0x30, 0x78, 0x00, 0x00,
+  0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x74,
+  0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x00, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x5f, 0x63, 0x68, 0x69, 0x70, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x65, 0x72, 0x72, 0x20, 0x5b, 0x65, 0x66, 0x75, 0x73, 0x65, 0x3a, 0x70,
+  0x6b, 0x74, 0x5d, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x61, 0x64,
+  0x20, 0x65, 0x66, 0x75, 0x73, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x5f,
+  0x69, 0x64, 0x20, 0x65, 0x72, 0x72, 0x21, 0x20, 0x72, 0x65, 0x74, 0x20,
+  0x3d, 0x20, 0x00, 0x00, 0x72, 0x65, 0x61, 0x64, 0x20, 0x65, 0x66, 0x75,
+  0x73, 0x65, 0x20, 0x64, 0x69, 0x65, 0x5f, 0x69, 0x64, 0x20, 0x65, 0x72,
+  0x72, 0x21, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x00, 0x00, 0x00,
+  0x52, 0x4f, 0x4d, 0x7c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
+  0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x20, 0x3a, 0x20, 0x69, 0x6e,
+  0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x69, 0x64, 0x78, 0x5b,
+  0x25, 0x64, 0x5d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c,
+  0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x68, 0x61, 0x72, 0x64, 0x20,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x0d, 0x0a, 0x00, 0x52, 0x4f, 0x4d, 0x7c,
+  0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x25, 0x78,
+  0x0d, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73,
+  0x3a, 0x4e, 0x4d, 0x49, 0x0a, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c,
+  0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x69, 0x6e, 0x73, 0x6e, 0x20,
+  0x70, 0x61, 0x67, 0x65, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0d, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73,
+  0x20, 0x2d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65,
+  0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x6c,
+  0x6f, 0x63, 0x6b, 0x20, 0x75, 0x70, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x73,
+  0x74, 0x6f, 0x72, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c,
+  0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x65, 0x62, 0x72, 0x65, 0x61,
+  0x6b, 0x0d, 0x0a, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73,
+  0x20, 0x2d, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x4d, 0x2d, 0x6d, 0x6f, 0x64, 0x65, 0x0d, 0x0a, 0x00, 0x00, 0x00,
+  0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x65,
+  0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x53, 0x2d, 0x6d,
+  0x6f, 0x64, 0x65, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c,
+  0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72,
+  0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x55, 0x2d, 0x6d, 0x6f, 0x64, 0x65, 0x0d,
+  0x0a, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73,
+  0x20, 0x2d, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c,
+  0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x69, 0x6c, 0x6c, 0x65, 0x67,
+  0x61, 0x6c, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c,
+  0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72,
+  0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x20, 0x6d, 0x69, 0x73, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65,
+  0x64, 0x0d, 0x0a, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73,
+  0x20, 0x2d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x61, 0x63, 0x63, 0x65,
+  0x73, 0x73, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0d, 0x0a, 0x00, 0x00,
+  0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20,
+  0x6d, 0x69, 0x73, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x0d, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70, 0x73,
+  0x20, 0x2d, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0xc5, 0x2e, 0x02, 0x1e,
+  0xe1, 0x20, 0x28, 0x6f, 0x72, 0x20, 0x41, 0x4d, 0x4f, 0x29, 0x20, 0x61,
+  0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0d,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70,
+  0x73, 0x20, 0x2d, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x28, 0x6f,
+  0x72, 0x20, 0x41, 0x4d, 0x4f, 0x29, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x20, 0x6d, 0x69, 0x73, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65,
+  0x64, 0x0d, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x4f, 0x6f, 0x70,
+  0x73, 0x20, 0x2d, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20,
+  0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x0d, 0x0a, 0x00,
+  0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x45, 0x78, 0x63, 0x65, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x0a, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x75, 0x77, 0x45, 0x78, 0x63, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3d,
+  0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x6d, 0x65, 0x70, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x6d, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x6d, 0x74, 0x76, 0x61, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x6d, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x63, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x72, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x67, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x74, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x74, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x74, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x74, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x61, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x31, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x73, 0x31, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x74, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x74, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a, 0x00, 0x00, 0x52, 0x4f, 0x4d,
+  0x7c, 0x74, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x78, 0x25, 0xb4, 0x17, 0x02, 0x1f, 0xe0, 0x78, 0x0a,
+  0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x74, 0x36, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x25, 0x78, 0x0a,
+  0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x45, 0x78, 0x63, 0x65,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x6e, 0x64, 0x2a, 0x2a, 0x2a,
+  0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20,
+  0x0a, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x6e, 0x6d, 0x69, 0x5f, 0x68, 0x61,
+  0x6e, 0x64, 0x6c, 0x65, 0x72, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x69, 0x64, 0x78, 0x5b, 0x25, 0x64,
+  0x5d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x7c, 0x5b, 0x70,
+  0x61, 0x6e, 0x69, 0x63, 0x5d, 0x69, 0x64, 0x3a, 0x25, 0x64, 0x2c, 0x63,
+  0x6f, 0x64, 0x65, 0x3a, 0x30, 0x78, 0x25, 0x78, 0x2c, 0x63, 0x61, 0x6c,
+  0x6c, 0x3a, 0x30, 0x78, 0x25, 0x78, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x56,
+  0xa2, 0x00, 0xde, 0x56, 0xa2, 0x00, 0xf2, 0x56, 0xa2, 0x00, 0x38, 0x57,
+  0xa2, 0x00, 0x96, 0x57, 0xa2, 0x00, 0x9a, 0x57, 0xa2, 0x00, 0xd8, 0x57,
+  0xa2, 0x00, 0xf0, 0x58, 0xa2, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+  0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x78, 0x00,
+  0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x06, 0x02, 0x00, 0x04, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x00, 0x07,
+  0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x07, 0x00, 0x07, 0x00,
+  0x00, 0x08, 0x08, 0x07, 0x00, 0x08, 0x07, 0x08, 0x00, 0x07, 0x08, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x01,
+  0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x01, 0x00, 0x00, 0x04, 0x04, 0x04,
+  0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x03, 0x03, 0x08, 0x05, 0x08, 0x08,
+  0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x05, 0x05, 0x08, 0x00, 0x00, 0x00,
+  0x03, 0x03, 0x03, 0x05, 0x05, 0x08, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+  0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08, 0x2c, 0xa2, 0x00, 0xd6, 0x2b,
+  0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x2c,
+  0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x2c,
+  0xa2, 0x00, 0x62, 0x2d, 0xa2, 0x00, 0x96, 0x2c, 0xa2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x58, 0x38, 0xa2, 0x00, 0x28, 0x35, 0xa2, 0x00, 0x04, 0x36,
+  0xa2, 0x00, 0xb6, 0x35, 0xa2, 0x00, 0xdc, 0x35, 0xa2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7e, 0x39, 0xa2, 0x00, 0x7c, 0x39, 0xa2, 0x00, 0xf6, 0x39,
+  0xa2, 0x00, 0x68, 0x39, 0xa2, 0x00, 0x66, 0x3a, 0xa2, 0x00, 0xe2, 0x39,
+  0xa2, 0x00, 0x56, 0x39, 0xa2, 0x00, 0x80, 0x39, 0xa2, 0x00, 0x72, 0x39,
+  0xa2, 0x00, 0x00, 0x36, 0x6e, 0x01, 0x00, 0x7d, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x36, 0x6e, 0x01, 0x64, 0x00,
+  0x00, 0x00, 0x50, 0xc3, 0x00, 0x00, 0x30, 0x80, 0x00, 0x44, 0x2c, 0x80,
+  0x00, 0x44, 0x00, 0x88, 0x00, 0x44, 0x03, 0xff, 0xff, 0xff, 0x90, 0x53,
+  0xa2, 0x00, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0x00, 0x00, 0x00, 0x28, 0x6e,
+  0x75, 0x6c, 0x6c, 0x29, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x6e, 0x00,
+  0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x67, 0xa2, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4d, 0xee, 0x01, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const char ws63_loaderboot_frames_name[] = "root_loaderboot_sign.bin";
+const unsigned int ws63_loaderboot_frames_len = 31808;
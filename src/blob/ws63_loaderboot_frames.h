@@ -0,0 +1,13 @@
+/*
+  WS63 LiteOS signed bootloader blob (root_loaderboot_sign.bin), as a
+  pre-built ymodem session, see mkframes.c
+*/
+
+#ifndef _BLOB_WS63_LOADERBOOT_FRAMES_H_
+#define _BLOB_WS63_LOADERBOOT_FRAMES_H_
+
+extern const unsigned char ws63_loaderboot_frames[];
+extern const char ws63_loaderboot_frames_name[];
+extern const unsigned int ws63_loaderboot_frames_len;	/* of the image */
+
+#endif	/* _BLOB_WS63_LOADERBOOT_FRAMES_H_ */
@@ -0,0 +1,188 @@
+/*
+  cost.h - Flashing Time Cost Model
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _COST_H_
+#define _COST_H_
+
+#include "config.h"
+
+#include "ymodem.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/*
+  Time it takes the device to do its part, in milliseconds. The wire
+  time follows from the baud rate, everything else is learnt: each real
+  run feeds what it measured back, smoothed, into a small cache file.
+*/
+struct cost_model {
+	double	rtt_ms;		/* turnaround of a frame beyond wire time */
+	double	erase_ms;	/* per FLASH_ERASE_SIZE block */
+	double	chip_erase_ms;	/* erasing everything, --erase */
+	double	boot_ms;	/* loaderboot starting up */
+	double	cmd_ms;		/* a command & its reply */
+	double	handshake_ms;	/* from the reset to the ACK */
+};
+
+static const struct cost_model cost_defaults = {
+	.rtt_ms		= 2.0,
+	.erase_ms	= 60.0,
+	.chip_erase_ms	= 20000.0,
+	.boot_ms	= 50.0,
+	.cmd_ms		= 10.0,
+	.handshake_ms	= 100.0,
+};
+
+static const struct {
+	const char	*key;
+	size_t		 ofs;
+} cost_keys[] = {
+	{ "rtt_ms",		offsetof(struct cost_model, rtt_ms) },
+	{ "erase_ms",		offsetof(struct cost_model, erase_ms) },
+	{ "chip_erase_ms",	offsetof(struct cost_model, chip_erase_ms) },
+	{ "boot_ms",		offsetof(struct cost_model, boot_ms) },
+	{ "cmd_ms",		offsetof(struct cost_model, cmd_ms) },
+	{ "handshake_ms",	offsetof(struct cost_model, handshake_ms) },
+};
+
+#define COST_KEYS_N (sizeof(cost_keys) / sizeof(cost_keys[0]))
+#define COST_FIELD(m, i) ((double *) ((char *) (m) + cost_keys[i].ofs))
+
+/* Weight of a new measurement against what was learnt before */
+#define COST_ALPHA 0.3
+
+/*
+  Path of the cache file NAME, under $XDG_CACHE_HOME/ws63flash or
+  ~/.cache/ws63flash, creating the directory if MKDIR. -1 if unknown.
+*/
+static inline int cost_cache_path(char *buf, size_t len, const char *name,
+				  int mkdir_p)
+{
+	const char *xdg = getenv("XDG_CACHE_HOME"), *home = getenv("HOME");
+	int n;
+
+	if (xdg && *xdg)
+		n = snprintf(buf, len, "%s/ws63flash", xdg);
+	else if (home && *home)
+		n = snprintf(buf, len, "%s/.cache/ws63flash", home);
+	else
+		return -1;
+
+	if (n < 0 || (size_t) n >= len)
+		return -1;
+
+	if (mkdir_p) {
+		char *sl = strrchr(buf, '/');
+
+		/* ~/.cache itself may not be there yet */
+		*sl = '\0';
+		mkdir(buf, 0755);
+		*sl = '/';
+		if (mkdir(buf, 0755) < 0 && errno != EEXIST)
+			return -1;
+	}
+
+	n = snprintf(buf + n, len - n, "/%s", name);
+	return (n < 0 || (size_t) n >= len) ? -1 : 0;
+}
+
+/* The learnt model, or the defaults. Returns 1 if it was calibrated. */
+static inline int cost_load(struct cost_model *m)
+{
+	char path[PATH_MAX], key[32];
+	double val;
+	FILE *f;
+	int calibrated = 0;
+
+	*m = cost_defaults;
+
+	if (cost_cache_path(path, sizeof(path), "cost", 0) < 0)
+		return 0;
+
+	f = fopen(path, "r");
+	if (!f)
+		return 0;
+
+	while (fscanf(f, "%31s %lf", key, &val) == 2)
+		for (size_t i = 0; i < COST_KEYS_N; i++)
+			if (!strcmp(key, cost_keys[i].key) && val >= 0) {
+				*COST_FIELD(m, i) = val;
+				calibrated = 1;
+			}
+
+	fclose(f);
+	return calibrated;
+}
+
+static inline int cost_save(const struct cost_model *m)
+{
+	char path[PATH_MAX];
+	FILE *f;
+
+	if (cost_cache_path(path, sizeof(path), "cost", 1) < 0)
+		return -1;
+
+	f = fopen(path, "w");
+	if (!f)
+		return -1;
+
+	for (size_t i = 0; i < COST_KEYS_N; i++)
+		fprintf(f, "%s %.3f\n", cost_keys[i].key,
+			*COST_FIELD(m, i));
+
+	return fclose(f);
+}
+
+/* Fold a measured SAMPLE into FIELD */
+static inline void cost_learn(double *field, double sample)
+{
+	if (sample < 0)
+		return;
+	*field = (1 - COST_ALPHA) * *field + COST_ALPHA * sample;
+}
+
+/* Milliseconds on the wire for LEN bytes at BAUD, 8N1 */
+static inline double cost_wire_ms(double len, int baud)
+{
+	return len * 10 * 1000 / baud;
+}
+
+/* A ymodem session for an image of LEN, WINDOW frames in flight */
+static inline double
+cost_xfer_ms(const struct cost_model *m, size_t len, int baud, int window)
+{
+	size_t stx = len / 1024, tail = len % 1024, soh = 0;
+
+	if (tail && !ymodem_tail_soh(tail))
+		stx++;
+	else
+		soh = (tail + 127) / 128;
+
+	/* Block 0, EOT & the closing block 0 are always stop-and-wait */
+	return cost_wire_ms(stx * (1024+5) + soh * (128+5)
+			    + 2 * (128+5) + 1, baud)
+		+ (stx + soh) * m->rtt_ms / window + 3 * m->rtt_ms;
+}
+
+#endif	/* _COST_H_ */
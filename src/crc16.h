@@ -0,0 +1,296 @@
+/*
+  crc16.h - CRC16/XMODEM Kernels with Runtime Dispatch
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _CRC16_H_
+#define _CRC16_H_
+
+#include "config.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRC16_HAVE_CLMUL 1
+#include <immintrin.h>
+#define CRC16_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+#elif defined(__GNUC__) && defined(__aarch64__) \
+	&& (defined(__linux__) || defined(__APPLE__))
+#define CRC16_HAVE_CLMUL 1
+#include <arm_neon.h>
+#ifdef __linux__
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#ifdef __clang__
+#define CRC16_CLMUL_TARGET __attribute__((target("aes")))
+#else
+#define CRC16_CLMUL_TARGET __attribute__((target("+crypto")))
+#endif
+#endif
+
+static const unsigned short crc16_tbl[256]= {
+	0x0000,0x1021,0x2042,0x3063,0x4084,0x50a5,0x60c6,0x70e7,
+	0x8108,0x9129,0xa14a,0xb16b,0xc18c,0xd1ad,0xe1ce,0xf1ef,
+	0x1231,0x0210,0x3273,0x2252,0x52b5,0x4294,0x72f7,0x62d6,
+	0x9339,0x8318,0xb37b,0xa35a,0xd3bd,0xc39c,0xf3ff,0xe3de,
+	0x2462,0x3443,0x0420,0x1401,0x64e6,0x74c7,0x44a4,0x5485,
+	0xa56a,0xb54b,0x8528,0x9509,0xe5ee,0xf5cf,0xc5ac,0xd58d,
+	0x3653,0x2672,0x1611,0x0630,0x76d7,0x66f6,0x5695,0x46b4,
+	0xb75b,0xa77a,0x9719,0x8738,0xf7df,0xe7fe,0xd79d,0xc7bc,
+	0x48c4,0x58e5,0x6886,0x78a7,0x0840,0x1861,0x2802,0x3823,
+	0xc9cc,0xd9ed,0xe98e,0xf9af,0x8948,0x9969,0xa90a,0xb92b,
+	0x5af5,0x4ad4,0x7ab7,0x6a96,0x1a71,0x0a50,0x3a33,0x2a12,
+	0xdbfd,0xcbdc,0xfbbf,0xeb9e,0x9b79,0x8b58,0xbb3b,0xab1a,
+	0x6ca6,0x7c87,0x4ce4,0x5cc5,0x2c22,0x3c03,0x0c60,0x1c41,
+	0xedae,0xfd8f,0xcdec,0xddcd,0xad2a,0xbd0b,0x8d68,0x9d49,
+	0x7e97,0x6eb6,0x5ed5,0x4ef4,0x3e13,0x2e32,0x1e51,0x0e70,
+	0xff9f,0xefbe,0xdfdd,0xcffc,0xbf1b,0xaf3a,0x9f59,0x8f78,
+	0x9188,0x81a9,0xb1ca,0xa1eb,0xd10c,0xc12d,0xf14e,0xe16f,
+	0x1080,0x00a1,0x30c2,0x20e3,0x5004,0x4025,0x7046,0x6067,
+	0x83b9,0x9398,0xa3fb,0xb3da,0xc33d,0xd31c,0xe37f,0xf35e,
+	0x02b1,0x1290,0x22f3,0x32d2,0x4235,0x5214,0x6277,0x7256,
+	0xb5ea,0xa5cb,0x95a8,0x8589,0xf56e,0xe54f,0xd52c,0xc50d,
+	0x34e2,0x24c3,0x14a0,0x0481,0x7466,0x6447,0x5424,0x4405,
+	0xa7db,0xb7fa,0x8799,0x97b8,0xe75f,0xf77e,0xc71d,0xd73c,
+	0x26d3,0x36f2,0x0691,0x16b0,0x6657,0x7676,0x4615,0x5634,
+	0xd94c,0xc96d,0xf90e,0xe92f,0x99c8,0x89e9,0xb98a,0xa9ab,
+	0x5844,0x4865,0x7806,0x6827,0x18c0,0x08e1,0x3882,0x28a3,
+	0xcb7d,0xdb5c,0xeb3f,0xfb1e,0x8bf9,0x9bd8,0xabbb,0xbb9a,
+	0x4a75,0x5a54,0x6a37,0x7a16,0x0af1,0x1ad0,0x2ab3,0x3a92,
+	0xfd2e,0xed0f,0xdd6c,0xcd4d,0xbdaa,0xad8b,0x9de8,0x8dc9,
+	0x7c26,0x6c07,0x5c64,0x4c45,0x3ca2,0x2c83,0x1ce0,0x0cc1,
+	0xef1f,0xff3e,0xcf5d,0xdf7c,0xaf9b,0xbfba,0x8fd9,0x9ff8,
+	0x6e17,0x7e36,0x4e55,0x5e74,0x2e93,0x3eb2,0x0ed1,0x1ef0
+};
+
+
+typedef uint16_t (*crc16_fn)(uint16_t crc, const uint8_t *buf, size_t len);
+
+/* Reference kernel, one table lookup per byte */
+static uint16_t crc16_bytewise(uint16_t crc, const uint8_t *buf, size_t len)
+{
+	while (len--)
+		crc = (crc<<8) ^ crc16_tbl[((crc>>8) ^ *buf++) & 0x00FF];
+	return crc;
+}
+
+/*
+  Slicing-by-8: crc16_slice[k][b] is the CRC of byte b followed by k
+  zero bytes, so 8 independent lookups fold in 8 bytes at a time.
+*/
+static uint16_t crc16_slice[8][256];
+
+static void crc16_slice_init(void)
+{
+	for (int b = 0; b < 256; b++) {
+		crc16_slice[0][b] = crc16_tbl[b];
+		for (int k = 1; k < 8; k++) {
+			uint16_t prev = crc16_slice[k-1][b];
+			crc16_slice[k][b] = (prev << 8) ^ crc16_tbl[prev >> 8];
+		}
+	}
+}
+
+static uint16_t crc16_slice8(uint16_t crc, const uint8_t *buf, size_t len)
+{
+	while (len >= 8) {
+		crc ^= (buf[0] << 8) | buf[1];
+		crc = crc16_slice[7][crc >> 8] ^ crc16_slice[6][crc & 0xff]
+			^ crc16_slice[5][buf[2]] ^ crc16_slice[4][buf[3]]
+			^ crc16_slice[3][buf[4]] ^ crc16_slice[2][buf[5]]
+			^ crc16_slice[1][buf[6]] ^ crc16_slice[0][buf[7]];
+		buf += 8;
+		len -= 8;
+	}
+
+	return crc16_bytewise(crc, buf, len);
+}
+
+#ifdef CRC16_HAVE_CLMUL
+/*
+  Carry-less multiply folding. The data is taken as one big-endian
+  polynomial, 16 bytes at a time. A 128-bit remainder X = Xh:Xl is
+  folded over the next block B as
+
+      X * x^128 + B == Xh * (x^192 mod P) + Xl * (x^128 mod P) + B
+
+  which keeps the value congruent modulo P = 0x11021. The last X is
+  then reduced with the table like an ordinary 16-byte message.
+*/
+#define CRC16_K192	0x650b	/* x^192 mod P */
+#define CRC16_K128	0xaefc	/* x^128 mod P */
+
+#if defined(__x86_64__) || defined(__i386__)
+CRC16_CLMUL_TARGET
+static uint16_t crc16_clmul(uint16_t crc, const uint8_t *buf, size_t len)
+{
+	const __m128i bswap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+					    7, 6, 5, 4, 3, 2, 1, 0);
+	const __m128i k = _mm_set_epi64x(CRC16_K192, CRC16_K128);
+	uint8_t rem[16];
+	__m128i x;
+
+	if (len < 32)
+		return crc16_slice8(crc, buf, len);
+
+	x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) buf), bswap);
+	x = _mm_xor_si128(x, _mm_set_epi64x((uint64_t) crc << 48, 0));
+	buf += 16;
+	len -= 16;
+
+	while (len >= 16) {
+		__m128i b = _mm_loadu_si128((const __m128i *) buf);
+
+		b = _mm_xor_si128(_mm_shuffle_epi8(b, bswap),
+				  _mm_clmulepi64_si128(x, k, 0x11));
+		x = _mm_xor_si128(b, _mm_clmulepi64_si128(x, k, 0x00));
+		buf += 16;
+		len -= 16;
+	}
+
+	_mm_storeu_si128((__m128i *) rem, _mm_shuffle_epi8(x, bswap));
+	return crc16_slice8(crc16_slice8(0, rem, 16), buf, len);
+}
+
+static int crc16_clmul_usable(void)
+{
+	return __builtin_cpu_supports("pclmul")
+		&& __builtin_cpu_supports("ssse3");
+}
+#else  /* __aarch64__ */
+CRC16_CLMUL_TARGET
+static inline uint8x16_t crc16_bswap128(uint8x16_t v)
+{
+	v = vrev64q_u8(v);
+	return vextq_u8(v, v, 8);
+}
+
+CRC16_CLMUL_TARGET
+static uint16_t crc16_clmul(uint16_t crc, const uint8_t *buf, size_t len)
+{
+	uint8_t rem[16];
+	uint64x2_t x;
+
+	if (len < 32)
+		return crc16_slice8(crc, buf, len);
+
+	x = vreinterpretq_u64_u8(crc16_bswap128(vld1q_u8(buf)));
+	x = veorq_u64(x, vcombine_u64(vcreate_u64(0),
+				      vcreate_u64((uint64_t) crc << 48)));
+	buf += 16;
+	len -= 16;
+
+	while (len >= 16) {
+		uint64x2_t b, hi, lo;
+
+		b  = vreinterpretq_u64_u8(crc16_bswap128(vld1q_u8(buf)));
+		hi = vreinterpretq_u64_p128(
+			vmull_p64((poly64_t) vgetq_lane_u64(x, 1),
+				  (poly64_t) CRC16_K192));
+		lo = vreinterpretq_u64_p128(
+			vmull_p64((poly64_t) vgetq_lane_u64(x, 0),
+				  (poly64_t) CRC16_K128));
+		x  = veorq_u64(veorq_u64(hi, lo), b);
+		buf += 16;
+		len -= 16;
+	}
+
+	vst1q_u8(rem, crc16_bswap128(vreinterpretq_u8_u64(x)));
+	return crc16_slice8(crc16_slice8(0, rem, 16), buf, len);
+}
+
+static int crc16_clmul_usable(void)
+{
+#ifdef __linux__
+	return !!(getauxval(AT_HWCAP) & HWCAP_PMULL);
+#else
+	return 1;		/* Every Apple Silicon has PMULL */
+#endif
+}
+#endif
+#endif	/* CRC16_HAVE_CLMUL */
+
+/* Check a kernel against the table walk over odd lengths & alignments */
+static int crc16_selftest(crc16_fn fn)
+{
+	uint8_t buf[1024 + 16];
+	uint32_t seed = 0x1021;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		seed = seed * 1103515245 + 12345;
+		buf[i] = seed >> 16;
+	}
+
+	for (size_t ofs = 0; ofs < 16; ofs += 3)
+		for (size_t len = 0; len <= 1024; len += (len < 64) ? 1 : 61)
+			if (fn(0x1d0f, buf + ofs, len)
+			    != crc16_bytewise(0x1d0f, buf + ofs, len))
+				return 0;
+
+	return 1;
+}
+
+static uint16_t crc16_resolve(uint16_t crc, const uint8_t *buf, size_t len);
+
+static _Atomic(crc16_fn) crc16_impl = crc16_resolve;
+static const char *crc16_impl_name = "bytewise";
+static pthread_once_t crc16_once = PTHREAD_ONCE_INIT;
+
+static void crc16_select(void)
+{
+	crc16_fn fn = crc16_bytewise;
+
+	crc16_slice_init();
+	if (crc16_selftest(crc16_slice8)) {
+		fn = crc16_slice8;
+		crc16_impl_name = "slice-by-8";
+	}
+
+#ifdef CRC16_HAVE_CLMUL
+	if (crc16_clmul_usable() && crc16_selftest(crc16_clmul)) {
+		fn = crc16_clmul;
+		crc16_impl_name = "clmul";
+	}
+#endif
+
+	atomic_store(&crc16_impl, fn);
+}
+
+/* Pick the fastest kernel that passes the self-test on first use */
+static uint16_t crc16_resolve(uint16_t crc, const uint8_t *buf, size_t len)
+{
+	pthread_once(&crc16_once, crc16_select);
+	return atomic_load(&crc16_impl)(crc, buf, len);
+}
+
+/* Name of the kernel in use, for diagnostics */
+static inline const char *crc16_xmodem_impl(void)
+{
+	pthread_once(&crc16_once, crc16_select);
+	return crc16_impl_name;
+}
+
+static inline uint16_t crc16_xmodem(const void *ptr, int len)
+{
+	return atomic_load(&crc16_impl)(0, ptr, len);
+}
+
+#endif	/* _CRC16_H_ */
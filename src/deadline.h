@@ -0,0 +1,100 @@
+/*
+  deadline.h - Monotonic Deadlines & Polled Reads
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _DEADLINE_H_
+#define _DEADLINE_H_
+
+#include "config.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+  All timeouts are kept as absolute CLOCK_MONOTONIC deadlines in
+  milliseconds, so they survive retries and wall clock jumps, and the
+  process sleeps in poll() instead of spinning on read().
+*/
+
+static inline int64_t mono_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static inline int64_t deadline_in(int64_t ms)
+{
+	return mono_ms() + ms;
+}
+
+/* Milliseconds left until DEADLINE, 0 once it passed */
+static inline int deadline_left(int64_t deadline)
+{
+	int64_t left = deadline - mono_ms();
+
+	if (left <= 0)
+		return 0;
+	return left > INT_MAX ? INT_MAX : left;
+}
+
+static inline int deadline_passed(int64_t deadline)
+{
+	return mono_ms() >= deadline;
+}
+
+/*
+  Read up to LEN bytes, sleeping until something arrives or DEADLINE
+  passes. Returns the bytes read, 0 on timeout or -1 with errno set,
+  EPIPE once the peer of a socket or pty closed.
+*/
+static inline ssize_t
+read_deadline(int fd, void *buf, size_t len, int64_t deadline)
+{
+	struct pollfd pfd = { .fd = fd, .events = POLLIN };
+	ssize_t ret;
+
+	while (1) {
+		ret = poll(&pfd, 1, deadline_left(deadline));
+		if (ret < 0 && errno == EINTR)
+			continue;
+		if (ret <= 0)
+			return ret;
+
+		if (!(pfd.revents & POLLIN)) {
+			errno = EIO;
+			return -1;
+		}
+
+		ret = read(fd, buf, len);
+		if (ret < 0 && (errno == EINTR || errno == EAGAIN))
+			continue;
+		/* Readable with nothing to read, the other end is gone */
+		if (ret == 0) {
+			errno = EPIPE;
+			return -1;
+		}
+		return ret;
+	}
+}
+
+#endif	/* _DEADLINE_H_ */
@@ -0,0 +1,181 @@
+/*
+  frame.h - Streaming Reply Decoder
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _FRAME_H_
+#define _FRAME_H_
+
+#include "config.h"
+#include "crc16.h"
+#include "rxring.h"
+
+#include <ctype.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+  What comes back from the boot ROM & the loader is a mix of command
+  frames (magic, LE16 length, cmd, ~cmd, payload, CRC16), ymodem control
+  characters and text. The decoder takes it a byte at a time, however
+  it was read, and says what each byte completed, so a reply is seen as
+  soon as its last byte is in.
+*/
+enum frame_ev {
+	FRAME_NONE = 0,		/* nothing complete yet, or timed out */
+	FRAME_CMD,		/* command frame, crc_ok tells if it checks */
+	FRAME_ACK,		/* ymodem control characters */
+	FRAME_NAK,
+	FRAME_C,		/* also part of the line it is in */
+	FRAME_LINE,		/* line of text, newline stripped */
+};
+
+#define FRAME_MAGIC	"\xef\xbe\xad\xde"
+#define FRAME_HDR	8	/* magic, length, cmd & ~cmd */
+#define FRAME_MIN	(FRAME_HDR + 2)
+#define FRAME_MAX	(1024 + 12)
+#define FRAME_LINE_MAX	128
+
+/* Command & payload of the ACK frame */
+#define FRAME_ACK_CMD	0xe1
+#define FRAME_ACK_OK	0x5a
+
+struct frame_dec {
+	uint8_t		 buf[FRAME_MAX];
+	size_t		 len;		/* bytes of the frame so far */
+	size_t		 need;		/* its length, from the header */
+	int		 crc_ok;
+
+	char		 line[FRAME_LINE_MAX + 1];
+	size_t		 llen;
+	int		 lfresh;	/* line went out, start the next */
+};
+
+static inline void frame_dec_init(struct frame_dec *d)
+{
+	d->len = d->llen = 0;
+	d->lfresh = 0;
+	d->line[0] = '\0';
+}
+
+static inline uint8_t frame_cmd(const struct frame_dec *d)
+{
+	return d->buf[6];
+}
+
+static inline const uint8_t *frame_payload(const struct frame_dec *d)
+{
+	return d->buf + FRAME_HDR;
+}
+
+static inline size_t frame_payload_len(const struct frame_dec *d)
+{
+	return d->need - FRAME_MIN;
+}
+
+/* The frame just decoded is an intact ACK */
+static inline int frame_is_ack(const struct frame_dec *d)
+{
+	return d->crc_ok && frame_cmd(d) == FRAME_ACK_CMD
+		&& frame_payload_len(d) >= 1
+		&& frame_payload(d)[0] == FRAME_ACK_OK;
+}
+
+/* Take byte C, returns what it completed */
+static inline enum frame_ev frame_feed(struct frame_dec *d, uint8_t c)
+{
+	if (d->lfresh) {
+		d->llen = 0;
+		d->line[0] = '\0';
+		d->lfresh = 0;
+	}
+
+	if (d->len >= 4) {
+		d->buf[d->len++] = c;
+
+		if (d->len == 6) {
+			d->need = le16toh(*(uint16_t *) (d->buf + 4));
+			if (d->need < FRAME_MIN || d->need > FRAME_MAX)
+				d->len = 0;	/* not a frame, resync */
+		} else if (d->len > 6 && d->len == d->need) {
+			uint16_t crc;
+
+			memcpy(&crc, d->buf + d->need - 2, 2);
+			d->crc_ok = le16toh(crc)
+				== crc16_xmodem(d->buf, d->need - 2);
+			d->len = 0;
+			return FRAME_CMD;
+		}
+		return FRAME_NONE;
+	}
+
+	if (d->len && c == (uint8_t) FRAME_MAGIC[d->len]) {
+		d->buf[d->len++] = c;
+		return FRAME_NONE;
+	}
+
+	/* A broken magic isn't text either, C starts over */
+	d->len = 0;
+	if (c == (uint8_t) FRAME_MAGIC[0]) {
+		d->buf[d->len++] = c;
+		return FRAME_NONE;
+	}
+
+	switch (c) {
+	case 0x06:
+		return FRAME_ACK;
+	case 0x15:
+		return FRAME_NAK;
+	case '\n':
+		d->lfresh = 1;
+		return FRAME_LINE;
+	}
+
+	if (isascii(c) && isprint(c) && d->llen < FRAME_LINE_MAX) {
+		d->line[d->llen++] = c;
+		d->line[d->llen] = '\0';
+	}
+
+	if (c == 'C')
+		return FRAME_C;
+
+	if (d->llen == FRAME_LINE_MAX) {
+		d->lfresh = 1;
+		return FRAME_LINE;
+	}
+	return FRAME_NONE;
+}
+
+/*
+  Decode what FD sends until an event, returns it, FRAME_NONE once
+  DEADLINE passed or -1 with errno set.
+*/
+static inline int frame_next(int fd, struct frame_dec *d, int64_t deadline)
+{
+	enum frame_ev ev;
+	uint8_t c;
+	ssize_t ret;
+
+	while ((ret = rx_getc(fd, &c, deadline)) > 0)
+		if ((ev = frame_feed(d, c)) != FRAME_NONE)
+			return ev;
+
+	return ret;
+}
+
+#endif	/* _FRAME_H_ */
@@ -22,16 +22,21 @@
 #include "config.h"
 
 #include "ws63defs.h"
+#include "deadline.h"
 #include "ymodem.h"
 #include "baud.h"
+#include "transport.h"
 
 #include <assert.h>
 #include <ctype.h>
 #include <endian.h>
 #include <errno.h>
+#include <limits.h>
+#include <signal.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/mman.h>
@@ -45,7 +50,215 @@
 #include <IOKit/serial/ioss.h> // IOSSIOSPEED
 #endif
 
-#define UART_READ_TIMEOUT 2
+#ifdef HAVE_LINUX_SERIAL_H
+#include <linux/serial.h>	// TIOCSSERIAL, ASYNC_LOW_LATENCY
+#endif
+
+#if defined(__linux__) && defined(HAVE_TERMIOS2)
+/*
+  The kernel's struct termios2, as <asm/termbits.h> can't be included
+  along with <termios.h>. Some ports swap c_line and c_cc, only the
+  fields around them are ever touched.
+*/
+struct uart_termios2 {
+	tcflag_t	c_iflag;
+	tcflag_t	c_oflag;
+	tcflag_t	c_cflag;
+	tcflag_t	c_lflag;
+	cc_t		c_line;
+	cc_t		c_cc[TERMIOS2_NCCS];
+	speed_t		c_ispeed;
+	speed_t		c_ospeed;
+};
+
+/*
+  Set any integer BAUD on FD through BOTHER. Drivers round to what their
+  divisor can do, so returns the rate read back, or -errno.
+*/
+static inline int uart_set_bother(int fd, int baud)
+{
+	struct uart_termios2 tio;
+
+	if (ioctl(fd, TERMIOS2_TCGETS2, &tio) < 0) {
+		perror("ioctl TCGETS2");
+		return -errno;
+	}
+
+	/* Input follows the output rate with CIBAUD cleared */
+	tio.c_cflag &= ~(CBAUD | CIBAUD);
+	tio.c_cflag |= TERMIOS2_BOTHER;
+	tio.c_ispeed = tio.c_ospeed = baud;
+
+	if (ioctl(fd, TERMIOS2_TCSETS2, &tio) < 0
+	    || ioctl(fd, TERMIOS2_TCGETS2, &tio) < 0) {
+		perror("ioctl TCSETS2");
+		return -errno;
+	}
+
+	return tio.c_ospeed;
+}
+#endif
+
+/* Baudrate the driver applied in the latest uart_open() */
+static int uart_baud;
+
+/* Set by the frontend, applied when uart_open() opens a TTY */
+static struct uart_opts {
+	int	low_latency;
+	int	rtscts;		/* RTS/CTS hardware flow control */
+} uart_opts;
+
+/*
+  Driver settings --low-latency changed, put back at exit or on a fatal
+  signal: the serial flags, and the latency timer of USB serial adapters
+  that have one.
+*/
+static struct uart_saved {
+	int	fd;
+	int	flags;		/* -1 if untouched */
+	int	latency;	/* -1 if untouched */
+	char	latency_path[PATH_MAX];
+} uart_saved = { -1, -1, -1, "" };
+
+/* Latency timer of the adapter, in ms, -1 if there is none */
+static inline int uart_latency_timer_read(void)
+{
+	FILE *f = fopen(uart_saved.latency_path, "r");
+	int ms = -1;
+
+	if (!f)
+		return -1;
+	if (fscanf(f, "%d", &ms) != 1)
+		ms = -1;
+	fclose(f);
+	return ms;
+}
+
+/* No stdio, this runs from a signal handler too */
+static inline int uart_latency_timer_write(int ms)
+{
+	char s[16], *p = s + sizeof(s);
+	ssize_t n;
+	int fd;
+
+	*--p = '\n';
+	do
+		*--p = '0' + ms % 10;
+	while ((ms /= 10) && p > s);
+
+	fd = open(uart_saved.latency_path, O_WRONLY | O_TRUNC);
+	if (fd < 0)
+		return -1;
+	n = write(fd, p, s + sizeof(s) - p);
+	if (close(fd) < 0 || n < 0)
+		return -1;
+	return 0;
+}
+
+/* Switch between the tuned settings (ON) and the ones found (!ON) */
+static inline void uart_low_latency_set(int on)
+{
+#if defined(HAVE_LINUX_SERIAL_H) && defined(TIOCSSERIAL)
+	struct serial_struct ss;
+
+	if (uart_saved.flags >= 0
+	    && ioctl(uart_saved.fd, TIOCGSERIAL, &ss) == 0) {
+		ss.flags = on ? (ss.flags | ASYNC_LOW_LATENCY)
+			: uart_saved.flags;
+		ioctl(uart_saved.fd, TIOCSSERIAL, &ss);
+	}
+#endif
+
+	if (uart_saved.latency >= 0)
+		uart_latency_timer_write(on ? 1 : uart_saved.latency);
+}
+
+static inline void uart_low_latency_restore(void)
+{
+	uart_low_latency_set(0);
+}
+
+/* Put the driver back, then die of SIG as if it weren't caught */
+static inline void uart_low_latency_signal(int sig)
+{
+	int saved = errno;
+
+	uart_low_latency_restore();
+	errno = saved;
+	raise(sig);
+}
+
+static inline void uart_low_latency_on_exit(void)
+{
+	static const int sigs[] = { SIGINT, SIGTERM, SIGHUP, SIGQUIT };
+	struct sigaction sa = { .sa_handler = uart_low_latency_signal,
+				.sa_flags = SA_RESETHAND };
+
+	atexit(uart_low_latency_restore);
+
+	/* Left alone if ignored, as under nohup */
+	for (size_t i = 0; i < sizeof(sigs) / sizeof(*sigs); i++) {
+		struct sigaction old;
+
+		if (sigaction(sigs[i], NULL, &old) == 0
+		    && old.sa_handler != SIG_IGN)
+			sigaction(sigs[i], &sa, NULL);
+	}
+}
+
+/*
+  Have the driver hand over received bytes right away instead of
+  batching them: ASYNC_LOW_LATENCY, and 1 ms for the latency timer of
+  FTDI style adapters (16 ms by default), which else holds back every
+  ymodem ACK. What can't be changed, mostly for lack of permission, is
+  reported and left alone.
+*/
+static inline void uart_low_latency(int fd, const char *ttydev)
+{
+	char path[PATH_MAX];
+	const char *name;
+	int n;
+
+	uart_saved.fd = fd;
+
+#if defined(HAVE_LINUX_SERIAL_H) && defined(TIOCSSERIAL)
+	struct serial_struct ss;
+
+	if (ioctl(fd, TIOCGSERIAL, &ss) == 0) {
+		uart_saved.flags = ss.flags;
+		ss.flags |= ASYNC_LOW_LATENCY;
+		if (ioctl(fd, TIOCSSERIAL, &ss) < 0) {
+			perror("ioctl TIOCSSERIAL");
+			uart_saved.flags = -1;
+		}
+	}
+#endif
+
+	if (!realpath(ttydev, path))
+		snprintf(path, sizeof(path), "%s", ttydev);
+	name = strrchr(path, '/');
+
+	n = snprintf(uart_saved.latency_path, sizeof(uart_saved.latency_path),
+		     "/sys/bus/usb-serial/devices/%s/latency_timer",
+		     name ? name + 1 : path);
+	if (n < 0 || (size_t) n >= sizeof(uart_saved.latency_path))
+		uart_saved.latency_path[0] = '\0';	/* no such timer */
+
+	/* Nothing to do, or to put back, if it's at 1 ms already */
+	uart_saved.latency = uart_latency_timer_read();
+	if (uart_saved.latency <= 1)
+		uart_saved.latency = -1;
+	else if (uart_latency_timer_write(1) < 0) {
+		perror(uart_saved.latency_path);
+		uart_saved.latency = -1;
+	}
+
+	if (uart_saved.flags >= 0 || uart_saved.latency >= 0)
+		uart_low_latency_on_exit();
+}
+
+/* Max silence within a reply frame, in milliseconds */
+#define UART_READ_TIMEOUT 2000
 
 #define SWAP_CMD(x) (((x) << 4) | ((x) >> 4))
 
@@ -57,19 +270,27 @@
         }                                                               \
     } while (0)
 
-static inline int uart_open (int *fd, const char *ttydev, int baud)
+/* Local serial port, the transport by default */
+
+static inline int xport_tty_open(const char *ttydev)
 {
-	struct termios tty;
+	int fd = open(ttydev, O_RDWR | O_NOCTTY | O_SYNC);
 
-	if (*fd == -1) {
-		*fd = open(ttydev, O_RDWR | O_NOCTTY | O_SYNC);
-		if (*fd < 0) {
-			perror("open");
-			return -errno;
-		}
+	if (fd < 0) {
+		perror("open");
+		return -errno;
 	}
 
-	if (tcgetattr(*fd, &tty) < 0) {
+	if (uart_opts.low_latency)
+		uart_low_latency(fd, ttydev);
+	return fd;
+}
+
+static inline int xport_tty_set_baud(int fd, int baud)
+{
+	struct termios tty;
+
+	if (tcgetattr(fd, &tty) < 0) {
 		perror("tcgetattr");
 		return -errno;
 	}
@@ -87,14 +308,13 @@ static inline int uart_open (int *fd, const char *ttydev, int baud)
 		break;
 	}
 
-#if !defined(__APPLE__) || !defined(HAVE_DECL_IOSSIOSPEED)
+#if !BAUD_ANY
 	if (!speed_found) {
 		fprintf(stderr,
 			"failed to switch to baud %d,"
 			"maybe your system doesn't support it?\n",
 			baud);
-		errno = EINVAL;
-		goto err;
+		return -EINVAL;
 	}
 #endif
 
@@ -106,17 +326,20 @@ static inline int uart_open (int *fd, const char *ttydev, int baud)
 	tty.c_lflag = 0;
 	tty.c_oflag = 0;
 	tty.c_cc[VMIN]  = 0;
-	tty.c_cc[VTIME] = 1;
+	tty.c_cc[VTIME] = 0;	/* waiting is done by poll() */
 
 	tty.c_iflag &= ~(IXON | IXOFF | IXANY);
 	tty.c_cflag |= (CLOCAL | CREAD);
 	tty.c_cflag &= ~(PARENB | PARODD);
 	tty.c_cflag &= ~CSTOPB;
-	tty.c_cflag &= ~CRTSCTS;
+	if (uart_opts.rtscts)
+		tty.c_cflag |= CRTSCTS;
+	else
+		tty.c_cflag &= ~CRTSCTS;
 
-	if (tcsetattr(*fd, TCSANOW, &tty) < 0) {
+	if (tcsetattr(fd, TCSANOW, &tty) < 0) {
 		perror("tcsetattr");
-		goto err;
+		return -errno;
 	}
 
 #if defined(__APPLE__) && defined(HAVE_DECL_IOSSIOSPEED)
@@ -126,136 +349,222 @@ static inline int uart_open (int *fd, const char *ttydev, int baud)
 	*/
 	if (!speed_found) {
 		speed_t customBaudRate = (speed_t)baud;
-		if (ioctl(*fd, IOSSIOSPEED, &customBaudRate) < 0) {
+		if (ioctl(fd, IOSSIOSPEED, &customBaudRate) < 0) {
 			fprintf(stderr,
 				"ioctl IOSSIOSPEED custom baud"
 				"rate error\n");
-			errno = EINVAL;
-			goto err;
+			return -EINVAL;
 		}
 	}
 #endif
 
-	return 0;
+#if defined(__linux__) && defined(HAVE_TERMIOS2)
+	if (!speed_found)
+		return uart_set_bother(fd, baud);
+#endif
 
- err:
-	if (*fd > 0) close(*fd);
-	*fd = -1;
-	return -errno;
+	return baud;
 }
 
-static inline int uart_read_until_magic(int fd, int verbose)
+static inline int xport_tty_modem_get(int fd, int *st)
 {
-	char occ, *mgc = "\xef\xbe\xad\xde";
-	uint8_t buf[1024 + 12];
-	int len = 0, i = 0, framelen = 0, st = 0;
-	time_t t0 = time(NULL);
+	return ioctl(fd, TIOCMGET, st) < 0 ? -errno : 0;
+}
 
-	memset(buf, 0, sizeof(buf));
+static inline int xport_tty_modem_set(int fd, int bits, int on)
+{
+	return ioctl(fd, on ? TIOCMBIS : TIOCMBIC, &bits) < 0 ? -errno : 0;
+}
 
-	if (verbose)
-		printf("< ");
+/* TIOCOUTQ, bounded; tcdrain() where the driver can't tell */
+static inline int xport_tty_drain(int fd)
+{
+	int ret = xport_fd_drain(fd);
 
-	while (1) {
-		/* Abort if too far away from the last valid read */
-		if (difftime(time(NULL), t0) > UART_READ_TIMEOUT) {
-			errno = ETIMEDOUT;
-			perror("uart_read_until_magic");
-			return -errno;
-		}
+	if (ret == -ENOTTY || ret == -EINVAL)
+		ret = tcdrain(fd) < 0 ? -errno : 0;
+	return ret;
+}
 
-		len = read(fd, buf + i, 1);
-		if (len == 0)
-			continue;
-		if (len < 0) {
-			perror("read");
-			return -errno;
-		}
+static inline void xport_tty_flush(int fd)
+{
+	tcflush(fd, TCIOFLUSH);
+}
 
-		/* Update last valid char timer */
-		t0 = time(NULL);
+static const struct xport xport_tty = {
+	.name = "tty", .prefix = "",
+	.open = xport_tty_open, .set_baud = xport_tty_set_baud,
+	.modem_get = xport_tty_modem_get, .modem_set = xport_tty_modem_set,
+	.drain = xport_tty_drain, .flush = xport_tty_flush,
+	.close = xport_fd_close,
+};
 
-		switch (st)
-		{
-		case 0:
-			if ((uint8_t)mgc[i] == buf[i]) {
-				if (++i >= 3)
-					st = 1;
-				continue;
-			}
+/* Picked by prefix, the empty one last */
+static const struct xport *const xports[] = {
+	&xport_tcp, &xport_rfc2217, &xport_pty, &xport_tty,
+};
 
-			if (i >= 3) {
-				st = 1;
-				continue;
-			}
+#define XPORTS_N (sizeof(xports) / sizeof(xports[0]))
 
-			i = 0;
+/* Transport of the device opened by uart_open() */
+static const struct xport *uart_xport = &xport_tty;
 
-			if (verbose) {
-				/* if not and verbose enabled, print it */
-				if (isascii(buf[i]) && isprint(buf[i]))
-					printf("%c", (occ = buf[i]));
-				if (buf[i] == '\n' && occ != '\n')
-					printf("%c< ", (occ = buf[i]));
-				fflush(stdout);
-			}
+/* Close *FD, with whatever its transport keeps besides, sets it to -1 */
+static inline void uart_close(int *fd)
+{
+	if (*fd < 0)
+		return;
 
-			continue;
-		case 1:
-			if (i == 5) /* 4:5 are the length to be read */
-				framelen = le16toh(*(uint16_t *)(buf + 4));
-			else if (i == framelen - 1) /* reached the end */
+	rx_forget(*fd);
+	uart_xport->close(*fd);
+	*fd = -1;
+}
+
+/*
+  Open TTYDEV through its transport if *FD is -1, then set BAUD on it.
+  On failure *FD is closed & set to -1.
+*/
+static inline int uart_open (int *fd, const char *ttydev, int baud)
+{
+	int ret;
+
+	if (*fd == -1) {
+		for (size_t i = 0; i < XPORTS_N; i++)
+			if (!strncmp(ttydev, xports[i]->prefix,
+				     strlen(xports[i]->prefix))) {
+				uart_xport = xports[i];
 				break;
-			i++;
-			continue;
-		default:
-			st = 0;
-			continue;
-		}
+			}
 
-		if (verbose > 1) {
-			printf("\n< ");
-			for (int j = 0; j < i + 1; j++)
-				printf("%02x ", buf[j]);
+		*fd = uart_xport->open(ttydev + strlen(uart_xport->prefix));
+		if (*fd < 0) {
+			ret = *fd;
+			*fd = -1;
+			return ret;
 		}
+		rx_forget(*fd);
+	}
 
-		if (*(uint16_t *)(buf + framelen - 2)
-		    != htole16(crc16_xmodem(buf, framelen - 2))) {
-			fprintf(stderr, "Warning: bad crc from cmd frame!\n");
-			break;
+	ret = uart_xport->set_baud(*fd, baud);
+	if (ret < 0) {
+		uart_close(fd);
+		return ret;
+	}
+
+	uart_baud = ret;
+	return 0;
+}
+
+static inline int uart_modem_get(int fd, int *st)
+{
+	return uart_xport->modem_get(fd, st);
+}
+
+static inline int uart_modem_set(int fd, int bits, int on)
+{
+	return uart_xport->modem_set(fd, bits, on);
+}
+
+static inline int uart_drain(int fd)
+{
+	return uart_xport->drain(fd);
+}
+
+static inline void uart_flush(int fd)
+{
+	uart_xport->flush(fd);
+	rx_drop(fd);
+}
+
+/* Read up to the next command frame, showing the text before it */
+static inline int uart_read_until_magic(int fd, int verbose)
+{
+	struct frame_dec dec;
+	int ev;
+
+	frame_dec_init(&dec);
+
+	while (1) {
+		/* Abort if too far away from the last valid read */
+		ev = frame_next(fd, &dec, deadline_in(UART_READ_TIMEOUT));
+
+		if (ev == FRAME_NONE) {
+			errno = ETIMEDOUT;
+			perror("uart_read_until_magic");
+			return -errno;
+		}
+		if (ev < 0) {
+			perror("read");
+			return -errno;
 		}
 
-		break;
+		if (verbose && ev == FRAME_LINE && *dec.line)
+			printf("< %s\n", dec.line);
+
+		if (ev == FRAME_CMD)
+			break;
 	}
 
-	if (verbose)
+	if (verbose > 1) {
+		printf("< ");
+		for (size_t j = 0; j < dec.need; j++)
+			printf("%02x ", dec.buf[j]);
 		printf("\n");
+	}
+
+	if (!dec.crc_ok)
+		fprintf(stderr, "Warning: bad crc from cmd frame!\n");
 
 	return 0;
 }
 
-static inline int ws63_send_cmddef(int fd, struct cmddef cmddef, int verbose)
+/* A command frame as it goes on the wire */
+struct ws63_frame {
+	size_t	len;
+	uint8_t	buf[1024 + 12];
+};
+
+/* Refresh the checksum of F, after its payload was patched */
+static inline void ws63_frame_seal(struct ws63_frame *f)
 {
-	uint8_t buf[1024 + 12];
-	size_t written = 0;
-	size_t total_bytes = cmddef.len + 10;
+	*((uint16_t *)(f->buf + f->len - 2)) =
+		htole16(crc16_xmodem(f->buf, f->len - 2));
+}
+
+static inline void
+ws63_frame_build(struct ws63_frame *f, const struct cmddef *cmddef)
+{
+	f->len = cmddef->len + 10;
 
-	assert(sizeof(buf) > total_bytes);
+	assert(sizeof(f->buf) >= f->len);
 
 	/* Start of Frame, 0xDEADBEEF LE */
-	*((uint32_t *)buf) = htole32(0xdeadbeef);
+	*((uint32_t *)f->buf) = htole32(0xdeadbeef);
 	/* Length */
-	*((uint16_t *)(buf + 4)) = htole16(total_bytes);
+	*((uint16_t *)(f->buf + 4)) = htole16(f->len);
 	/* Payload */
-	buf[6] = cmddef.cmd;
-	buf[7] = SWAP_CMD(cmddef.cmd);
-	memcpy(buf + 8, cmddef.dat, cmddef.len);
+	f->buf[6] = cmddef->cmd;
+	f->buf[7] = SWAP_CMD(cmddef->cmd);
+	memcpy(f->buf + 8, cmddef->dat, cmddef->len);
 	/* Checksum */
-	*((uint16_t *)(buf + 8 + cmddef.len)) =
-		htole16(crc16_xmodem(buf, total_bytes - 2));
+	ws63_frame_seal(f);
+}
+
+/* Patch the LE32 at OFS of the payload, seal the frame afterwards */
+static inline void ws63_frame_put32(struct ws63_frame *f, size_t ofs,
+				    uint32_t val)
+{
+	val = htole32(val);
+	memcpy(f->buf + FRAME_HDR + ofs, &val, 4);
+}
+
+static inline int ws63_frame_send(int fd, const struct ws63_frame *f,
+				  int verbose)
+{
+	size_t written = 0;
 
-	while (written < cmddef.len + 10) {
-		int wrote = write(fd, buf + written, total_bytes - written);
+	while (written < f->len) {
+		int wrote = write(fd, f->buf + written, f->len - written);
 		if (wrote < 0) {
 			perror("write");
 			return -errno;
@@ -265,14 +574,26 @@ static inline int ws63_send_cmddef(int fd, struct cmddef cmddef, int verbose)
 
 	if (verbose > 1) {
 		printf("> ");
-		for (int i = 0; i < total_bytes; i++)
-			printf("%02x ", buf[i]);
+		for (size_t i = 0; i < f->len; i++)
+			printf("%02x ", f->buf[i]);
 		printf("\n");
 	}
 
 	return 0;
 }
 
+/* WS63E_FLASHINFO framed, each built on first use */
+static struct ws63_frame ws63_frames[CMD_END];
+
+static inline struct ws63_frame *ws63_frame_of(enum WS63_CMDTYPE type)
+{
+	struct ws63_frame *f = &ws63_frames[type];
+
+	if (!f->len)
+		ws63_frame_build(f, &WS63E_FLASHINFO[type]);
+	return f;
+}
+
 int copy_part(FILE *fin, FILE *fout, long start, long length)
 {
 	if (fseek(fin, start, SEEK_SET) != 0) {
@@ -304,27 +625,4 @@ int copy_part(FILE *fin, FILE *fout, long start, long length)
 	return 0;
 }
 
-int shm_tmpfile_fd(size_t size)
-{
-	char name[64];
-	snprintf(name, sizeof(name), "/tmpshm-%d-%ld", getpid(), random());
-
-	int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
-	if (fd == -1) {
-		perror("shm_open");
-		return -1;
-	}
-
-	if (ftruncate(fd, size) == -1) {
-		perror("ftruncate");
-		close(fd);
-		shm_unlink(name);
-		return -1;
-	}
-
-	shm_unlink(name);
-
-	return fd;
-}
-
 #endif /* _WS63_FLASH_IO_H_ */
@@ -0,0 +1,151 @@
+/*
+  plan.h - Download Planner for Coalescing Adjacent Bins
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _PLAN_H_
+#define _PLAN_H_
+
+#include "config.h"
+
+#include "sparse.h"
+#include "xfer_src.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Width of the name column of the bin table */
+#define PLAN_NAME_MAX	31
+
+/* One download, i.e. a CMD_DOWNLOADI with its ymodem session */
+struct plan_item {
+	const char	*name;
+	struct xfer_src	 src;
+	uint32_t	 addr;
+	int		 nmerged;	/* > 1 if name & the buffer are malloc'd */
+};
+
+/* End of the range CMD_DOWNLOADI erases for LEN bytes at ADDR */
+static inline uint64_t plan_erase_end(uint32_t addr, size_t len)
+{
+	return addr + (uint64_t) (len + FLASH_ERASE_SIZE - 1)
+		/ FLASH_ERASE_SIZE * FLASH_ERASE_SIZE;
+}
+
+/*
+  Coalesce consecutive ITEMS that follow each other in flash into a
+  single download. An item joins the previous one when it starts no
+  earlier than where that ends, and no further than GAP bytes past the
+  erase range of it; the gap in between is filled with 0xFF, what the
+  erase leaves there anyway. A negative GAP disables merging. ITEMS
+  are rewritten in place, returns the new count or -1 if out of memory
+  or an image couldn't be read.
+*/
+static inline int plan_merge(struct plan_item *items, int n, long gap)
+{
+	int out = 0;
+
+	for (int i = 0, j; i < n; i = j) {
+		uint64_t end = (uint64_t) items[i].addr + items[i].src.len;
+
+		for (j = i + 1; gap >= 0 && j < n; j++) {
+			uint64_t eras_end = plan_erase_end(items[i].addr,
+							   end - items[i].addr);
+
+			if (items[j].addr < end
+			    || items[j].addr > eras_end + gap)
+				break;
+
+			end = (uint64_t) items[j].addr + items[j].src.len;
+		}
+
+		if (j - i == 1) {
+			items[out++] = items[i];
+			continue;
+		}
+
+		/*
+		  Named after the first, "+N" for the N that joined it,
+		  cut to fit the bin table
+		*/
+		size_t len = end - items[i].addr;
+		uint8_t *dat = malloc(len);
+		char *name = malloc(PLAN_NAME_MAX + 1);
+		char more[16];
+		int mlen = snprintf(more, sizeof(more), "+%d", j - i - 1);
+
+		if (!dat || !name) {
+			free(dat);
+			free(name);
+			return -1;
+		}
+
+		memset(dat, 0xff, len);
+		snprintf(name, PLAN_NAME_MAX + 1, "%.*s%s",
+			 PLAN_NAME_MAX - mlen, items[i].name, more);
+
+		for (int k = i; k < j; k++) {
+			if (xfer_src_read(&items[k].src, 0,
+					  dat + (items[k].addr - items[i].addr),
+					  items[k].src.len) < 0) {
+				free(dat);
+				free(name);
+				return -1;
+			}
+		}
+
+		items[out++] = (struct plan_item) {
+			.name = name, .src = xfer_src_buf(dat, len),
+			.addr = items[i].addr, .nmerged = j - i,
+		};
+	}
+
+	return out;
+}
+
+/* Append the merged downloads to a bin table, if there are any */
+static inline void
+plan_print(FILE *out, const struct plan_item *items, int n)
+{
+	int merged = 0;
+
+	for (int i = 0; i < n; i++) {
+		if (items[i].nmerged < 2)
+			continue;
+
+		fprintf(out, "|+|%-31s|0x%08zx|0x%08x|1|\n", items[i].name,
+			items[i].src.len, items[i].addr);
+		merged = 1;
+	}
+
+	if (merged)
+		fprintf(out, "+-+-------------------------------+----------+----------+-+\n");
+}
+
+static inline void plan_free(struct plan_item *items, int n)
+{
+	for (int i = 0; i < n; i++) {
+		if (items[i].nmerged < 2)
+			continue;
+		free((void *) items[i].name);
+		free((void *) items[i].src.dat);
+	}
+}
+
+#endif	/* _PLAN_H_ */
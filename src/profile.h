@@ -0,0 +1,229 @@
+/*
+  profile.h - Per Adapter Link Profiles
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#include "config.h"
+
+#include "cost.h"
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+  What worked the last time through one serial adapter, so the next run
+  starts there. Adapters are told apart by their USB identity, which
+  stays the same when they come back under another ttyUSBn.
+*/
+struct link_profile {
+	char	key[160];
+	int	baud;		/* last rate a run got through at, 0 if none */
+	int	late_baud;	/* SETBAUDR after loaderBoot: 1 works, 0 not,
+				   -1 unknown */
+	double	rtt_ms;		/* frame turnaround beyond wire time */
+	double	err_rate;	/* NAKs & timeouts per data frame */
+	int	ack_ms;		/* slowest ymodem ACK of clean runs, 0 if none */
+	int	reset_ms;	/* from a DTR/RTS reset to the ROM's ACK */
+	int	flow;		/* RTS/CTS honored: 1, not: 0, -1 unknown */
+	int	low_latency;	/* --low-latency cut the round trip: 1 */
+};
+
+#define PROFILE_FILE "profiles"
+
+/* Error rate past which the next run starts a rung lower */
+#define PROFILE_ERR_MAX 0.02
+
+/*
+  Timeouts the profile sets: this many times the time seen, but no less
+  than PROFILE_TIMEOUT_MIN and never longer than the default
+*/
+#define PROFILE_TIMEOUT_X	4
+#define PROFILE_TIMEOUT_MIN	200
+
+static inline int profile_timeout(int seen_ms, int dflt)
+{
+	int ms = seen_ms * PROFILE_TIMEOUT_X;
+
+	if (seen_ms <= 0 || ms > dflt)
+		return dflt;
+	return ms < PROFILE_TIMEOUT_MIN ? PROFILE_TIMEOUT_MIN : ms;
+}
+
+/* Keys are single words in the profile file */
+static inline void profile_sanitize(char *s)
+{
+	for (; *s; s++)
+		if (!isgraph((unsigned char) *s))
+			*s = '_';
+}
+
+#ifdef __linux__
+/* First line of sysfs attribute DIR/NAME to BUF, -1 if there is none */
+static inline int sysfs_read(const char *dir, const char *name, char *buf,
+			     size_t len)
+{
+	char path[PATH_MAX];
+	FILE *f;
+	int n;
+
+	n = snprintf(path, sizeof(path), "%s/%s", dir, name);
+	if (n < 0 || (size_t) n >= sizeof(path))
+		return -1;
+
+	f = fopen(path, "r");
+	if (!f)
+		return -1;
+
+	if (!fgets(buf, len, f)) {
+		fclose(f);
+		return -1;
+	}
+	fclose(f);
+
+	buf[strcspn(buf, "\n")] = '\0';
+	return 0;
+}
+#endif
+
+/*
+  Key of the adapter behind TTY: VID:PID and its serial number, or the
+  USB port path when it has none. Anything else is known by its device
+  path only.
+*/
+static inline void profile_key(const char *tty, char *key, size_t len)
+{
+	char path[PATH_MAX];
+
+	if (!realpath(tty, path))
+		snprintf(path, sizeof(path), "%s", tty);
+
+#ifdef __linux__
+	char sys[PATH_MAX], dev[PATH_MAX], vid[8], pid[8], serial[64], *sl;
+	const char *name = strrchr(path, '/');
+	int n;
+
+	n = snprintf(sys, sizeof(sys), "/sys/class/tty/%s/device",
+		     name ? name + 1 : path);
+
+	/* Walk up from the interface to the USB device owning it */
+	if (n > 0 && (size_t) n < sizeof(sys) && realpath(sys, dev))
+		for (; (sl = strrchr(dev, '/')) && sl != dev; *sl = '\0') {
+			if (sysfs_read(dev, "idVendor", vid, sizeof(vid)) < 0
+			    || sysfs_read(dev, "idProduct", pid,
+					  sizeof(pid)) < 0)
+				continue;
+
+			if (sysfs_read(dev, "serial", serial,
+				       sizeof(serial)) == 0 && *serial)
+				snprintf(key, len, "usb:%s:%s:%s",
+					 vid, pid, serial);
+			else
+				snprintf(key, len, "usb:%s:%s@%s",
+					 vid, pid, strrchr(dev, '/') + 1);
+
+			profile_sanitize(key);
+			return;
+		}
+#endif
+
+	/* Cut short, the end of the path still tells devices apart */
+	size_t plen = strlen(path), room = len - sizeof("tty:");
+
+	if (snprintf(key, len, "tty:%s",
+		     plen > room ? path + plen - room : path) < 0)
+		*key = '\0';
+	profile_sanitize(key);
+}
+
+/* Profile of the adapter KEY, returns 1 if one was kept before */
+static inline int profile_load(const char *key, struct link_profile *p)
+{
+	char path[PATH_MAX], line[256], k[sizeof(p->key)];
+	struct link_profile tmp;
+	FILE *f;
+	int found = 0;
+
+	*p = (struct link_profile) { .late_baud = -1, .flow = -1 };
+	snprintf(p->key, sizeof(p->key), "%s", key);
+
+	if (cost_cache_path(path, sizeof(path), PROFILE_FILE, 0) < 0)
+		return 0;
+
+	f = fopen(path, "r");
+	if (!f)
+		return 0;
+
+	/* Lines of older versions stop after the error rate */
+	while (fgets(line, sizeof(line), f)) {
+		tmp = (struct link_profile) { .flow = -1 };
+		if (sscanf(line, "%159s %d %d %lf %lf %d %d %d %d", k,
+			   &tmp.baud, &tmp.late_baud, &tmp.rtt_ms,
+			   &tmp.err_rate, &tmp.ack_ms, &tmp.reset_ms,
+			   &tmp.flow, &tmp.low_latency) < 5
+		    || strcmp(k, key))
+			continue;
+
+		memcpy(tmp.key, k, sizeof(k));
+		*p = tmp;
+		found = 1;
+	}
+
+	fclose(f);
+	return found;
+}
+
+/* Store P, replacing what was kept for its adapter */
+static inline int profile_save(const struct link_profile *p)
+{
+	char path[PATH_MAX], tmp[PATH_MAX + 4], line[256], k[sizeof(p->key)];
+	FILE *in, *out;
+
+	if (cost_cache_path(path, sizeof(path), PROFILE_FILE, 1) < 0)
+		return -1;
+	snprintf(tmp, sizeof(tmp), "%s.new", path);
+
+	out = fopen(tmp, "w");
+	if (!out)
+		return -1;
+
+	in = fopen(path, "r");
+	if (in) {
+		while (fgets(line, sizeof(line), in))
+			if (sscanf(line, "%159s", k) == 1
+			    && strcmp(k, p->key))
+				fputs(line, out);
+		fclose(in);
+	}
+
+	fprintf(out, "%s %d %d %.3f %.5f %d %d %d %d\n", p->key, p->baud,
+		p->late_baud, p->rtt_ms, p->err_rate, p->ack_ms, p->reset_ms,
+		p->flow, p->low_latency);
+
+	if (fclose(out) < 0 || rename(tmp, path) < 0) {
+		unlink(tmp);
+		return -1;
+	}
+	return 0;
+}
+
+#endif	/* _PROFILE_H_ */
@@ -0,0 +1,159 @@
+/*
+  rxring.h - Buffered Serial Port Reads
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _RXRING_H_
+#define _RXRING_H_
+
+#include "config.h"
+#include "deadline.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/types.h>
+
+/*
+  Receive ring of a port. Replies are picked apart a byte at a time,
+  ACKs, Cs and command frames alike; instead of a read(2) for each, the
+  ring takes whatever the driver has in one go and hands it out from
+  here. Only the thread driving the protocol reads a port, so there is
+  no locking. Timeouts are those of read_deadline(): a byte that is
+  buffered already is returned even if the deadline passed.
+*/
+
+#define RX_RING_SIZE	4096	/* power of 2 */
+#define RX_RING_PORTS	8
+
+struct rx_ring {
+	int		 fd;
+	int		 used;
+	size_t		 head, tail;	/* free running, tail - head buffered */
+	uint8_t		 buf[RX_RING_SIZE];
+};
+
+static struct rx_ring rx_rings[RX_RING_PORTS];
+
+/* Ring of FD, taking a free one if it has none. NULL if all are taken. */
+static inline struct rx_ring *rx_ring_of(int fd)
+{
+	struct rx_ring *slot = NULL;
+
+	for (int i = 0; i < RX_RING_PORTS; i++) {
+		if (rx_rings[i].used && rx_rings[i].fd == fd)
+			return &rx_rings[i];
+		if (!rx_rings[i].used && !slot)
+			slot = &rx_rings[i];
+	}
+
+	if (slot) {
+		slot->fd = fd;
+		slot->used = 1;
+		slot->head = slot->tail = 0;
+	}
+	return slot;
+}
+
+/* Read as much as fits in one go, returns like read_deadline() */
+static inline ssize_t rx_ring_fill(struct rx_ring *r, int64_t deadline)
+{
+	size_t ofs, room;
+	ssize_t ret;
+
+	/* Start over at the front when empty, for the longest reads */
+	if (r->head == r->tail)
+		r->head = r->tail = 0;
+
+	ofs = r->tail & (RX_RING_SIZE - 1);
+	room = RX_RING_SIZE - (r->tail - r->head);
+	if (room > RX_RING_SIZE - ofs)
+		room = RX_RING_SIZE - ofs;
+
+	ret = read_deadline(r->fd, r->buf + ofs, room, deadline);
+	if (ret > 0)
+		r->tail += ret;
+	return ret;
+}
+
+/*
+  Up to LEN bytes from FD, sleeping until something arrives or DEADLINE
+  passes. Returns the bytes read, 0 on timeout or -1 with errno set.
+*/
+static inline ssize_t rx_read(int fd, void *buf, size_t len, int64_t deadline)
+{
+	struct rx_ring *r = rx_ring_of(fd);
+	size_t n = 0;
+
+	if (!r)
+		return read_deadline(fd, buf, len, deadline);
+
+	if (r->head == r->tail) {
+		ssize_t ret = rx_ring_fill(r, deadline);
+
+		if (ret <= 0)
+			return ret;
+	}
+
+	/* At most two runs, before & after the wrap */
+	while (n < len && r->head != r->tail) {
+		size_t ofs = r->head & (RX_RING_SIZE - 1);
+		size_t run = r->tail - r->head;
+
+		if (run > RX_RING_SIZE - ofs)
+			run = RX_RING_SIZE - ofs;
+		if (run > len - n)
+			run = len - n;
+
+		memcpy((uint8_t *) buf + n, r->buf + ofs, run);
+		r->head += run;
+		n += run;
+	}
+
+	return n;
+}
+
+/* One byte from FD, returns like rx_read() */
+static inline ssize_t rx_getc(int fd, uint8_t *c, int64_t deadline)
+{
+	struct rx_ring *r = rx_ring_of(fd);
+
+	if (r && r->head != r->tail) {
+		*c = r->buf[r->head++ & (RX_RING_SIZE - 1)];
+		return 1;
+	}
+
+	return rx_read(fd, c, 1, deadline);
+}
+
+/* Drop whatever FD has buffered, when the port itself is flushed */
+static inline void rx_drop(int fd)
+{
+	struct rx_ring *r = rx_ring_of(fd);
+
+	if (r)
+		r->head = r->tail = 0;
+}
+
+/* FD is closed, or a new port got its number */
+static inline void rx_forget(int fd)
+{
+	for (int i = 0; i < RX_RING_PORTS; i++)
+		if (rx_rings[i].used && rx_rings[i].fd == fd)
+			rx_rings[i].used = 0;
+}
+
+#endif	/* _RXRING_H_ */
@@ -0,0 +1,136 @@
+/*
+  sparse.h - Erased Region Scanner for Sparse Flashing
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _SPARSE_H_
+#define _SPARSE_H_
+
+#include "config.h"
+
+#include "xfer_src.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/* Erase granularity of CMD_DOWNLOADI */
+#define FLASH_ERASE_SIZE 0x2000
+
+/* A range of the image, relative to its start */
+struct sparse_seg {
+	size_t	ofs;
+	size_t	len;
+};
+
+/* Whether LEN bytes at P are all 0xFF, i.e. what an erase leaves */
+static inline int sparse_blank(const uint8_t *p, size_t len)
+{
+#if defined(__SSE2__)
+	const __m128i ones = _mm_set1_epi8(-1);
+
+	for (; len >= 64; p += 64, len -= 64) {
+		__m128i a = _mm_and_si128(_mm_loadu_si128((const void *) p),
+					  _mm_loadu_si128((const void *) (p + 16)));
+		__m128i b = _mm_and_si128(_mm_loadu_si128((const void *) (p + 32)),
+					  _mm_loadu_si128((const void *) (p + 48)));
+
+		a = _mm_cmpeq_epi8(_mm_and_si128(a, b), ones);
+		if (_mm_movemask_epi8(a) != 0xffff)
+			return 0;
+	}
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+	for (; len >= 64; p += 64, len -= 64) {
+		uint8x16_t a = vandq_u8(vld1q_u8(p), vld1q_u8(p + 16));
+		uint8x16_t b = vandq_u8(vld1q_u8(p + 32), vld1q_u8(p + 48));
+
+		if (vminvq_u8(vandq_u8(a, b)) != 0xff)
+			return 0;
+	}
+#endif
+
+	for (; len >= 8; p += 8, len -= 8) {
+		uint64_t w;
+
+		memcpy(&w, p, sizeof(w));
+		if (w != UINT64_MAX)
+			return 0;
+	}
+
+	for (; len; p++, len--)
+		if (*p != 0xff)
+			return 0;
+
+	return 1;
+}
+
+/*
+  Split an image to be burnt at ADDR into the ranges that need
+  programming. Erase blocks (aligned to ADDR in flash) that are entirely
+  0xFF are left out. Returns the number of segments stored to a malloc'd
+  *SEGS, or -1 if out of memory or SRC couldn't be read.
+*/
+static inline int
+sparse_plan(const struct xfer_src *src, uint32_t addr,
+	    struct sparse_seg **segs)
+{
+	size_t ofs = 0, len = src->len, nchunk = len / FLASH_ERASE_SIZE + 2;
+	uint8_t scratch[FLASH_ERASE_SIZE];
+	int n = 0;
+
+	*segs = malloc(sizeof(**segs) * (nchunk / 2 + 1));
+	if (!*segs)
+		return -1;
+
+	while (ofs < len) {
+		size_t end = (addr + ofs) / FLASH_ERASE_SIZE * FLASH_ERASE_SIZE
+			+ FLASH_ERASE_SIZE - addr;
+		const uint8_t *blk;
+
+		if (end > len)
+			end = len;
+
+		blk = xfer_src_get(src, ofs, end - ofs, scratch);
+		if (!blk) {
+			free(*segs);
+			return -1;
+		}
+
+		if (!sparse_blank(blk, end - ofs)) {
+			struct sparse_seg *last = n ? &(*segs)[n - 1] : NULL;
+
+			if (last && last->ofs + last->len == ofs)
+				last->len += end - ofs;
+			else
+				(*segs)[n++] = (struct sparse_seg) {
+					ofs, end - ofs
+				};
+		}
+
+		ofs = end;
+	}
+
+	return n;
+}
+
+#endif	/* _SPARSE_H_ */
@@ -0,0 +1,636 @@
+/*
+  transport.h - Serial Port Transports
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _TRANSPORT_H_
+#define _TRANSPORT_H_
+
+#include "config.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+/*
+  Where the board is reached through. Every transport hands out a file
+  descriptor the protocol reads & writes plain bytes on, and polls; the
+  ymodem and command code never see anything else. What differs is how
+  it is opened, how the baudrate is set and how the modem lines are
+  seen. The device argument picks one by its prefix, a local tty by
+  default:
+
+    /dev/ttyUSB0		local serial port
+    tcp:HOST:PORT		raw TCP to a serial server, e.g. ser2net
+    rfc2217:HOST:PORT		telnet COM-PORT-OPTION, remote baudrate
+    pty:[COMMAND]		pseudo terminal, a stand-in device for testing
+*/
+struct xport {
+	const char	*name;
+	const char	*prefix;
+
+	/* Open the device PATH, prefix stripped, returns a fd or -errno */
+	int	(*open)(const char *path);
+	/* Set BAUD, returns the rate actually applied or -errno */
+	int	(*set_baud)(int fd, int baud);
+	/* TIOCM_* modem lines, -errno if they can't be seen */
+	int	(*modem_get)(int fd, int *st);
+	/* Assert TIOCM_DTR/TIOCM_RTS lines BITS if ON, else drop them */
+	int	(*modem_set)(int fd, int bits, int on);
+	/* Wait until what was written went out, -errno if it didn't */
+	int	(*drain)(int fd);
+	/* Drop whatever is pending in both directions */
+	void	(*flush)(int fd);
+	void	(*close)(int fd);
+};
+
+/* Connect to HOST:PORT, with Nagle off, every ACK counts */
+static inline int xport_connect(const char *spec)
+{
+	struct addrinfo hints = {
+		.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM,
+	}, *res, *ai;
+	char host[256];
+	const char *port = strrchr(spec, ':');
+	int fd = -1, one = 1, ret;
+
+	if (!port || port == spec || (size_t) (port - spec) >= sizeof(host)) {
+		fprintf(stderr, "%s: expected HOST:PORT\n", spec);
+		return -EINVAL;
+	}
+
+	/* [v6]:port */
+	if (*spec == '[' && port[-1] == ']')
+		snprintf(host, sizeof(host), "%.*s", (int) (port - spec) - 2,
+			 spec + 1);
+	else
+		snprintf(host, sizeof(host), "%.*s", (int) (port - spec), spec);
+
+	ret = getaddrinfo(host, port + 1, &hints, &res);
+	if (ret) {
+		fprintf(stderr, "%s: %s\n", spec, gai_strerror(ret));
+		return -EHOSTUNREACH;
+	}
+
+	for (ai = res; ai; ai = ai->ai_next) {
+		fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+		if (fd < 0)
+			continue;
+		if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+			break;
+		close(fd);
+		fd = -1;
+	}
+	freeaddrinfo(res);
+
+	if (fd < 0) {
+		perror(spec);
+		return -errno;
+	}
+
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	return fd;
+}
+
+/* Longest wait for the output queue to empty, in milliseconds */
+#define XPORT_DRAIN_TIMEOUT	1000
+
+/* Wait for the bytes queued on FD to be sent, by polling TIOCOUTQ */
+static inline int xport_fd_drain(int fd)
+{
+	int n;
+
+	for (int i = 0; i < XPORT_DRAIN_TIMEOUT; i++) {
+		if (ioctl(fd, TIOCOUTQ, &n) < 0)
+			return -errno;
+		if (n <= 0)
+			return 0;
+		poll(NULL, 0, 1);
+	}
+
+	return -ETIMEDOUT;
+}
+
+static inline void xport_fd_flush(int fd)
+{
+	struct pollfd pfd = { .fd = fd, .events = POLLIN };
+	char buf[256];
+
+	while (poll(&pfd, 1, 0) > 0 && read(fd, buf, sizeof(buf)) > 0)
+		;
+}
+
+static inline void xport_fd_close(int fd)
+{
+	close(fd);
+}
+
+static inline int xport_no_modem(int fd, int *st)
+{
+	(void) fd; (void) st;
+	return -ENOTSUP;
+}
+
+static inline int xport_no_modem_set(int fd, int bits, int on)
+{
+	(void) fd; (void) bits; (void) on;
+	return -ENOTSUP;
+}
+
+/* Raw TCP: the server's port is configured on its side, rate included */
+
+static inline int xport_tcp_set_baud(int fd, int baud)
+{
+	(void) fd;
+	return baud;
+}
+
+static const struct xport xport_tcp = {
+	.name = "tcp", .prefix = "tcp:",
+	.open = xport_connect, .set_baud = xport_tcp_set_baud,
+	.modem_get = xport_no_modem, .modem_set = xport_no_modem_set,
+	.drain = xport_fd_drain, .flush = xport_fd_flush,
+	.close = xport_fd_close,
+};
+
+/*
+  RFC 2217: telnet with the COM-PORT-OPTION, which sets the baudrate of
+  the remote port. 0xFF in the data is doubled on the wire and commands
+  come in between, so a relay thread does the telnet side between the
+  socket and a socketpair, whose other end is what the protocol gets.
+*/
+
+#define TN_IAC		255
+#define TN_DONT		254
+#define TN_DO		253
+#define TN_WONT		252
+#define TN_WILL		251
+#define TN_SB		250
+#define TN_SE		240
+
+#define TN_BINARY	0
+#define TN_SGA		3
+#define TN_COMPORT	44
+
+/* COM-PORT-OPTION commands, the server answers with them + 100 */
+#define CPO_SET_BAUDRATE	1
+#define CPO_SET_DATASIZE	2
+#define CPO_SET_PARITY		3
+#define CPO_SET_STOPSIZE	4
+#define CPO_SET_CONTROL		5
+#define CPO_NOTIFY_MODEMSTATE	7
+#define CPO_PURGE_DATA		12
+#define CPO_SERVER		100
+
+#define CPO_MODEM_CTS		0x10
+
+/* SET-CONTROL values */
+#define CPO_DTR_ON		8
+#define CPO_DTR_OFF		9
+#define CPO_RTS_ON		11
+#define CPO_RTS_OFF		12
+
+#define RFC2217_REPLY_TIMEOUT	1000
+
+static struct rfc2217 {
+	int		 sock;		/* to the server */
+	int		 fd;		/* relay's end of the socketpair */
+	pthread_t	 th;		/* the relay, joined on close */
+	pthread_mutex_t	 lock;		/* writes to sock */
+
+	atomic_int	 baud;		/* as the server acknowledged it */
+	atomic_int	 modem;		/* latest NOTIFY-MODEMSTATE, or -1 */
+} rfc2217 = {
+	.sock = -1, .fd = -1, .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static inline int rfc2217_send(const uint8_t *buf, size_t len)
+{
+	int ret = 0;
+
+	pthread_mutex_lock(&rfc2217.lock);
+	while (len && ret >= 0) {
+		ret = send(rfc2217.sock, buf, len, MSG_NOSIGNAL);
+		if (ret < 0 && errno == EINTR)
+			ret = 0;
+		else if (ret > 0) {
+			buf += ret;
+			len -= ret;
+		}
+	}
+	pthread_mutex_unlock(&rfc2217.lock);
+
+	return ret < 0 ? -errno : 0;
+}
+
+/* IAC SB COM-PORT-OPTION CMD VAL IAC SE, VAL of LEN bytes big-endian */
+static inline int rfc2217_cmd(uint8_t cmd, uint32_t val, int len)
+{
+	uint8_t buf[16];
+	size_t n = 0;
+
+	buf[n++] = TN_IAC;
+	buf[n++] = TN_SB;
+	buf[n++] = TN_COMPORT;
+	buf[n++] = cmd;
+	for (int i = len - 1; i >= 0; i--)
+		if ((buf[n++] = val >> (i * 8)) == TN_IAC)
+			buf[n++] = TN_IAC;
+	buf[n++] = TN_IAC;
+	buf[n++] = TN_SE;
+
+	return rfc2217_send(buf, n);
+}
+
+/* A subnegotiation from the server, SB & SE stripped, IACs undoubled */
+static inline void rfc2217_sb(const uint8_t *sb, size_t len)
+{
+	if (len < 2 || sb[0] != TN_COMPORT)
+		return;
+
+	if (sb[1] == CPO_SERVER + CPO_SET_BAUDRATE && len >= 6)
+		atomic_store(&rfc2217.baud, (int) ((uint32_t) sb[2] << 24
+						   | sb[3] << 16
+						   | sb[4] << 8 | sb[5]));
+	else if (sb[1] == CPO_SERVER + CPO_NOTIFY_MODEMSTATE && len >= 3)
+		atomic_store(&rfc2217.modem, sb[2]);
+}
+
+/* Accept what we asked for, refuse anything else */
+static inline void rfc2217_negotiate(uint8_t verb, uint8_t opt)
+{
+	uint8_t reply[3] = { TN_IAC, verb == TN_DO ? TN_WONT : TN_DONT, opt };
+
+	/* WONT & DONT are answers already, replying to them loops */
+	if (opt == TN_BINARY || opt == TN_SGA || opt == TN_COMPORT
+	    || verb == TN_WONT || verb == TN_DONT)
+		return;
+
+	rfc2217_send(reply, sizeof(reply));
+}
+
+static inline void *rfc2217_relay(void *arg)
+{
+	struct pollfd pfd[2] = {
+		{ .fd = rfc2217.sock, .events = POLLIN },
+		{ .fd = rfc2217.fd, .events = POLLIN },
+	};
+	enum { DATA, IAC, VERB, SB, SB_IAC } st = DATA;
+	/* Each way its own buffer, both may be ready at once */
+	uint8_t in[1024], down[1024], up[2 * 1024], sb[64], verb = 0;
+	size_t sblen = 0;
+
+	(void) arg;
+
+	while (poll(pfd, 2, -1) >= 0 || errno == EINTR) {
+		ssize_t len;
+		size_t n;
+
+		/* Server to the protocol, telnet stripped */
+		if (pfd[0].revents) {
+			n = 0;
+			len = read(rfc2217.sock, in, sizeof(in));
+			if (len <= 0)
+				break;
+
+			for (ssize_t i = 0; i < len; i++) {
+				uint8_t c = in[i];
+
+				switch (st) {
+				case DATA:
+					if (c == TN_IAC)
+						st = IAC;
+					else
+						down[n++] = c;
+					break;
+				case IAC:
+					st = DATA;
+					if (c == TN_IAC)
+						down[n++] = c;
+					else if (c == TN_SB)
+						st = SB, sblen = 0;
+					else if (c >= TN_WILL)
+						st = VERB, verb = c;
+					break;
+				case VERB:
+					rfc2217_negotiate(verb, c);
+					st = DATA;
+					break;
+				case SB:
+					if (c == TN_IAC)
+						st = SB_IAC;
+					else if (sblen < sizeof(sb))
+						sb[sblen++] = c;
+					break;
+				case SB_IAC:
+					if (c == TN_SE) {
+						rfc2217_sb(sb, sblen);
+						st = DATA;
+						break;
+					}
+					if (sblen < sizeof(sb))
+						sb[sblen++] = c;
+					st = SB;
+					break;
+				}
+			}
+
+			if (n && send(rfc2217.fd, down, n, MSG_NOSIGNAL) < 0)
+				break;
+		}
+
+		/* The protocol to the server, IAC doubled */
+		if (pfd[1].revents) {
+			n = 0;
+			len = read(rfc2217.fd, in, sizeof(in));
+			if (len <= 0)
+				break;
+
+			for (ssize_t i = 0; i < len; i++)
+				if ((up[n++] = in[i]) == TN_IAC)
+					up[n++] = TN_IAC;
+
+			if (rfc2217_send(up, n) < 0)
+				break;
+		}
+	}
+
+	/* Let the protocol side see the connection is gone */
+	shutdown(rfc2217.fd, SHUT_RDWR);
+	return NULL;
+}
+
+static inline int xport_rfc2217_open(const char *spec)
+{
+	static const uint8_t hello[] = {
+		TN_IAC, TN_WILL, TN_BINARY, TN_IAC, TN_DO, TN_BINARY,
+		TN_IAC, TN_WILL, TN_SGA, TN_IAC, TN_DO, TN_SGA,
+		TN_IAC, TN_WILL, TN_COMPORT,
+	};
+	int sv[2], ret;
+
+	rfc2217.sock = xport_connect(spec);
+	if (rfc2217.sock < 0)
+		return rfc2217.sock;
+
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+		perror("socketpair");
+		close(rfc2217.sock);
+		return -errno;
+	}
+	rfc2217.fd = sv[1];
+	atomic_init(&rfc2217.baud, 0);
+	atomic_init(&rfc2217.modem, -1);
+
+	/* 8N1 like any local port, the rate comes with set_baud */
+	if (rfc2217_send(hello, sizeof(hello)) < 0
+	    || rfc2217_cmd(CPO_SET_DATASIZE, 8, 1) < 0
+	    || rfc2217_cmd(CPO_SET_PARITY, 1, 1) < 0
+	    || rfc2217_cmd(CPO_SET_STOPSIZE, 1, 1) < 0) {
+		perror(spec);
+		goto err;
+	}
+
+	ret = pthread_create(&rfc2217.th, NULL, rfc2217_relay, NULL);
+	if (ret) {
+		errno = ret;
+		perror("pthread_create");
+		goto err;
+	}
+
+	return sv[0];
+
+ err:
+	ret = -errno;
+	close(sv[0]);
+	close(sv[1]);
+	close(rfc2217.sock);
+	rfc2217.fd = rfc2217.sock = -1;
+	return ret;
+}
+
+/* Ask the server for BAUD and wait for it to say what it applied */
+static inline int xport_rfc2217_set_baud(int fd, int baud)
+{
+	int64_t deadline;
+	struct timespec ts;
+	int ret;
+
+	(void) fd;
+	atomic_store(&rfc2217.baud, 0);
+
+	ret = rfc2217_cmd(CPO_SET_BAUDRATE, baud, 4);
+	if (ret < 0)
+		return ret;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	deadline = (int64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000
+		+ RFC2217_REPLY_TIMEOUT;
+
+	while (!(ret = atomic_load(&rfc2217.baud))) {
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		if ((int64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000
+		    >= deadline) {
+			fprintf(stderr, "rfc2217: no reply to SET-BAUDRATE, "
+				"assuming %d\n", baud);
+			return baud;
+		}
+		poll(NULL, 0, 1);
+	}
+
+	return ret;
+}
+
+static inline int xport_rfc2217_modem_get(int fd, int *st)
+{
+	int ms = atomic_load(&rfc2217.modem);
+
+	(void) fd;
+	if (ms < 0)
+		return -ENOTSUP;
+
+	*st = (ms & CPO_MODEM_CTS) ? TIOCM_CTS : 0;
+	return 0;
+}
+
+static inline int xport_rfc2217_modem_set(int fd, int bits, int on)
+{
+	int ret = 0;
+
+	(void) fd;
+	if (bits & TIOCM_DTR)
+		ret = rfc2217_cmd(CPO_SET_CONTROL,
+				  on ? CPO_DTR_ON : CPO_DTR_OFF, 1);
+	if (ret == 0 && (bits & TIOCM_RTS))
+		ret = rfc2217_cmd(CPO_SET_CONTROL,
+				  on ? CPO_RTS_ON : CPO_RTS_OFF, 1);
+	return ret;
+}
+
+/* Through the relay, then out of the socket */
+static inline int xport_rfc2217_drain(int fd)
+{
+	int ret = xport_fd_drain(fd);
+
+	return ret < 0 ? ret : xport_fd_drain(rfc2217.sock);
+}
+
+static inline void xport_rfc2217_flush(int fd)
+{
+	rfc2217_cmd(CPO_PURGE_DATA, 3, 1);	/* both buffers */
+	xport_fd_flush(fd);
+}
+
+/*
+  With its end of the socketpair closed & the socket shut down, the
+  relay sees EOF either way and returns, then what it used goes too
+*/
+static inline void xport_rfc2217_close(int fd)
+{
+	close(fd);
+	shutdown(rfc2217.sock, SHUT_RDWR);
+	pthread_join(rfc2217.th, NULL);
+
+	close(rfc2217.fd);
+	close(rfc2217.sock);
+	rfc2217.fd = rfc2217.sock = -1;
+}
+
+static const struct xport xport_rfc2217 = {
+	.name = "rfc2217", .prefix = "rfc2217:",
+	.open = xport_rfc2217_open, .set_baud = xport_rfc2217_set_baud,
+	.modem_get = xport_rfc2217_modem_get,
+	.modem_set = xport_rfc2217_modem_set,
+	.drain = xport_rfc2217_drain, .flush = xport_rfc2217_flush,
+	.close = xport_rfc2217_close,
+};
+
+/*
+  Pseudo terminal: with a COMMAND, it is run on the other side as the
+  device, on its stdin & stdout. Without, the name of the other side is
+  printed for a stand-in to be started on by hand.
+*/
+
+static pid_t xport_pty_pid = -1;
+
+static inline int xport_pty_open(const char *cmd)
+{
+	struct termios tio;
+	const char *name;
+	int master, slave;
+
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0
+	    || !(name = ptsname(master))) {
+		int err = errno;
+
+		perror("pty");
+		if (master >= 0)
+			close(master);
+		return -err;
+	}
+
+	/* Held open here, so reads don't fail before the stand-in is up */
+	slave = open(name, O_RDWR | O_NOCTTY);
+	if (slave < 0) {
+		perror(name);
+		close(master);
+		return -errno;
+	}
+
+	/* Bytes as they are, both ways */
+	tcgetattr(slave, &tio);
+	cfmakeraw(&tio);
+	tcsetattr(slave, TCSANOW, &tio);
+
+	if (!*cmd) {
+		printf("Stand-in device goes on %s\n", name);
+		return master;
+	}
+
+	xport_pty_pid = fork();
+	if (xport_pty_pid < 0) {
+		perror("fork");
+		close(slave);
+		close(master);
+		return -errno;
+	}
+
+	if (xport_pty_pid == 0) {
+		setsid();
+		dup2(slave, STDIN_FILENO);
+		dup2(slave, STDOUT_FILENO);
+		close(slave);
+		close(master);
+		execl("/bin/sh", "sh", "-c", cmd, (char *) NULL);
+		_exit(127);
+	}
+
+	close(slave);
+	return master;
+}
+
+static inline int xport_pty_set_baud(int fd, int baud)
+{
+	(void) fd;
+	return baud;
+}
+
+/*
+  A pty has no modem lines. CTS reads asserted, so --flow-control can
+  be tried on a stand-in; whether flow control holds up is up to the
+  burst ws63flash sends before relying on it.
+*/
+static inline int xport_pty_modem_get(int fd, int *st)
+{
+	(void) fd;
+	*st = TIOCM_CTS | TIOCM_DSR;
+	return 0;
+}
+
+static inline void xport_pty_close(int fd)
+{
+	close(fd);
+	if (xport_pty_pid > 0)
+		waitpid(xport_pty_pid, NULL, 0);
+}
+
+static const struct xport xport_pty = {
+	.name = "pty", .prefix = "pty:",
+	.open = xport_pty_open, .set_baud = xport_pty_set_baud,
+	.modem_get = xport_pty_modem_get, .modem_set = xport_no_modem_set,
+	.drain = xport_fd_drain, .flush = xport_fd_flush,
+	.close = xport_pty_close,
+};
+
+#endif	/* _TRANSPORT_H_ */
@@ -55,6 +55,16 @@ enum WS63_CMDTYPE {
 	CMD_END,
 };
 
+/*
+  HANDSHAKE & SETBAUDR start with the baudrate (LE32). What the MAGC
+  bytes after it mean isn't documented; 0x08, 0x01 look like 8 data
+  bits & 1 stop bit. Taking the last one for RTS/CTS flow control is an
+  assumption of ours, which is why --flow-control=rtscts checks that
+  the loader holds the host off before relying on it.
+*/
+#define WS63_LINE_BAUD	0
+#define WS63_LINE_FLOW	7	/* assumed, see above */
+
 const static struct cmddef WS63E_FLASHINFO[CMD_END] = {
 	[CMD_HANDSHAKE] = {
 		.cmd = 0xf0,
@@ -21,9 +21,14 @@
 #include "baud.h"
 #include "ws63defs.h"
 #include "ws63sign.h"
+#include "deadline.h"
 #include "ymodem.h"
 #include "fwpkg.h"
 #include "io.h"
+#include "sparse.h"
+#include "plan.h"
+#include "cost.h"
+#include "profile.h"
 
 #include <endian.h>
 #include <math.h>
@@ -33,6 +38,7 @@
 #include <sys/ioctl.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <string.h>
 #include <time.h>
 #include <stdio.h>
@@ -41,7 +47,7 @@
 #include "libgen.h"
 #include "argp.h"
 
-#include "blob/ws63_loaderboot_signed.h"
+#include "blob/ws63_loaderboot_frames.h"
 
 /* Argument Processing */
 
@@ -52,7 +58,10 @@ const char	*argp_program_version	  =
   "warranty; not even for MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n";
 const char	*argp_program_bug_address = PACKAGE_BUGREPORT;
 
-static char	doc[]	   = PACKAGE " -- flashing utility for Hisilicon WS63";
+static char	doc[]	   = PACKAGE " -- flashing utility for Hisilicon WS63"
+	"\vTTY is a serial port, or tcp:HOST:PORT for a raw serial server, "
+	"rfc2217:HOST:PORT for one the baudrate is set through, or "
+	"pty:[COMMAND] for a stand-in device on a pseudo terminal.";
 static char	args_doc[] =
 	"--flash TTY FWPKG [BIN...]\n"
 	"--write TTY LOADERBOOT [BIN@ADDR...]\n"
@@ -70,9 +79,46 @@ static struct argp_option options[] = {
 	 "write a machine code binary", 0},
 
 	{"baud", 'b', "BAUDRATE", 0,
-	 "set the flashing serial baudrate", 1},
+	 "set the flashing serial baudrate, or `auto' to pick the fastest "
+	 "one that works after loaderBoot", 1},
 	{"late-baud", 1, 0, 0,
 	 "set the baudrate after loaderBoot (Available on Hi3863)", 1},
+	{"window", 3, "BLOCKS", 0,
+	 "keep up to BLOCKS ymodem blocks in flight (default 1)", 1},
+	{"sparse", 4, 0, 0,
+	 "skip sending erased (0xFF) blocks of the bins", 1},
+	{"retries", 5, "COUNT", 0,
+	 "resume a failed transfer at most COUNT times (default 3)", 1},
+	{"merge-gap", 6, "BYTES", 0,
+	 "merge bins up to BYTES apart beyond their erase range into one "
+	 "download (default 0, -1 to disable)", 1},
+	{"guard-ms", 7, "MS", 0,
+	 "wait at least MS milliseconds after each transfer before "
+	 "the next command (default 0)", 1},
+	{"low-latency", 9, 0, 0,
+	 "have the serial driver pass on received bytes right away, "
+	 "restored at exit or on a signal (Linux)", 1},
+	{"flow-control", 10, "MODE", 0,
+	 "`rtscts' to use hardware flow control if the loader drives CTS, "
+	 "or `none' (default)", 1},
+	{"reset", 11, "SEQ", 0,
+	 "reset the device through DTR/RTS instead of by hand: `rts', "
+	 "`dtr', `rts-inv', `dtr-inv', or steps like `!dtr,rts,pulse,!rts'",
+	 1},
+	{"reset-pulse", 12, "MS", 0,
+	 "hold the reset for MS milliseconds, the `pulse' step "
+	 "(default 100)", 1},
+	{"reset-delay", 13, "MS", 0,
+	 "start the handshake MS milliseconds after the reset (default 0)",
+	 1},
+	{"reset-retries", 14, "COUNT", 0,
+	 "reset again at most COUNT times while the device doesn't answer "
+	 "(default 3)", 1},
+	{"handshake-ms", 15, "MS", 0,
+	 "send a handshake frame every MS milliseconds (default 10)", 1},
+	{"dry-run", 8, 0, 0,
+	 "print what would be burnt and an estimate of how long it takes, "
+	 "without opening TTY", 1},
 	{"verbose", 'v', 0, 0,
 	 "verbosely output the interactions", 1},
 	{0},
@@ -85,8 +131,82 @@ static struct args {
 	int	 verbose;
 	int	 baud;
 	int	 late_baud;
+	int	 baud_auto;
+	int	 window;
+	int	 sparse;
+	int	 retries;
+	long	 merge_gap;
+	int	 guard_ms;
+	int	 dry_run;
+	int	 low_latency;
+	int	 rtscts;
+	char	*reset;
+	int	 reset_pulse;
+	int	 reset_delay;
+	int	 reset_retries;
+	int	 handshake_ms;
 } arguments;
 
+/*
+  DTR/RTS reset, steps separated by commas: `dtr' & `rts' assert the
+  line, `!dtr' & `!rts' drop it, `pulse' waits --reset-pulse and a
+  number waits that many milliseconds. An asserted line is driven low,
+  which the usual auto-reset circuit passes on to RST; `-inv' is for
+  boards with an inverter in between.
+*/
+static const struct {
+	const char	*name;
+	const char	*seq;
+} reset_presets[] = {
+	{ "rts",	"!dtr,rts,pulse,!rts" },
+	{ "dtr",	"!rts,dtr,pulse,!dtr" },
+	{ "rts-inv",	"!dtr,!rts,pulse,rts" },
+	{ "dtr-inv",	"!rts,!dtr,pulse,dtr" },
+};
+
+#define RESET_PRESETS_N ((int) (sizeof(reset_presets) / sizeof(reset_presets[0])))
+
+/* Run the reset steps SEQ on FD, or only check them if FD is -1 */
+static int ws63_reset_seq(int fd, const char *seq)
+{
+	const char *p = seq;
+
+	while (*p) {
+		size_t n = strcspn(p, ",");
+		int bits = 0, on = *p != '!', ret;
+		const char *line = p + !on;
+		size_t ln = n - !on;
+
+		if (ln == 3 && !strncmp(line, "dtr", 3))
+			bits = TIOCM_DTR;
+		else if (ln == 3 && !strncmp(line, "rts", 3))
+			bits = TIOCM_RTS;
+		else if (on && n == 5 && !strncmp(p, "pulse", 5)) {
+			if (fd >= 0)
+				poll(NULL, 0, arguments.reset_pulse);
+		} else if (on && n > 0 && n < 6
+			   && strspn(p, "0123456789") >= n) {
+			if (fd >= 0)
+				poll(NULL, 0, atoi(p));
+		} else
+			return -1;
+
+		if (bits && fd >= 0) {
+			ret = uart_modem_set(fd, bits, on);
+			if (ret < 0) {
+				fprintf(stderr, "Can't drive DTR/RTS on %s: "
+					"%s\n", uart_xport->name,
+					strerror(-ret));
+				return -1;
+			}
+		}
+
+		p += n + (p[n] == ',');
+	}
+
+	return 0;
+}
+
 static error_t parse_opt(int key, char *arg, struct argp_state *state)
 {
 	struct args *args = state->input;
@@ -95,23 +215,112 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
 	case 1:
 		args->late_baud = 1;
 		break;
-	case 'b':
+	case 3:
+		if (!arg)
+			argp_usage(state);
+
+		args->window = atoi(arg);
+		if (args->window < 1 || args->window > YMODEM_WINDOW_MAX) {
+			fprintf(stderr, "Window must be within 1-%d\n",
+				YMODEM_WINDOW_MAX);
+			exit(EXIT_FAILURE);
+		}
+		break;
+	case 4:
+		args->sparse = 1;
+		break;
+	case 5:
+		if (!arg)
+			argp_usage(state);
+		args->retries = atoi(arg);
+		if (args->retries < 0)
+			argp_error(state, "invalid retry count: %s", arg);
+		break;
+	case 6:
+		if (!arg)
+			argp_usage(state);
+		args->merge_gap = strtol(arg, NULL, 0);
+		break;
+	case 7:
+		if (!arg)
+			argp_usage(state);
+		args->guard_ms = atoi(arg);
+		if (args->guard_ms < 0)
+			argp_error(state, "invalid guard time: %s", arg);
+		break;
+	case 8:
+		args->dry_run = 1;
+		break;
+	case 9:
+		args->low_latency = 1;
+		break;
+	case 10:
+		if (!arg)
+			argp_usage(state);
+		if (!strcmp(arg, "rtscts"))
+			args->rtscts = 1;
+		else if (!strcmp(arg, "none"))
+			args->rtscts = 0;
+		else
+			argp_error(state, "invalid flow control: %s", arg);
+		break;
+	case 11:
+		if (!arg)
+			argp_usage(state);
+		args->reset = arg;
+		if (!strcmp(arg, "none")) {
+			args->reset = NULL;
+			break;
+		}
+		for (int i = 0; i < RESET_PRESETS_N; i++)
+			if (!strcmp(arg, reset_presets[i].name))
+				args->reset = (char *) reset_presets[i].seq;
+		if (ws63_reset_seq(-1, args->reset) < 0)
+			argp_error(state, "invalid reset sequence: %s", arg);
+		break;
+	case 12:
+	case 13:
+	case 15:
 		if (!arg)
 			argp_usage(state);
 
-		int baud = atoi(arg), speed_found = 0;
+		int ms = atoi(arg);
 
-		for (int i = 0; i < AVAIL_BAUD_N; i++) {
-			struct baud_ipair baud_pair = avail_baud_tbl[i];
-			if (baud_pair.baud != baud) continue;
-			speed_found = 1;
+		if (ms < 0 || (key == 15 && ms < 1))
+			argp_error(state, "invalid time: %s", arg);
+		if (key == 12)
+			args->reset_pulse = ms;
+		else if (key == 13)
+			args->reset_delay = ms;
+		else
+			args->handshake_ms = ms;
+		break;
+	case 14:
+		if (!arg)
+			argp_usage(state);
+		args->reset_retries = atoi(arg);
+		if (args->reset_retries < 0)
+			argp_error(state, "invalid retry count: %s", arg);
+		break;
+	case 'b':
+		if (!arg)
+			argp_usage(state);
+
+		if (!strcmp(arg, "auto")) {
+			args->baud_auto = 1;
 			break;
 		}
 
-#if !defined(__APPLE__) || !defined(HAVE_DECL_IOSSIOSPEED)
-		if (!speed_found) {
+		char *end;
+		long baud = strtol(arg, &end, 10);
+
+		if (*end || baud <= 0 || baud > INT_MAX)
+			argp_error(state, "invalid baudrate: %s", arg);
+
+#if !BAUD_ANY
+		if (!baud_avail(baud)) {
 			fprintf(stderr,
-				"Target baud %d not found,"
+				"Target baud %ld not found,"
 				" maybe not supported by OS?\n"
 				"Available Baud: ", baud);
 			for (int i = 0; i < AVAIL_BAUD_N; i++)
@@ -122,6 +331,7 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
 #endif
 
 		args->baud = baud;
+		args->baud_auto = 0;
 		break;
 	case 'v':
 		args->verbose++;
@@ -162,7 +372,95 @@ static struct argp argp = { options, parse_opt, args_doc, doc,
 
 /* Main Entrance */
 
-#define RESET_TIMEOUT 10.0
+/* Timeouts & intervals in milliseconds */
+#define RESET_TIMEOUT		10000
+#define RESET_ACK_TIMEOUT	1000	/* after a DTR/RTS reset */
+#define HANDSHAKE_INTERVAL	10
+#define RESET_POLL_INTERVAL	100
+#define READY_TIMEOUT		100
+
+/*
+  Baudrate the TTY is at, for the wire time of what is measured, and
+  the one the loader was told, which may be a little off the former
+*/
+static int line_baud = 115200, loader_baud = 115200;
+
+/*
+  Cost model for --dry-run, refined by what a run measures: only clean
+  transfers feed the frame turnaround, NAKs & timeouts would skew it.
+*/
+static struct cost_model cost;
+static int cost_calibrated, cost_learnt;
+
+static void ws63_learn(double *field, int64_t ms)
+{
+	cost_learn(field, ms);
+	cost_learnt = 1;
+}
+
+/*
+  What worked through this very adapter, which every run starts from,
+  and the link quality of the run to go with it
+*/
+static struct link_profile prof;
+static int prof_known, tally_frames, tally_bad;
+
+/* Slowest ACK of the run, and whether any didn't come in time */
+static int tally_ack_ms, tally_timeouts;
+
+/*
+  Block RTTs measured in this run. With RTT_AS_FOUND, the driver isn't
+  tuned for --low-latency yet, a clean transfer goes to RTT_FOUND.
+*/
+static double rtt_sum, rtt_found = -1;
+static int rtt_n, rtt_as_found;
+
+static void ws63_tally_xfer(void)
+{
+	tally_frames += ymodem_stat.frames;
+	tally_bad += ymodem_stat.naks + ymodem_stat.timeouts;
+	tally_timeouts += ymodem_stat.timeouts;
+	if (ymodem_stat.ack_max_ms > tally_ack_ms)
+		tally_ack_ms = ymodem_stat.ack_max_ms;
+}
+
+static void ws63_learn_xfer(void)
+{
+	struct ymodem_stat *st = &ymodem_stat;
+	double over, rtt;
+
+	ws63_tally_xfer();
+	if (st->naks || st->timeouts || st->frames < 8)
+		return;
+
+	over = st->ms - cost_wire_ms(st->wire, line_baud);
+	if (over < 0)
+		return;
+
+	rtt = over / st->frames * ymodem_cfg.window;
+	if (rtt_as_found) {
+		rtt_found = rtt;
+		return;
+	}
+
+	ws63_learn(&cost.rtt_ms, rtt);
+	rtt_sum += rtt;
+	rtt_n++;
+
+	if (prof.rtt_ms > 0)
+		cost_learn(&prof.rtt_ms, rtt);
+	else
+		prof.rtt_ms = rtt;
+}
+
+/* MS it took a DOWNLOADI erasing ERAS bytes until the loader was ready */
+static void ws63_learn_erase(int64_t ms, size_t eras)
+{
+	size_t blocks = eras / FLASH_ERASE_SIZE;
+
+	if (blocks && ms >= cost.cmd_ms)
+		ws63_learn(&cost.erase_ms, (ms - cost.cmd_ms) / blocks);
+}
 
 static int bin_in_args(const char *s, struct args *args) {
 	char **bin_names = args->args+2;
@@ -183,184 +481,924 @@ static int bin_in_args(const char *s, struct args *args) {
 	return found;
 };
 
+/* Whether the loader says it is resetting, in a line or what there is */
+static inline int ws63_reset_said(const struct frame_dec *dec)
+{
+	return strstr(dec->line, "Reset") || strstr(dec->line, "reset");
+}
+
 static inline int ws63_poll_reset(int fd, int verbose)
 {
-	char	buf[32] = { 0 };
+	struct frame_dec dec;
+	int64_t	deadline = deadline_in(RESET_TIMEOUT);
 	int	ret	= 0;
-	time_t	t0	= time(NULL), t1 = t0;
 
-	while (t1 - t0 < RESET_TIMEOUT) {
-		t1 = time(NULL);
+	frame_dec_init(&dec);
 
-		ret = ws63_send_cmddef(fd, WS63E_FLASHINFO[CMD_RST],
-				       arguments.verbose);
-		if (ret < 0) return ret;
+	for (int tries = 0; !deadline_passed(deadline); tries++) {
+		int64_t t0 = mono_ms();
 
-		ret = read(fd, buf, 32);
-		if (ret < 0) return -errno;
+		ret = ws63_frame_send(fd, ws63_frame_of(CMD_RST),
+				      arguments.verbose);
+		if (ret < 0) return ret;
 
-		if (verbose)
-			for (int i = 0; i < ret; i++) {
-				if (isascii(buf[i]) && isprint(buf[i]))
-					printf("%c", buf[i]);
-				else
-					printf("%02X ", (unsigned char) buf[i]);
+		int64_t again = deadline_in(RESET_POLL_INTERVAL);
+
+		while ((ret = frame_next(fd, &dec, again)) > 0) {
+			if (ret != FRAME_LINE)
+				continue;
+			if (verbose && *dec.line)
+				printf("%s\n", dec.line);
+			if (ws63_reset_said(&dec)) {
+				/* A command & its reply, every run has one */
+				if (!tries)
+					ws63_learn(&cost.cmd_ms,
+						   mono_ms() - t0);
+				return 0;
 			}
+		}
+		if (ret < 0) return -errno;
 
-		if (ret > 0 && (memmem(buf, 32, "Reset", 5)
-				|| memmem(buf, 32, "reset", 5)))
+		/* Not every loader ends the line */
+		if (ws63_reset_said(&dec)) {
+			if (verbose)
+				printf("%s\n", dec.line);
 			return 0;
+		}
 	}
 
 	return -ETIMEDOUT;
 }
 
-int verb_flash(int fd) {
-	time_t t0;
+/* Send CMD_DOWNLOADI, erasing ERAS bytes at ADDR for an image of ILEN */
+static int64_t downloadi_ms;	/* how long the latest one took */
+
+/* The DOWNLOADI frame, patched in place */
+static const struct ws63_frame *
+ws63_downloadi_frame(uint32_t addr, uint32_t ilen, uint32_t eras)
+{
+	struct ws63_frame *f = ws63_frame_of(CMD_DOWNLOADI);
+
+	ws63_frame_put32(f, 0, addr);
+	ws63_frame_put32(f, 4, ilen);
+	ws63_frame_put32(f, 8, eras);
+	ws63_frame_seal(f);
+	return f;
+}
+
+static int ws63_downloadi(int fd, uint32_t addr, size_t ilen, size_t eras)
+{
+	int64_t t0 = mono_ms();
+
+	if (ws63_frame_send(fd, ws63_downloadi_frame(addr, ilen, eras),
+			    arguments.verbose) < 0)
+		return -1;
+
+	uart_read_until_magic(fd, arguments.verbose);
+
+	/* With an image, the erase may as well hold up its ymodem C */
+	downloadi_ms = mono_ms() - t0;
+	if (!ilen)
+		ws63_learn_erase(downloadi_ms, eras);
+	return 0;
+}
+
+/*
+  MCU won't respond if cmd followed immediately by ymodem. Instead of
+  sleeping blindly, drain what the loader prints after a transfer until
+  its ACK frame shows up, which tells it is back to taking commands,
+  but never return before the --guard-ms minimum. If no frame comes up
+  within READY_TIMEOUT, carry on as the former fixed delay did.
+*/
+static int ws63_wait_ready(int fd, int verbose)
+{
+	int64_t guard = deadline_in(arguments.guard_ms);
+	int64_t deadline = deadline_in(READY_TIMEOUT);
+	struct frame_dec dec;
+	int ev;
+
+	if (guard > deadline)
+		deadline = guard;
+
+	frame_dec_init(&dec);
+	while ((ev = frame_next(fd, &dec, deadline)) > 0) {
+		if (verbose > 1 && ev == FRAME_LINE && *dec.line)
+			printf("%s\n", dec.line);
+		if (ev == FRAME_CMD && frame_is_ack(&dec))
+			break;
+	}
+
+	if (ev < 0) {
+		perror("read");
+		return -1;
+	}
+
+	/* Hold off for the rest of the guard time */
+	while (!deadline_passed(guard))
+		poll(NULL, 0, deadline_left(guard));
+
+	return 0;
+}
+
+/*
+  --baud auto: rungs tried upwards after the loaderboot, until one fails
+  the echo check. Rungs the host can't set are skipped.
+*/
+static const int baud_ladder[] = {
+	115200, 230400, 460800, 921600, 1000000, 1500000, 2000000, 3000000,
+};
+
+#define BAUD_LADDER_N	((int) (sizeof(baud_ladder) / sizeof(*baud_ladder)))
+#define BAUD_ECHO_N	3	/* clean round trips for a rung to pass */
+#define BAUD_ECHO_TIMEOUT 100
+#define BAUD_FALLBACK_TRIES 3
+#define BAUD_CONFIRM_TIMEOUT 500
+#define FLOW_BURST_N	16	/* echoes, 288 B, past any UART FIFO */
+#define FLOW_BURST_TIMEOUT 2000
+
+static int baud_rung;		/* index of the rung in use */
+
+/* Whether the loader is asked for RTS/CTS flow control, once detected */
+static int flow_on;
+
+/*
+  HANDSHAKE & SETBAUDR frames carry a rate & the flow control, as far
+  as WS63_LINE_FLOW goes. The few of them a run sends, over and over
+  for the handshake, are framed once and kept.
+*/
+#define LINE_FRAMES_N	16
+
+static struct ws63_line_frame {
+	enum WS63_CMDTYPE	 type;
+	int			 baud;
+	int			 flow;
+	struct ws63_frame	 f;
+} line_frames[LINE_FRAMES_N];
+
+static int line_frames_n, line_frames_next;
+
+/* TYPE to BAUD, with the flow control the loader is to use */
+static const struct ws63_frame *ws63_line_frame(enum WS63_CMDTYPE type,
+						int baud)
+{
+	struct ws63_line_frame *lf;
+
+	for (int i = 0; i < line_frames_n; i++) {
+		lf = &line_frames[i];
+		if (lf->type == type && lf->baud == baud
+		    && lf->flow == flow_on)
+			return &lf->f;
+	}
+
+	/* Once all are taken, the oldest goes */
+	lf = &line_frames[line_frames_next++ % LINE_FRAMES_N];
+	if (line_frames_n < LINE_FRAMES_N)
+		line_frames_n++;
+
+	lf->type = type;
+	lf->baud = baud;
+	lf->flow = flow_on;
+	ws63_frame_build(&lf->f, &WS63E_FLASHINFO[type]);
+	ws63_frame_put32(&lf->f, WS63_LINE_BAUD, baud);
+	lf->f.buf[FRAME_HDR + WS63_LINE_FLOW] = flow_on;
+	ws63_frame_seal(&lf->f);
+
+	return &lf->f;
+}
+
+/*
+  One round trip at the current rate: SETBAUDR to the rate the loader is
+  already at has to come back as an intact ACK frame. The loader
+  acknowledges again after switching; that second ACK is waited for, at
+  most BAUD_ECHO_TIMEOUT, rather than draining until the line idles.
+  Returns how long the first ACK took in ms, or -1.
+*/
+static int ws63_baud_echo(int fd, int baud)
+{
+	const struct ws63_frame *baudcmd = ws63_line_frame(CMD_SETBAUDR, baud);
+	int64_t t0 = mono_ms(), deadline = t0 + BAUD_ECHO_TIMEOUT, rtt;
+	struct frame_dec dec;
+	int ev;
+
+	if (ws63_frame_send(fd, baudcmd, arguments.verbose > 2 ? 2 : 0) < 0)
+		return -1;
+
+	frame_dec_init(&dec);
+	while ((ev = frame_next(fd, &dec, deadline)) > 0) {
+		if (ev != FRAME_CMD || frame_cmd(&dec) != FRAME_ACK_CMD)
+			continue;
+		if (!frame_is_ack(&dec))
+			return -1;
+
+		rtt = mono_ms() - t0;
+
+		deadline = deadline_in(BAUD_ECHO_TIMEOUT);
+		while ((ev = frame_next(fd, &dec, deadline)) > 0)
+			if (ev == FRAME_CMD && frame_cmd(&dec) == FRAME_ACK_CMD)
+				break;
+		return rtt;
+	}
+
+	return -1;
+}
+
+/*
+  Move the host side of the line to BAUD. What was written goes out at
+  the old rate first, and what came in while the two ends were apart is
+  dropped. With CONFIRM, a round trip has to make it at the new rate
+  within BAUD_CONFIRM_TIMEOUT, the loader may take a moment to switch.
+*/
+static int ws63_line_switch(int fd, int baud, int confirm)
+{
+	int64_t deadline;
 	int ret;
 
-	/* Stage 0: Reading FWPKG file & Locate reuqired bin */
-	FILE *fw = fopen(arguments.args[1], "r");
-	if (!fw) {
-		perror("fopen");
-		return EXIT_FAILURE;
+	ret = uart_drain(fd);
+	if (ret < 0 && arguments.verbose)
+		fprintf(stderr, "Output not drained before switching: %s\n",
+			strerror(-ret));
+
+	if (uart_open(&fd, NULL, baud) < 0)
+		return -1;
+	line_baud = uart_baud;
+	uart_flush(fd);
+
+	if (!confirm)
+		return 0;
+
+	/* One echo at a time, a garbled one is let settle first */
+	deadline = deadline_in(BAUD_CONFIRM_TIMEOUT);
+	do {
+		if (ws63_baud_echo(fd, baud) >= 0)
+			return 0;
+		ymodem_drain(fd);
+	} while (!deadline_passed(deadline));
+
+	return -1;
+}
+
+/* Have the loader & the host switch to BAUD, confirmed at the new rate */
+static int ws63_baud_switch(int fd, int baud)
+{
+	int64_t t0 = mono_ms();
+
+	if (ws63_frame_send(fd, ws63_line_frame(CMD_SETBAUDR, baud),
+			    arguments.verbose) < 0)
+		return -1;
+
+	/* Acknowledged at the old rate, then the loader switches */
+	if (uart_read_until_magic(fd, arguments.verbose) == 0)
+		ws63_learn(&cost.cmd_ms, mono_ms() - t0);
+	loader_baud = baud;
+
+	return ws63_line_switch(fd, baud, 1);
+}
+
+/* Switch to BAUD, then check it holds up for a few more round trips */
+static int ws63_baud_try(int fd, int baud)
+{
+	if (ws63_baud_switch(fd, baud) < 0)
+		return -1;
+
+	for (int i = 1; i < BAUD_ECHO_N; i++)
+		if (ws63_baud_echo(fd, baud) < 0)
+			return -1;
+	return 0;
+}
+
+/*
+  Get back to BAUD from a rate that doesn't hold up. The loader may or
+  may not have made it to the bad rate, so try the good one first, then
+  tell it to switch back from the bad one.
+*/
+static int ws63_baud_fallback(int fd, int bad, int baud)
+{
+	const struct ws63_frame *baudcmd = ws63_line_frame(CMD_SETBAUDR, baud);
+
+	for (int i = 0; i < BAUD_FALLBACK_TRIES; i++) {
+		if (ws63_line_switch(fd, baud, 0) < 0)
+			return -1;
+		loader_baud = baud;
+
+		if (ws63_baud_echo(fd, baud) >= 0)
+			return 0;
+
+		if (ws63_line_switch(fd, bad, 0) < 0)
+			return -1;
+		if (ws63_frame_send(fd, baudcmd, arguments.verbose) < 0)
+			return -1;
+		poll(NULL, 0, BAUD_ECHO_TIMEOUT);
 	}
 
-	struct fwpkg_header *header = fwpkg_read_header(fw);
-	if (!header) return EXIT_FAILURE;
+	return -1;
+}
 
-	struct fwpkg_bin_info *bins = fwpkg_read_bin_infos(fw, header);
-	if (!bins) return EXIT_FAILURE;
+/* The highest rung up to BAUD, one lower if the link was flaky there */
+static int ws63_baud_profile_rung(void)
+{
+	int rung = 0;
 
-	struct fwpkg_bin_info *loaderboot = NULL;
-	for (int i = 0; i < header->cnt; i++)
-		if (bins[i].type_2 == 0)
-			loaderboot = &bins[i];
-	if (!loaderboot) {
-		fprintf(stderr, "Required loaderboot not found in fwpkg!\n");
-		return EXIT_FAILURE;
+	for (int i = 1; i < BAUD_LADDER_N; i++)
+		if (baud_ladder[i] <= prof.baud && baud_avail(baud_ladder[i]))
+			rung = i;
+
+	if (prof.err_rate > PROFILE_ERR_MAX)
+		while (rung > 0 && !baud_avail(baud_ladder[--rung]))
+			;
+	return rung;
+}
+
+/*
+  Climb the ladder from 115200, settle on the last rung that passed.
+  An adapter seen before goes straight to its rung from the profile.
+*/
+static int ws63_baud_auto(int fd)
+{
+	if (prof_known && prof.late_baud == 0) {
+		printf("Not switching baud, the loader refused before\n");
+		return 0;
 	}
 
-	printf("+-+-------------------------------+----------+----------+-+\n");
-	printf("|F|BIN NAME                       |LENGTH    |BURN ADDR |T|\n");
-	printf("+-+-------------------------------+----------+----------+-+\n");
-	for (int i = 0; i < header->cnt; i++) {
-		char flash_flag = ' ';
+	if (prof_known && ws63_baud_profile_rung() > 0) {
+		int rung = ws63_baud_profile_rung();
 
-		if (!bins[i].type_2)
-			flash_flag = '!';
-		else if (bin_in_args(bins[i].name, &arguments))
-			flash_flag = '*';
+		printf("Switching baud... %d (profile)", baud_ladder[rung]);
+		fflush(stdout);
+
+		if (ws63_baud_try(fd, baud_ladder[rung]) == 0) {
+			baud_rung = rung;
+			prof.late_baud = 1;
+			printf("\n");
+			return 0;
+		}
 
-		printf("|%c|%-31s|0x%08x|0x%08x|%d|\n",
-		       flash_flag,
-		       bins[i].name, bins[i].length,
-		       bins[i].burn_addr, bins[i].type_2);
+		printf(" failed\n");
+		if (ws63_baud_fallback(fd, baud_ladder[rung], 115200) < 0) {
+			printf("Lost the loader falling back to 115200\n");
+			return -1;
+		}
 	}
-	printf("+-+-------------------------------+----------+----------+-+\n");
 
-	for (int i = 2; ; i++) {
-		int found = 0;
+	printf("Probing baud...");
+	fflush(stdout);
 
-		char *arg = arguments.args[i];
-		if (!arg) break;
+	for (int i = baud_rung + 1; i < BAUD_LADDER_N; i++) {
+		if (!baud_avail(baud_ladder[i]))
+			continue;
 
-		for (int j = 0; j < header->cnt; j++) {
-			struct fwpkg_bin_info *bin = bins + j;
-			if (!strcmp(arg, bin->name)) {
-				found = 1;
-				break;
-			}
+		printf(" %d", baud_ladder[i]);
+		fflush(stdout);
+
+		if (ws63_baud_try(fd, baud_ladder[i]) == 0) {
+			baud_rung = i;
+			prof.late_baud = 1;
+			continue;
 		}
 
-		if (!found) {
-			fprintf(stderr,
-				"Required bin `%s' not found in fwpkg!\n", arg);
-			return EXIT_FAILURE;
+		/* Not a single rung, the loader may not take SETBAUDR */
+		if (baud_rung == 0)
+			prof.late_baud = 0;
+
+		printf(" failed");
+		if (ws63_baud_fallback(fd, baud_ladder[i],
+				       baud_ladder[baud_rung]) < 0) {
+			printf("\nLost the loader falling back to %d\n",
+			       baud_ladder[baud_rung]);
+			return -1;
 		}
+		break;
 	}
 
-	/* Stage 1: Flash loaderboot */
+	printf(", using %d\n", uart_baud);
+	return 0;
+}
+
+/* Step down one rung after a transfer broke down, --baud auto only */
+static int ws63_baud_down(int fd)
+{
+	int bad = baud_ladder[baud_rung];
+
+	while (baud_rung > 0 && !baud_avail(baud_ladder[--baud_rung]))
+		;
+	if (baud_ladder[baud_rung] == bad)
+		return -1;
+
+	printf("Dropping baud to %d\n", baud_ladder[baud_rung]);
+	return ws63_baud_fallback(fd, bad, baud_ladder[baud_rung]);
+}
+
+/*
+  --low-latency: the loaderboot goes out with the driver as found, what
+  comes after it tuned, so the block round trips of both show what the
+  option buys on this adapter. Where it does, the profile has later
+  runs tune it without being asked.
+*/
+static void ws63_latency_as_found(int on)
+{
+	uart_low_latency_set(!on);
+	rtt_as_found = on;
+}
+
+static void ws63_latency_report(void)
+{
+	double tuned = rtt_n ? rtt_sum / rtt_n : -1;
+
+	if (rtt_found < 0 || tuned < 0) {
+		printf("Block RTT: not measurable, no clean transfer "
+		       "%s\n", rtt_found < 0 ? "as found" : "tuned");
+		return;
+	}
+
+	printf("Block RTT: %.2f ms as found, %.2f ms low latency\n",
+	       rtt_found, tuned);
+	prof.low_latency = tuned < rtt_found;
+}
+
+/*
+  Send N echoes back to back, then count the intact ACKs that come back
+  until the line is quiet. -1 if anything came back damaged or NAK'd.
+  *HELD counts the times CTS was seen deasserted meanwhile.
+*/
+static int ws63_echo_acks(int fd, int n, int *held)
+{
+	const struct ws63_frame *echo = ws63_line_frame(CMD_SETBAUDR,
+							loader_baud);
+	int64_t deadline = deadline_in(FLOW_BURST_TIMEOUT), quiet;
+	struct frame_dec dec;
+	int acks = 0, bad = 0, st, ev;
+
+	for (int i = 0; i < n; i++) {
+		if (ws63_frame_send(fd, echo, arguments.verbose > 2 ? 2 : 0) < 0)
+			return -1;
+		if (uart_modem_get(fd, &st) == 0 && !(st & TIOCM_CTS))
+			(*held)++;
+	}
+
+	frame_dec_init(&dec);
+	while (1) {
+		quiet = deadline_in(BAUD_ECHO_TIMEOUT);
+		ev = frame_next(fd, &dec, quiet < deadline ? quiet : deadline);
+		if (ev <= 0)
+			break;
+
+		if (uart_modem_get(fd, &st) == 0 && !(st & TIOCM_CTS))
+			(*held)++;
+
+		if (ev == FRAME_NAK)
+			bad++;
+		else if (ev == FRAME_CMD && frame_is_ack(&dec))
+			acks++;
+		else if (ev == FRAME_CMD)
+			bad++;
+	}
+
+	return (ev < 0 || bad) ? -1 : acks;
+}
+
+/*
+  --flow-control=rtscts: the loader is only asked for it once it runs
+  and drives CTS. Whether it then honors it is put to the test: a burst
+  of FLOW_BURST_N echoes, more than a UART FIFO holds, has to be
+  answered in full and intact, as a single echo is, which a loader
+  that neither keeps up nor holds the host off through CTS doesn't.
+  Otherwise both ends go on without, and the profile keeps later runs
+  from trying again.
+*/
+static int ws63_flow_detect(int fd)
+{
+	int st = 0, held = 0, one, burst = -1;
+
+	if (prof_known && prof.flow == 0) {
+		printf("Flow control: none, the loader didn't honor it "
+		       "before\n");
+		return 0;
+	}
+
+	if (uart_modem_get(fd, &st) < 0 || !(st & TIOCM_CTS)) {
+		printf("Flow control: none, the loader doesn't drive CTS\n");
+		prof.flow = 0;
+		return 0;
+	}
+
+	flow_on = 1;
+	uart_opts.rtscts = 1;
+	if (uart_open(&fd, NULL, loader_baud) < 0)
+		return -1;
+
+	one = ws63_echo_acks(fd, 1, &held);
+	if (one > 0)
+		burst = ws63_echo_acks(fd, FLOW_BURST_N, &held);
+	if (arguments.verbose)
+		printf("Flow control: %d of %d replies to a %d B burst, "
+		       "CTS seen deasserted %d times\n", burst,
+		       one * FLOW_BURST_N,
+		       (int) (FLOW_BURST_N * ws63_frame_of(CMD_SETBAUDR)->len),
+		       held);
+
+	if (one > 0 && burst == one * FLOW_BURST_N) {
+		printf("Flow control: RTS/CTS\n");
+		prof.flow = 1;
+		return 0;
+	}
+
+	flow_on = 0;
+	uart_opts.rtscts = 0;
+	uart_flush(fd);
+	if (uart_open(&fd, NULL, loader_baud) < 0)
+		return -1;
+
+	/* It may have been taken up by the loader, call it off */
+	ymodem_drain(fd);
+	ws63_baud_echo(fd, loader_baud);
+
+	printf("Flow control: none, the loader doesn't honor it\n");
+	prof.flow = 0;
+	return 0;
+}
+
+/*
+  Download one segment. When a transfer breaks down, the session is
+  cancelled and DOWNLOADI re-issued for what is left, from the last
+  erase block boundary the device has fully acknowledged, until the
+  retry budget runs out.
+*/
+static int ws63_download_seg(int fd, const struct xfer_src *src, size_t ofs,
+			     const char *name, uint32_t addr, size_t len,
+			     size_t eras)
+{
+	int ret;
+
+	for (int retry = 0; ; retry++) {
+		ret = ws63_downloadi(fd, addr, len, eras);
+		if (ret == 0)
+			ret = ymodem_xfer_src(fd, src, ofs, len, name,
+					      arguments.verbose);
+		if (ret >= 0) {
+			ws63_learn_erase(downloadi_ms + ymodem_stat.wait_ms,
+					 eras);
+			ws63_learn_xfer();
+			break;
+		}
+
+		ws63_tally_xfer();
+		if (retry >= arguments.retries)
+			return ret;
+
+		size_t done = (addr + ymodem_stat.acked)
+			/ FLASH_ERASE_SIZE * FLASH_ERASE_SIZE;
+		done = (done > addr) ? done - addr : 0;
+		if (done == len)	/* only the closing block got lost */
+			done = (done >= FLASH_ERASE_SIZE)
+				? done - FLASH_ERASE_SIZE : 0;
+
+		printf("Resuming %s at 0x%zx (%d/%d)...\n", name, done,
+		       retry + 1, arguments.retries);
+
+		ymodem_abort(fd);
+
+		/* The link may just not take the rate, go slower */
+		if (arguments.baud_auto && baud_rung > 0
+		    && ws63_baud_down(fd) < 0)
+			return -1;
+
+		ofs  += done;
+		addr += done;
+		len  -= done;
+		eras -= done;
+	}
+
+	return ws63_wait_ready(fd, arguments.verbose);
+}
+
+/*
+  Sparse download: blank erase blocks are only erased, by a DOWNLOADI
+  without image, and the rest goes out as separate segments. Every
+  erase is clipped to the range the whole image would have erased.
+*/
+static int ws63_download_sparse(int fd, const struct xfer_src *src,
+				const char *name, uint32_t addr, size_t eras)
+{
+	struct sparse_seg *segs;
+	size_t ofs = 0, skipped = 0, len = src->len;
+	int n, holes = 0, ret = 0;
+
+	n = sparse_plan(src, addr, &segs);
+	if (n < 0) {
+		perror("sparse_plan");
+		return -1;
+	}
+
+	if (n == 1 && segs[0].len == len) {
+		free(segs);
+		return ws63_download_seg(fd, src, 0, name, addr, len, eras);
+	}
+
+	for (int i = 0; i <= n && ret == 0; i++) {
+		size_t end = (i < n) ? segs[i].ofs : len;
+
+		if (end > ofs) {
+			size_t hole = ceil((end - ofs)/8192.0)*0x2000;
+
+			if (hole > eras - ofs)
+				hole = eras - ofs;
+
+			ret = ws63_downloadi(fd, addr + ofs, 0, hole);
+			skipped += end - ofs;
+			holes++;
+		}
+
+		if (i == n || ret < 0)
+			break;
+
+		size_t seg_eras = ceil(segs[i].len/8192.0)*0x2000;
+		if (seg_eras > eras - segs[i].ofs)
+			seg_eras = eras - segs[i].ofs;
+
+		ret = ws63_download_seg(fd, src, segs[i].ofs, name,
+					addr + segs[i].ofs, segs[i].len,
+					seg_eras);
+		ofs = segs[i].ofs + segs[i].len;
+	}
+
+	free(segs);
+
+	if (ret == 0)
+		printf("Sparse %s: skipped 0x%zx B of 0x%zx B in %d blank "
+		       "region(s)\n", name, skipped, len, holes);
+	return ret;
+}
+
+/* Erase & program one image at ADDR through CMD_DOWNLOADI and ymodem */
+static int ws63_download(int fd, const struct xfer_src *src, const char *name,
+			 uint32_t addr)
+{
+	size_t eras_size = ceil(src->len/8192.0)*0x2000;
+
+	if (arguments.sparse)
+		return ws63_download_sparse(fd, src, name, addr, eras_size);
+
+	return ws63_download_seg(fd, src, 0, name, addr, src->len,
+				 eras_size);
+}
+
+/*
+  What the host side of a verb prepares for the device side: the
+  loaderboot, either pre-framed or from a source, and the downloads
+*/
+static struct ws63_job {
+	const uint8_t		*bootpre;
+	struct xfer_src		 boot;
+	const char		*bootname;
+
+	struct plan_item	 plan[MAX_PARTITION_CNT];
+	int			 plan_n;
+
+	struct ws63sign_ctx	 sign;
+	struct iovec		 progiov[3];
+
+	/* Opened by the prep, closed with the job */
+	struct xfer_src		 own[MAX_PARTITION_CNT];
+	int			 own_n;
+	uint8_t			*progbuf;	/* the image, if not mapped */
+} job;
+
+/* Open PATH as S, for the job to close in ws63_job_free() */
+static int ws63_job_open(struct ws63_job *job, const char *path,
+			 struct xfer_src *s)
+{
+	if (job->own_n >= MAX_PARTITION_CNT
+	    || xfer_src_open(&job->own[job->own_n], path) < 0)
+		return -1;
+
+	*s = job->own[job->own_n++];
+	return 0;
+}
+
+static void ws63_job_free(struct ws63_job *job)
+{
+	plan_free(job->plan, job->plan_n);
+	job->plan_n = 0;
+
+	for (int i = 0; i < job->own_n; i++)
+		xfer_src_close(&job->own[i]);
+	job->own_n = 0;
+
+	free(job->progbuf);
+	job->progbuf = NULL;
+}
+
+/*
+  Host side preparation runs on a worker from the start, while the
+  handshake waits for the device reset, so parsing, mapping, signing
+  and the CRC kernel pick-up are done by the time the device answers.
+  What it prints goes to a memory stream, shown by the handshake once
+  the worker is through, not to mix with its own output.
+*/
+struct ws63_prep {
+	int		(*fn)(struct ws63_job *, FILE *);
+	pthread_t	 th;
+	atomic_int	 done;
+	int		 ret;
+
+	FILE		*out;
+	char		*buf;
+	size_t		 len;
+};
+
+static void *ws63_prep_run(void *arg)
+{
+	struct ws63_prep *p = arg;
+
+	p->ret = p->fn(&job, p->out);
+	crc16_xmodem_impl();	/* pick the CRC kernel ahead of time */
+
+	atomic_store(&p->done, 1);
+	return NULL;
+}
+
+static int ws63_prep_start(struct ws63_prep *p,
+			   int (*fn)(struct ws63_job *, FILE *))
+{
+	int ret;
+
+	p->fn = fn;
+	atomic_init(&p->done, 0);
+
+	p->out = open_memstream(&p->buf, &p->len);
+	if (!p->out) {
+		perror("open_memstream");
+		return -1;
+	}
+
+	ret = pthread_create(&p->th, NULL, ws63_prep_run, p);
+	if (ret) {
+		errno = ret;
+		perror("pthread_create");
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Wait for the worker, show its output, returns its result */
+static int ws63_prep_join(struct ws63_prep *p)
+{
+	pthread_join(p->th, NULL);
+
+	fclose(p->out);
+	fwrite(p->buf, 1, p->len, stdout);
+	fflush(stdout);
+	free(p->buf);
+
+	return p->ret;
+}
+
+/* Pulse the reset lines, then give the boot ROM --reset-delay */
+static int ws63_reset_pulse(int fd)
+{
+	if (ws63_reset_seq(fd, arguments.reset) < 0)
+		return -1;
+	if (arguments.reset_delay)
+		poll(NULL, 0, arguments.reset_delay);
+	return 0;
+}
 
-	/* Handshake to enter YModem Mode */
+/*
+  Send handshake frames every --handshake-ms until the boot ROM ACKs
+  one. By hand the reset may take a while; with --reset the device is
+  reset again, up to --reset-retries times, when no ACK comes in time,
+  which the profile narrows down to what the ROM took before.
+*/
+static int ws63_handshake(int fd, struct ws63_prep *prep)
+{
+	int64_t deadline, next = 0, t_reset = 0;
+	int prepped = !prep, resets = 0, ev;
+	int reset_ack_ms = profile_timeout(prof.reset_ms, RESET_ACK_TIMEOUT);
+	const struct ws63_frame *handshake = ws63_line_frame(CMD_HANDSHAKE,
+		arguments.late_baud ? 115200 : arguments.baud);
+	struct frame_dec dec;
+
+	frame_dec_init(&dec);
+	if (arguments.reset) {
+		printf("Resetting device through DTR/RTS...\n");
+		t_reset = mono_ms();
+		if (ws63_reset_pulse(fd) < 0)
+			return -1;
+		deadline = deadline_in(reset_ack_ms);
+	} else
+		deadline = deadline_in(RESET_TIMEOUT);
+
+	if (prepped && !arguments.reset)
+		printf("Waiting for device reset...\n");
 
-	printf("Waiting for device reset...\n");
-	t0 = time(NULL);
 	while (1) {
-		struct cmddef handshake = WS63E_FLASHINFO[CMD_HANDSHAKE];
-		uint8_t buf[32];
-		int len;
+		/* Give up early on bad input, no point in a device */
+		if (!prepped && atomic_load(&prep->done)) {
+			prepped = 1;
+			if (ws63_prep_join(prep) < 0)
+				return -1;
+			if (!arguments.reset)
+				printf("Waiting for device reset...\n");
+		}
 
-		if (!arguments.late_baud && arguments.baud != 115200)
-			*((uint32_t *) &handshake.dat) = htole32(arguments.baud);
+		if (deadline_passed(deadline)) {
+			if (!arguments.reset
+			    || resets >= arguments.reset_retries) {
+				errno = ETIMEDOUT;
+				perror("Waiting for device reset");
+				return -1;
+			}
 
-		if (ws63_send_cmddef(fd, handshake,
-				     (arguments.verbose > 2) ? 3 : 0))
-			return EXIT_FAILURE;
+			printf("No answer, resetting again (%d/%d)\n",
+			       ++resets, arguments.reset_retries);
+			t_reset = mono_ms();
+			if (ws63_reset_pulse(fd) < 0)
+				return -1;
+			deadline = deadline_in(reset_ack_ms);
+			next = 0;
+		}
 
-		if (difftime(time(NULL), t0) > RESET_TIMEOUT) {
-			errno = ETIMEDOUT;
-			perror("Waiting for device reset");
-			return 1;
+		if (deadline_passed(next)) {
+			if (ws63_frame_send(fd, handshake,
+					    (arguments.verbose > 2) ? 3 : 0))
+				return -1;
+			next = deadline_in(arguments.handshake_ms);
 		}
 
-		len = read(fd, buf, 32);
-		if (len == 0) continue;
-		if (len < 0) {
+		ev = frame_next(fd, &dec, next < deadline ? next : deadline);
+		if (ev < 0) {
 			perror("read");
-			return EXIT_FAILURE;
+			return -1;
 		}
 
-		/* ACK Sequence, Command 0xE1 */
-		char ack[] = "\xEF\xBE\xAD\xDE\x0C\x00\xE1\x1E\x5A\x00";
-		uint8_t *needle = NULL;
+		if (ev == FRAME_CMD && frame_is_ack(&dec)) {
+			/*
+			  Only a reset of our own says how long the ROM takes.
+			  Had it to be repeated, the profile's timeout may be
+			  too short, the next run waits the full one.
+			*/
+			if (t_reset) {
+				ws63_learn(&cost.handshake_ms,
+					   mono_ms() - t_reset);
+				prof.reset_ms = resets ? 0 : mono_ms() - t_reset;
+			}
 
-		needle = memmem(buf, len, ack, sizeof(ack)-1);
-		if (needle) {
-			if (!arguments.late_baud && arguments.baud != 115200)
-				uart_open(&fd, NULL, arguments.baud);
+			if (!arguments.late_baud && arguments.baud != 115200) {
+				/* Nothing to echo yet, the C tells */
+				if (ws63_line_switch(fd, arguments.baud, 0) < 0)
+					return -1;
+				loader_baud = arguments.baud;
+				if (uart_baud != arguments.baud)
+					printf("Baud %d requested, driver "
+					       "applied %d\n", arguments.baud,
+					       uart_baud);
+			}
+			if (!prepped && ws63_prep_join(prep) < 0)
+				return -1;
 			printf("Establishing ymodem session...\n");
-			break;
+			return 0;
 		}
 	}
+}
 
-	/* Entered YModem Mode, Xfer loaderBoot */
-
-	if (fseek(fw, loaderboot->offset, SEEK_SET) < 0) {
-		perror("fseek");
-		return EXIT_FAILURE;
+static int prep_flash(struct ws63_job *job, FILE *out)
+{
+	/* Stage 0: Reading FWPKG file & Locate reuqired bin */
+	FILE *fw = fopen(arguments.args[1], "r");
+	if (!fw) {
+		perror("fopen");
+		return -1;
 	}
 
-	ret = ymodem_xfer(fd, fw,
-			  loaderboot->name,
-			  loaderboot->length,
-			  arguments.verbose);
-	if (ret < 0)
-		return EXIT_FAILURE;
-
-	uart_read_until_magic(fd, arguments.verbose);
-
-	/* Set baud if neccessary */
-
-	if (arguments.late_baud && arguments.baud != 115200) {
-		printf("Switching baud... ");
-		fflush(stdout);
+	struct fwpkg_header *header = fwpkg_read_header(fw);
+	if (!header) return -1;
 
-		struct cmddef baudcmd = WS63E_FLASHINFO[CMD_SETBAUDR];
-		*((uint32_t *) baudcmd.dat) = htole32(arguments.baud);
+	struct fwpkg_bin_info *bins = fwpkg_read_bin_infos(fw, header);
+	if (!bins) return -1;
 
-		ret = ws63_send_cmddef(fd, baudcmd, arguments.verbose);
-		if (ret < 0)
-			return EXIT_FAILURE;
+	static struct xfer_src fwsrc;
+	if (xfer_src_mmap(&fwsrc, fileno(fw)) < 0) return -1;
 
-		uart_read_until_magic(fd, arguments.verbose);
-		uart_open(&fd, NULL, arguments.baud);
+	for (int i = 0; i < header->cnt; i++)
+		if ((size_t) bins[i].offset + bins[i].length > fwsrc.len) {
+			fprintf(stderr, "Bad fwpkg file, %s truncated\n",
+				bins[i].name);
+			return -1;
+		}
 
-		printf("%d\n", arguments.baud);
-		uart_read_until_magic(fd, arguments.verbose);
+	struct fwpkg_bin_info *loaderboot = NULL;
+	for (int i = 0; i < header->cnt; i++)
+		if (bins[i].type_2 == 0)
+			loaderboot = &bins[i];
+	if (!loaderboot) {
+		fprintf(stderr, "Required loaderboot not found in fwpkg!\n");
+		return -1;
 	}
 
-	/* Xfer other files */
+	job->boot = xfer_src_slice(&fwsrc, loaderboot->offset,
+				   loaderboot->length);
+	job->bootname = loaderboot->name;
+
 	for (int i = 0; i < header->cnt; i++) {
 		struct fwpkg_bin_info *bin = &bins[i];
 		if (bin->type_2 != 1) continue;
@@ -368,49 +1406,65 @@ int verb_flash(int fd) {
 		if (!bin_in_args(bin->name, &arguments))
 			continue;
 
-		struct cmddef cmd = WS63E_FLASHINFO[CMD_DOWNLOADI];
+		job->plan[job->plan_n++] = (struct plan_item) {
+			.name = bin->name,
+			.src = xfer_src_slice(&fwsrc, bin->offset, bin->length),
+			.addr = bin->burn_addr,
+		};
+	}
 
-		ssize_t eras_size = -1;
-		eras_size = ceil(bin->length/8192.0)*0x2000;
+	job->plan_n = plan_merge(job->plan, job->plan_n, arguments.merge_gap);
+	if (job->plan_n < 0) {
+		perror("plan_merge");
+		return -1;
+	}
 
-		*((uint32_t *) (cmd.dat))     = htole32(bin->burn_addr);
-		*((uint32_t *) (cmd.dat + 4)) = htole32(bin->length);
-		*((uint32_t *) (cmd.dat + 8)) = htole32(eras_size);
+	fprintf(out, "+-+-------------------------------+----------+----------+-+\n");
+	fprintf(out, "|F|BIN NAME                       |LENGTH    |BURN ADDR |T|\n");
+	fprintf(out, "+-+-------------------------------+----------+----------+-+\n");
+	for (int i = 0; i < header->cnt; i++) {
+		char flash_flag = ' ';
 
-		if (ws63_send_cmddef(fd, cmd, arguments.verbose) < 0)
-			return EXIT_FAILURE;
+		if (!bins[i].type_2)
+			flash_flag = '!';
+		else if (bin_in_args(bins[i].name, &arguments))
+			flash_flag = '*';
 
-		uart_read_until_magic(fd, arguments.verbose);
+		fprintf(out, "|%c|%-31s|0x%08x|0x%08x|%d|\n",
+			flash_flag,
+			bins[i].name, bins[i].length,
+			bins[i].burn_addr, bins[i].type_2);
+	}
+	fprintf(out, "+-+-------------------------------+----------+----------+-+\n");
+	plan_print(out, job->plan, job->plan_n);
 
-		if (fseek(fw, bin->offset, SEEK_SET) < 0) {
-			perror("fseek");
-			return EXIT_FAILURE;
-		}
+	for (int i = 2; ; i++) {
+		int found = 0;
 
-		ret = ymodem_xfer(fd, fw,
-				  bin->name, bin->length,
-				  arguments.verbose);
-		if (ret < 0)
-			return EXIT_FAILURE;
+		char *arg = arguments.args[i];
+		if (!arg) break;
 
-		/*
-		  MCU won't respond if cmd followed immediately by ymodem.
-		  Put 100ms delay here to prevent stale.
-		*/
-		usleep(100000);
-	}
+		for (int j = 0; j < header->cnt; j++) {
+			struct fwpkg_bin_info *bin = bins + j;
+			if (!strcmp(arg, bin->name)) {
+				found = 1;
+				break;
+			}
+		}
 
-	printf("Done. Reseting device...\n");
-	if (ws63_poll_reset(fd, arguments.verbose) < 0)
-		perror("ws63_poll_reset");
+		if (!found) {
+			fprintf(stderr,
+				"Required bin `%s' not found in fwpkg!\n", arg);
+			return -1;
+		}
+	}
 
 	return 0;
 }
 
-int verb_write(int fd) {
-	time_t t0;
-	FILE *fw;
-	int ret;
+static int prep_write(struct ws63_job *job, FILE *out)
+{
+	int ret, n;
 
 	/* Parsing input arguments */
 	struct wobj wobjs[MAX_PARTITION_CNT];
@@ -424,7 +1478,7 @@ int verb_write(int fd) {
 			fprintf(stderr,
 				"Error: address needed for %s (HINT: %s@addr)\n",
 				arg_current, arg_current);
-			return EXIT_FAILURE;
+			return -1;
 		}
 
 		wobj_current->name = arg_current;
@@ -434,7 +1488,7 @@ int verb_write(int fd) {
 			if (sscanf(sep+1, "%zx", &wobj_current->addr) != 1) {
 				fprintf(stderr, "Error: invalid address %s for %s\n",
 					sep+1, arg_current);
-				return EXIT_FAILURE;
+				return -1;
 			}
 		}
 
@@ -449,9 +1503,33 @@ int verb_write(int fd) {
 		wobj_current->length = st.st_size;
 	}
 
-	printf("+-+-------------------------------+----------+----------+-+\n");
-	printf("|F|BIN NAME                       |LENGTH    |BURN ADDR |T|\n");
-	printf("+-+-------------------------------+----------+----------+-+\n");
+	/* Map the images to burn, merging neighbours */
+	if (ws63_job_open(job, wobjs[0].name, &job->boot) < 0)
+		goto err;
+	job->bootname = basename(wobjs[0].name);
+
+	for (int i = 1; i < arguments.args_cnt-1; i++) {
+		struct wobj *wobj_current = &wobjs[i];
+
+		job->plan[job->plan_n] = (struct plan_item) {
+			.name = basename(wobj_current->name),
+			.addr = wobj_current->addr,
+		};
+		if (ws63_job_open(job, wobj_current->name,
+				  &job->plan[job->plan_n++].src) < 0)
+			goto err;
+	}
+
+	n = plan_merge(job->plan, job->plan_n, arguments.merge_gap);
+	if (n < 0) {
+		perror("plan_merge");
+		goto err;
+	}
+	job->plan_n = n;
+
+	fprintf(out, "+-+-------------------------------+----------+----------+-+\n");
+	fprintf(out, "|F|BIN NAME                       |LENGTH    |BURN ADDR |T|\n");
+	fprintf(out, "+-+-------------------------------+----------+----------+-+\n");
 	for (int i = 0; i < arguments.args_cnt-1; i++) {
 		struct wobj *wobj_current = &wobjs[i];
 		char flash_flag;
@@ -460,210 +1538,190 @@ int verb_write(int fd) {
 		flash_flag = (i == 0) ? '!' : '*';
 		type_2 = (i == 0) ? 0 : 1;
 
-		printf("|%c|%-31s|0x%08zx|0x%08zx|%d|\n",
-		       flash_flag,
-		       basename(wobj_current->name),
-		       wobj_current->length,
-		       wobj_current->addr, type_2);
+		fprintf(out, "|%c|%-31s|0x%08zx|0x%08zx|%d|\n",
+			flash_flag,
+			basename(wobj_current->name),
+			wobj_current->length,
+			wobj_current->addr, type_2);
 	}
-	printf("+-+-------------------------------+----------+----------+-+\n");
+	fprintf(out, "+-+-------------------------------+----------+----------+-+\n");
+	plan_print(out, job->plan, job->plan_n);
 
-	/* Stage 1: Flash loaderboot */
+	return 0;
 
-	/* Handshake to enter YModem Mode */
+ err:
+	ws63_job_free(job);
+	return -1;
+}
 
-	printf("Waiting for device reset...\n");
-	t0 = time(NULL);
-	while (1) {
-		struct cmddef handshake = WS63E_FLASHINFO[CMD_HANDSHAKE];
-		uint8_t buf[32];
-		int len;
+static int prep_write_prog(struct ws63_job *job, FILE *out)
+{
+	/* Parsing input arguments */
+	struct xfer_src binsrc;
 
-		if (!arguments.late_baud && arguments.baud != 115200)
-			*((uint32_t *) &handshake.dat) = htole32(arguments.baud);
+	if (ws63_job_open(job, arguments.args[1], &binsrc) < 0)
+		return -1;
 
-		if (ws63_send_cmddef(fd, handshake,
-				     (arguments.verbose > 2) ? 3 : 0))
-			return EXIT_FAILURE;
+	/* Sign, the image goes out as {header, code, padding} */
+	const uint8_t *code = xfer_src_contig(&binsrc);
 
-		if (difftime(time(NULL), t0) > RESET_TIMEOUT) {
-			errno = ETIMEDOUT;
-			perror("Waiting for device reset");
-			return 1;
+	if (!code) {
+		job->progbuf = malloc(binsrc.len);
+		if (!job->progbuf || xfer_src_read(&binsrc, 0, job->progbuf,
+						   binsrc.len) < 0) {
+			perror(arguments.args[1]);
+			ws63_job_free(job);
+			return -1;
 		}
+		code = job->progbuf;
+	}
 
-		len = read(fd, buf, 32);
-		if (len == 0) continue;
-		if (len < 0) {
-			perror("read");
-			return EXIT_FAILURE;
-		}
+	ws63sign_init(&job->sign);
+	ws63sign_feed(&job->sign, code, binsrc.len);
 
-		/* ACK Sequence, Command 0xE1 */
-		char ack[] = "\xEF\xBE\xAD\xDE\x0C\x00\xE1\x1E\x5A\x00";
-		uint8_t *needle = NULL;
+	static const uint8_t nil128[16];
+	size_t padding = ws63sign_finalize(&job->sign);
 
-		needle = memmem(buf, len, ack, sizeof(ack)-1);
-		if (needle) {
-			if (!arguments.late_baud && arguments.baud != 115200)
-				uart_open(&fd, NULL, arguments.baud);
-			printf("Establishing ymodem session...\n");
-			break;
-		}
-	}
+	job->progiov[0] = (struct iovec) { job->sign.buf, sizeof(job->sign.buf) };
+	job->progiov[1] = (struct iovec) { (void *) code, binsrc.len };
+	job->progiov[2] = (struct iovec) { (void *) nil128, padding };
 
-	/* Entered YModem Mode, Xfer loaderBoot */
-	fw = fopen(wobjs[0].name, "r");
-	if (!fw) { perror(wobjs[0].name); return errno; }
+	job->bootpre = ws63_loaderboot_frames;
+	job->plan[job->plan_n++] = (struct plan_item) {
+		.name = "ws63flash_prog",
+		.src = xfer_src_iov(job->progiov, 3),
+		.addr = 0x230000,
+	};
+
+	(void) out;
+	return 0;
+}
+
+/* Send the loaderboot of JOB and wait for it to come up */
+static int ws63_loaderboot(int fd)
+{
+	int64_t t0;
+	int ret;
 
-	ret = ymodem_xfer(fd, fw,
-			  basename(wobjs[0].name),
-			  wobjs[0].length,
-			  arguments.verbose);
+	if (job.bootpre)
+		ret = ymodem_xfer_frames(fd, job.bootpre,
+					 ws63_loaderboot_frames_name,
+					 ws63_loaderboot_frames_len,
+					 arguments.verbose);
+	else
+		ret = ymodem_xfer_src(fd, &job.boot, 0, job.boot.len,
+				      job.bootname, arguments.verbose);
 	if (ret < 0)
-		return EXIT_FAILURE;
+		return ret;
+	ws63_learn_xfer();
 
+	t0 = mono_ms();
 	uart_read_until_magic(fd, arguments.verbose);
+	ws63_learn(&cost.boot_ms, mono_ms() - t0);
+	return 0;
+}
 
-	/* Set baud if neccessary */
+/*
+  Common to --flash, --write & --write-program: prepare concurrently
+  with the handshake, then loaderboot, baud switch and the downloads
+*/
+static int ws63_burn(int fd, int (*prep_fn)(struct ws63_job *, FILE *))
+{
+	static struct ws63_prep prep;
 
-	if (arguments.late_baud && arguments.baud != 115200) {
-		printf("Switching baud... ");
-		fflush(stdout);
+	if (ws63_prep_start(&prep, prep_fn) < 0)
+		return EXIT_FAILURE;
 
-		struct cmddef baudcmd = WS63E_FLASHINFO[CMD_SETBAUDR];
-		*((uint32_t *) baudcmd.dat) = htole32(arguments.baud);
+	/* Stage 1: Flash loaderboot */
 
-		ret = ws63_send_cmddef(fd, baudcmd, arguments.verbose);
-		if (ret < 0)
-			return EXIT_FAILURE;
+	if (arguments.low_latency)
+		ws63_latency_as_found(1);
 
-		uart_read_until_magic(fd, arguments.verbose);
-		uart_open(&fd, NULL, arguments.baud);
+	/* Handshake to enter YModem Mode */
 
-		printf("%d\n", arguments.baud);
-		uart_read_until_magic(fd, arguments.verbose);
-	}
+	if (ws63_handshake(fd, &prep) < 0)
+		return EXIT_FAILURE;
 
-	/* Xfer other files */
-	for (int i = 1; i < arguments.args_cnt-1; i++) {
-		struct wobj *wobj_current = &wobjs[i];
-		struct cmddef cmd = WS63E_FLASHINFO[CMD_DOWNLOADI];
+	/* Entered YModem Mode, Xfer loaderBoot */
+
+	if (ws63_loaderboot(fd) < 0)
+		return EXIT_FAILURE;
+
+	if (arguments.low_latency)
+		ws63_latency_as_found(0);
 
-		ssize_t eras_size = -1;
-		eras_size = ceil(wobj_current->length/8192.0)*0x2000;
+	/* Set baud if neccessary */
 
-		*((uint32_t *) (cmd.dat))     = htole32(wobj_current->addr);
-		*((uint32_t *) (cmd.dat + 4)) = htole32(wobj_current->length);
-		*((uint32_t *) (cmd.dat + 8)) = htole32(eras_size);
+	if (arguments.baud_auto) {
+		if (ws63_baud_auto(fd) < 0)
+			return EXIT_FAILURE;
+	} else if (arguments.late_baud && arguments.baud != 115200) {
+		printf("Switching baud... ");
+		fflush(stdout);
 
-		if (ws63_send_cmddef(fd, cmd, arguments.verbose) < 0)
+		if (ws63_baud_switch(fd, arguments.baud) < 0) {
+			printf("no answer at %d\n", arguments.baud);
 			return EXIT_FAILURE;
+		}
+		prof.late_baud = 1;
 
-		uart_read_until_magic(fd, arguments.verbose);
+		/* What the driver applied, BOTHER rates may be rounded */
+		printf("%d\n", uart_baud);
+	}
 
-		fw = fopen(wobj_current->name, "r");
-		if (!fw) { perror(wobj_current->name); return errno; }
+	if (arguments.rtscts && ws63_flow_detect(fd) < 0)
+		return EXIT_FAILURE;
 
-		ret = ymodem_xfer(fd, fw,
-				  basename(wobj_current->name),
-				  wobj_current->length,
-				  arguments.verbose);
-		if (ret < 0)
+	/* Xfer other files */
+	for (int i = 0; i < job.plan_n; i++)
+		if (ws63_download(fd, &job.plan[i].src, job.plan[i].name,
+				  job.plan[i].addr) < 0)
 			return EXIT_FAILURE;
 
-		/*
-		  MCU won't respond if cmd followed immediately by ymodem.
-		  Put 100ms delay here to prevent stale.
-		*/
-		usleep(100000);
-	}
+	ws63_job_free(&job);
+
+	if (arguments.low_latency)
+		ws63_latency_report();
 
 	printf("Done. Reseting device...\n");
 	if (ws63_poll_reset(fd, arguments.verbose) < 0)
 		perror("ws63_poll_reset");
+
 	return 0;
 }
 
-int verb_erase(int fd) {
-	time_t t0;
-	int ret;
-
-	/* Stage 0: Build loaderboot */
-
-	int bootfd = -1;
-
-	bootfd = shm_tmpfile_fd(ws63_loaderboot_signed_len);
-	if (bootfd < 0)
-		return 1;
+int verb_flash(int fd) {
+	return ws63_burn(fd, prep_flash);
+}
 
-	FILE	*bootf = fdopen(bootfd, "w+");
-	checked_fwrite(ws63_loaderboot_signed_bin, 1, ws63_loaderboot_signed_len,
-		       bootf);
-	fseek(bootf, 0, SEEK_SET);
+int verb_write(int fd) {
+	return ws63_burn(fd, prep_write);
+}
 
+int verb_erase(int fd) {
 	/* Stage 1: Flash loaderboot */
 
 	/* Handshake to enter YModem Mode */
 
-	printf("Waiting for device reset...\n");
-	t0 = time(NULL);
-	while (1) {
-		struct cmddef handshake = WS63E_FLASHINFO[CMD_HANDSHAKE];
-		uint8_t buf[32];
-		int len;
-
-		if (!arguments.late_baud && arguments.baud != 115200)
-			*((uint32_t *) &handshake.dat) = htole32(arguments.baud);
-
-		if (ws63_send_cmddef(fd, handshake,
-				     (arguments.verbose > 2) ? 3 : 0))
-			return EXIT_FAILURE;
-
-		if (difftime(time(NULL), t0) > RESET_TIMEOUT) {
-			errno = ETIMEDOUT;
-			perror("Waiting for device reset");
-			return 1;
-		}
-
-		len = read(fd, buf, 32);
-		if (len == 0) continue;
-		if (len < 0) {
-			perror("read");
-			return EXIT_FAILURE;
-		}
-
-		/* ACK Sequence, Command 0xE1 */
-		char ack[] = "\xEF\xBE\xAD\xDE\x0C\x00\xE1\x1E\x5A\x00";
-		uint8_t *needle = NULL;
-
-		needle = memmem(buf, len, ack, sizeof(ack)-1);
-		if (needle) {
-			if (!arguments.late_baud && arguments.baud != 115200)
-				uart_open(&fd, NULL, arguments.baud);
-			printf("Establishing ymodem session...\n");
-			break;
-		}
-	}
+	if (ws63_handshake(fd, NULL) < 0)
+		return EXIT_FAILURE;
 
 	/* Entered YModem Mode, Xfer loaderBoot */
 
-	fseek(bootf, 0, SEEK_SET);
-
-	ret = ymodem_xfer(fd, bootf,
-			  "root_loaderboot_sign.bin",
-			  ws63_loaderboot_signed_len,
-			  arguments.verbose);
-	if (ret < 0)
+	job.bootpre = ws63_loaderboot_frames;
+	if (ws63_loaderboot(fd) < 0)
 		return EXIT_FAILURE;
 
-	uart_read_until_magic(fd, arguments.verbose);
+	if (arguments.rtscts && ws63_flow_detect(fd) < 0)
+		return EXIT_FAILURE;
 
 	printf("Erasing flash....\n");
-	if (ws63_send_cmddef(fd, WS63E_FLASHINFO[CMD_DOWNLOADI],
-			     arguments.verbose) < 0)
+	int64_t t0 = mono_ms();
+	if (ws63_frame_send(fd, ws63_downloadi_frame(0, 0, UINT32_MAX),
+			    arguments.verbose) < 0)
 		return EXIT_FAILURE;
 	uart_read_until_magic(fd, arguments.verbose);
+	ws63_learn(&cost.chip_erase_ms, mono_ms() - t0);
 
 	printf("Done. Reseting device...\n");
         if (ws63_poll_reset(fd, arguments.verbose) < 0)
@@ -672,184 +1730,145 @@ int verb_erase(int fd) {
 }
 
 int verb_write_prog(int fd) {
-	struct ws63sign_ctx ctx = { 0 };
-	time_t t0;
-	int ret;
-
-	/* Parsing input arguments */
-	FILE	*binf	= fopen(arguments.args[1], "r");
-	size_t	 binlen = 0;
-
-	if (!binf) {
-		perror(arguments.args[1]);
-		return 1;
-	}
-
-	fseek(binf, 0, SEEK_END);
-	binlen = ftell(binf);
-	fseek(binf, 0, SEEK_SET);
-
-	int bootfd = -1, outfd = -1;
-
-	bootfd = shm_tmpfile_fd(ws63_loaderboot_signed_len);
-	outfd = shm_tmpfile_fd(((binlen + 15) & ~15) + sizeof(ctx.buf));
-	if (bootfd < 0 || outfd < 0)
-		return 1;
-
-	FILE	*bootf = fdopen(bootfd, "w+");
-	FILE	*outf  = fdopen(outfd, "w+");
-
-	checked_fwrite(ws63_loaderboot_signed_bin, 1, ws63_loaderboot_signed_len,
-		       bootf);
-	fseek(bootf, 0, SEEK_SET);
-
-	{
-		ws63sign_init(&ctx);
-
-		unsigned char buf[4096] = { 0 };
-		size_t read_len = 0;
-
-		checked_fwrite(ctx.buf, 1, sizeof(ctx.buf), outf);
-
-		while ((read_len = fread(buf, 1, sizeof(buf), binf)) > 0) {
-			ws63sign_feed(&ctx, buf, read_len);
-			checked_fwrite(buf, 1, read_len, outf);
-		}
-
-		size_t padding = ws63sign_finalize(&ctx);
-		unsigned char nil128[16] = { 0 };
-		checked_fwrite(nil128, 1, padding, outf);
-
-		fseek(outf, 0, SEEK_SET);
-		checked_fwrite(ctx.buf, 1, sizeof(ctx.buf), outf);
-	}
-
-	/* Stage 1: Flash loaderboot */
-
-	/* Handshake to enter YModem Mode */
-
-	printf("Waiting for device reset...\n");
-	t0 = time(NULL);
-	while (1) {
-		struct cmddef handshake = WS63E_FLASHINFO[CMD_HANDSHAKE];
-		uint8_t buf[32];
-		int len;
-
-		if (!arguments.late_baud && arguments.baud != 115200)
-			*((uint32_t *) &handshake.dat) = htole32(arguments.baud);
-
-		if (ws63_send_cmddef(fd, handshake,
-				     (arguments.verbose > 2) ? 3 : 0))
-			return EXIT_FAILURE;
+	return ws63_burn(fd, prep_write_prog);
+}
 
-		if (difftime(time(NULL), t0) > RESET_TIMEOUT) {
-			errno = ETIMEDOUT;
-			perror("Waiting for device reset");
-			return 1;
-		}
+static double ws63_estimate_row(const char *what, double ms)
+{
+	printf("  %-31s %9.2fs\n", what, ms / 1000);
+	return ms;
+}
 
-		len = read(fd, buf, 32);
-		if (len == 0) continue;
-		if (len < 0) {
-			perror("read");
-			return EXIT_FAILURE;
+/* Time to erase & program one plan item, as ws63_download() does it */
+static double ws63_estimate_item(const struct plan_item *it, int baud)
+{
+	size_t len = it->src.len, blocks = ceil(len/8192.0);
+	double erase = blocks * cost.erase_ms, xfer = 0;
+	int cmds = 1;
+
+	if (arguments.sparse) {
+		struct sparse_seg *segs;
+		size_t ofs = 0;
+		int n = sparse_plan(&it->src, it->addr, &segs);
+
+		if (n < 0) {
+			perror("sparse_plan");
+			return -1;
 		}
 
-		/* ACK Sequence, Command 0xE1 */
-		char ack[] = "\xEF\xBE\xAD\xDE\x0C\x00\xE1\x1E\x5A\x00";
-		uint8_t *needle = NULL;
-
-		needle = memmem(buf, len, ack, sizeof(ack)-1);
-		if (needle) {
-			if (!arguments.late_baud && arguments.baud != 115200)
-				uart_open(&fd, NULL, arguments.baud);
-			printf("Establishing ymodem session...\n");
-			break;
+		cmds = 0;
+		for (int i = 0; i < n; i++) {
+			cmds += 1 + (segs[i].ofs > ofs);
+			xfer += cost_xfer_ms(&cost, segs[i].len, baud,
+					     arguments.window);
+			ofs = segs[i].ofs + segs[i].len;
 		}
+		cmds += (ofs < len);
+		free(segs);
+	} else {
+		xfer = cost_xfer_ms(&cost, len, baud, arguments.window);
 	}
 
-	/* Entered YModem Mode, Xfer loaderBoot */
-
-	fseek(bootf, 0, SEEK_SET);
+	printf("  %-31s %9.2fs  (erase %.2fs, xfer %.2fs)\n", it->name,
+	       (cmds * cost.cmd_ms + erase + xfer) / 1000,
+	       erase / 1000, xfer / 1000);
+	return cmds * cost.cmd_ms + erase + xfer;
+}
 
-	ret = ymodem_xfer(fd, bootf,
-			  "root_loaderboot_sign.bin",
-			  ws63_loaderboot_signed_len,
-			  arguments.verbose);
-	if (ret < 0)
+/*
+  --dry-run: prepare as the verb would, then add up the phases with the
+  cost model instead of talking to the device
+*/
+static int ws63_dry_run(int (*prep_fn)(struct ws63_job *, FILE *))
+{
+	int boot_baud = arguments.late_baud ? 115200 : arguments.baud;
+	int baud = arguments.baud;
+	int prof_rate = prof_known && prof.baud > 0;
+	double total = 0;
+
+	/*
+	  Auto goes with the adapter's profile, if there is one, or assumes
+	  the top of the ladder, a lower bound of the time
+	*/
+	if (arguments.baud_auto && prof_rate && prof.late_baud != 0)
+		baud = baud_ladder[ws63_baud_profile_rung()];
+	else if (arguments.baud_auto && !prof_rate)
+		for (int i = 0; i < BAUD_LADDER_N; i++)
+			if (baud_avail(baud_ladder[i]))
+				baud = baud_ladder[i];
+
+	if (prof_known && prof.rtt_ms > 0)
+		cost.rtt_ms = prof.rtt_ms;
+
+	if (prep_fn && prep_fn(&job, stdout) < 0)
 		return EXIT_FAILURE;
-
-	uart_read_until_magic(fd, arguments.verbose);
-
-	/* Set baud if neccessary */
-
-	if (arguments.late_baud && arguments.baud != 115200) {
-		printf("Switching baud... ");
-		fflush(stdout);
-
-		struct cmddef baudcmd = WS63E_FLASHINFO[CMD_SETBAUDR];
-		*((uint32_t *) baudcmd.dat) = htole32(arguments.baud);
-
-		ret = ws63_send_cmddef(fd, baudcmd, arguments.verbose);
-		if (ret < 0)
+	if (!prep_fn)
+		job.bootpre = ws63_loaderboot_frames;
+
+	printf("Estimate at %s%d baud, %s cost model:\n",
+	       arguments.baud_auto && !prof_rate ? "up to " : "", baud,
+	       prof_known ? "adapter profile &"
+	       : cost_calibrated ? "calibrated" : "default");
+
+	total += ws63_estimate_row("handshake", cost.handshake_ms);
+	total += ws63_estimate_row(job.bootpre ? ws63_loaderboot_frames_name
+				   : job.bootname,
+				   cost_xfer_ms(&cost, job.bootpre
+						? ws63_loaderboot_frames_len
+						: job.boot.len,
+						boot_baud, arguments.window)
+				   + cost.boot_ms);
+
+	/* --erase stays at the rate of the handshake, it never switches */
+	if (prep_fn && arguments.baud_auto && prof_rate)
+		total += ws63_estimate_row("baud switch", (BAUD_ECHO_N + 1)
+					   * cost.cmd_ms);
+	else if (prep_fn && arguments.baud_auto)
+		total += ws63_estimate_row("baud probe", BAUD_LADDER_N
+					   * (BAUD_ECHO_N + 1) * cost.cmd_ms);
+	else if (prep_fn && arguments.late_baud && arguments.baud != 115200)
+		total += ws63_estimate_row("baud switch", cost.cmd_ms);
+
+	for (int i = 0; i < job.plan_n; i++) {
+		double ms = ws63_estimate_item(&job.plan[i], baud);
+
+		if (ms < 0)
 			return EXIT_FAILURE;
-
-		uart_read_until_magic(fd, arguments.verbose);
-		uart_open(&fd, NULL, arguments.baud);
-
-		printf("%d\n", arguments.baud);
-		uart_read_until_magic(fd, arguments.verbose);
+		total += ms;
 	}
 
-	/* Xfer other files */
-	fseek(outf, 0, SEEK_SET);
-
-        {
-		struct cmddef cmd = WS63E_FLASHINFO[CMD_DOWNLOADI];
-
-		ssize_t eras_size = -1;
-		eras_size = ceil((ctx.len + sizeof(ctx.buf))/8192.0)*0x2000;
-
-		*((uint32_t *) (cmd.dat))     = htole32(0x230000);
-		*((uint32_t *) (cmd.dat + 4)) = htole32(ctx.len + sizeof(ctx.buf));
-		*((uint32_t *) (cmd.dat + 8)) = htole32(eras_size);
-
-		if (ws63_send_cmddef(fd, cmd, arguments.verbose) < 0)
-			return EXIT_FAILURE;
-
-		uart_read_until_magic(fd, arguments.verbose);
-
-		ret = ymodem_xfer(fd, outf,
-				  "ws63flash_prog",
-				  ctx.len + sizeof(ctx.buf),
-				  arguments.verbose);
-		if (ret < 0)
-			return EXIT_FAILURE;
+	if (!prep_fn)
+		total += ws63_estimate_row("erase", cost.chip_erase_ms);
 
-		/*
-		  MCU won't respond if cmd followed immediately by ymodem.
-		  Put 100ms delay here to prevent stale.
-		*/
-		usleep(100000);
-	}
+	total += ws63_estimate_row("reset", cost.cmd_ms);
+	printf("  %-31s %9.2fs\n", "total", total / 1000);
 
-	printf("Done. Reseting device...\n");
-	if (ws63_poll_reset(fd, arguments.verbose) < 0)
-		perror("ws63_poll_reset");
-	return 0;
+	ws63_job_free(&job);
+	return EXIT_SUCCESS;
 }
 
 int main (int argc, char **argv)
 {
-	time_t t0;
 	int fd = -1, ret;
 
 	arguments.verb	  = 0;
 	arguments.baud	  = 115200;
 	arguments.verbose = 0;
+	arguments.window  = 1;
+	arguments.retries = 3;
+	arguments.reset_pulse	= 100;
+	arguments.reset_retries	= 3;
+	arguments.handshake_ms	= HANDSHAKE_INTERVAL;
 
 	argp_parse(&argp, argc, argv, 0, 0, &arguments);
 
+	ymodem_cfg.window = arguments.window;
+	ymodem_cfg.out_drain = uart_drain;
+	cost_calibrated = cost_load(&cost);
+
+	if (arguments.verbose > 1)
+		printf("CRC16 kernel: %s\n", crc16_xmodem_impl());
+
 	if (!arguments.verb) {
 		argp_help(&argp, stderr, ARGP_HELP_SHORT_USAGE, PACKAGE_NAME);
 		return EXIT_FAILURE;
@@ -869,6 +1888,36 @@ int main (int argc, char **argv)
         }
 #endif
 
+	char key[sizeof(prof.key)];
+
+	profile_key(arguments.args[0], key, sizeof(key));
+	prof_known = profile_load(key, &prof);
+	if (prof_known && arguments.verbose)
+		printf("Profile %s: %d baud, %.2f ms RTT, %.1f%% errors, "
+		       "%d ms ACK, %d ms reset\n", prof.key, prof.baud,
+		       prof.rtt_ms, prof.err_rate * 100, prof.ack_ms,
+		       prof.reset_ms);
+
+	if (arguments.dry_run)
+		switch (arguments.verb) {
+		case 'f': return ws63_dry_run(prep_flash);
+		case 'w': return ws63_dry_run(prep_write);
+		case 'e': return ws63_dry_run(NULL);
+		case 2:	  return ws63_dry_run(prep_write_prog);
+		}
+
+	/* Start from what the profile knows of the adapter */
+	if (prof_known && prof.low_latency && !arguments.low_latency) {
+		printf("Low latency: on, it paid off on this adapter\n");
+		uart_opts.low_latency = 1;
+	} else
+		uart_opts.low_latency = arguments.low_latency;
+	ymodem_cfg.ack_ms = profile_timeout(prof.ack_ms, YMODEM_ACK_TIMEOUT);
+	if (prof_known && arguments.verbose)
+		printf("Profile timeouts: ACK %d ms, reset %d ms\n",
+		       ymodem_cfg.ack_ms,
+		       profile_timeout(prof.reset_ms, RESET_ACK_TIMEOUT));
+
 	/* 115200 baud, default baud for MCU */
 	ret = uart_open(&fd, arguments.args[0], 115200);
 	if (ret < 0 || fd < 0) return EXIT_FAILURE;
@@ -892,7 +1941,31 @@ int main (int argc, char **argv)
 		return EXIT_FAILURE;
 	}
 
+	/* Keep what this run measured for the next --dry-run */
+	if (ret == EXIT_SUCCESS && cost_learnt && cost_save(&cost) < 0
+	    && arguments.verbose)
+		perror("cost_save");
+
+	/*
+	  The rate & its error rate only say something about the ladder
+	  when --baud auto picked it. An ACK timeout may be the profile's
+	  cutting it too short, the next run waits the full one then.
+	*/
+	if (ret == EXIT_SUCCESS) {
+		if (arguments.baud_auto) {
+			prof.baud = line_baud;
+			if (tally_frames)
+				prof.err_rate = (double) tally_bad
+					/ tally_frames;
+		}
+		if (tally_frames)
+			prof.ack_ms = tally_timeouts ? 0 : tally_ack_ms;
+		if (profile_save(&prof) < 0 && arguments.verbose)
+			perror("profile_save");
+	}
+
 	/* Reset TTY to 115200 baud/s */
 	uart_open(&fd, NULL, 115200);
+	uart_close(&fd);
 	return ret;
 }
@@ -0,0 +1,255 @@
+/*
+  xfer_src.h - Image Sources for Transfers
+  Copyright (C) 2024-2025  Gong Zhile
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _XFER_SRC_H_
+#define _XFER_SRC_H_
+
+#include "config.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+/*
+  Where the bytes of an image come from. Memory backed sources (a
+  buffer or a mapped file) hand out pointers straight into the image;
+  a gather list or a file descriptor copy into the caller's scratch,
+  only where a block actually isn't contiguous.
+*/
+enum xfer_src_kind {
+	XFER_SRC_BUF,
+	XFER_SRC_MMAP,
+	XFER_SRC_IOV,
+	XFER_SRC_FD,
+};
+
+struct xfer_src {
+	enum xfer_src_kind	 kind;
+	size_t			 len;
+
+	const uint8_t		*dat;		/* BUF & MMAP */
+	const struct iovec	*iov;		/* IOV */
+	int			 iovcnt;
+	int			 fd;		/* FD */
+	off_t			 fdofs;
+};
+
+static inline struct xfer_src xfer_src_buf(const void *dat, size_t len)
+{
+	return (struct xfer_src) {
+		.kind = XFER_SRC_BUF, .len = len, .dat = dat,
+	};
+}
+
+/* IOV must stay around as long as the source does */
+static inline struct xfer_src xfer_src_iov(const struct iovec *iov, int cnt)
+{
+	struct xfer_src s = {
+		.kind = XFER_SRC_IOV, .iov = iov, .iovcnt = cnt,
+	};
+
+	for (int i = 0; i < cnt; i++)
+		s.len += iov[i].iov_len;
+	return s;
+}
+
+/* LEN bytes of FD from OFS, read with pread(2) */
+static inline struct xfer_src xfer_src_fd(int fd, off_t ofs, size_t len)
+{
+	return (struct xfer_src) {
+		.kind = XFER_SRC_FD, .len = len, .fd = fd, .fdofs = ofs,
+	};
+}
+
+/*
+  Map the whole file FD read-only. Files that can't be mapped fall back
+  to a FD source. Returns 0, or -1 if FD isn't usable at all.
+*/
+static inline int xfer_src_mmap(struct xfer_src *s, int fd)
+{
+	struct stat st;
+	void *map;
+
+	if (fstat(fd, &st) < 0) {
+		perror("fstat");
+		return -1;
+	}
+
+	if (st.st_size == 0) {
+		fprintf(stderr, "xfer_src_mmap: empty file\n");
+		return -1;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED) {
+		*s = xfer_src_fd(fd, 0, st.st_size);
+		return 0;
+	}
+
+	posix_madvise(map, st.st_size, POSIX_MADV_SEQUENTIAL);
+
+	*s = (struct xfer_src) {
+		.kind = XFER_SRC_MMAP, .len = st.st_size, .dat = map,
+	};
+	return 0;
+}
+
+/*
+  Open PATH as a source of its own, mapped if it can be. The descriptor
+  is only kept for the FD fallback, until xfer_src_close().
+*/
+static inline int xfer_src_open(struct xfer_src *s, const char *path)
+{
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0) {
+		perror(path);
+		return -1;
+	}
+
+	if (xfer_src_mmap(s, fd) < 0) {
+		close(fd);
+		return -1;
+	}
+
+	if (s->kind != XFER_SRC_FD)
+		close(fd);
+	return 0;
+}
+
+/*
+  LEN bytes of S from OFS as a source of its own, which isn't to be
+  closed. Gather lists are only sliced within a single element.
+*/
+static inline struct xfer_src
+xfer_src_slice(const struct xfer_src *s, size_t ofs, size_t len)
+{
+	switch (s->kind) {
+	case XFER_SRC_FD:
+		return xfer_src_fd(s->fd, s->fdofs + ofs, len);
+	case XFER_SRC_IOV:
+		for (int i = 0; i < s->iovcnt; i++) {
+			if (ofs < s->iov[i].iov_len)
+				return xfer_src_buf((const uint8_t *)
+						    s->iov[i].iov_base + ofs,
+						    len);
+			ofs -= s->iov[i].iov_len;
+		}
+		return xfer_src_buf(NULL, 0);
+	default:
+		return xfer_src_buf(s->dat + ofs, len);
+	}
+}
+
+/* Sources from xfer_src_open() only */
+static inline void xfer_src_close(struct xfer_src *s)
+{
+	if (s->kind == XFER_SRC_MMAP)
+		munmap((void *) s->dat, s->len);
+	else if (s->kind == XFER_SRC_FD)
+		close(s->fd);
+}
+
+/* The whole image if it sits contiguous in memory, NULL otherwise */
+static inline const uint8_t *xfer_src_contig(const struct xfer_src *s)
+{
+	return (s->kind == XFER_SRC_BUF || s->kind == XFER_SRC_MMAP)
+		? s->dat : NULL;
+}
+
+/*
+  LEN bytes at OFS of the image, pointing into it where possible, else
+  copied to SCRATCH. Returns NULL with errno set on a failed read.
+*/
+static inline const uint8_t *
+xfer_src_get(const struct xfer_src *s, size_t ofs, size_t len,
+	     uint8_t *scratch)
+{
+	size_t done = 0;
+
+	switch (s->kind) {
+	case XFER_SRC_BUF:
+	case XFER_SRC_MMAP:
+		return s->dat + ofs;
+	case XFER_SRC_IOV:
+		for (int i = 0; i < s->iovcnt && done < len; i++) {
+			const struct iovec *v = &s->iov[i];
+
+			if (ofs >= v->iov_len) {
+				ofs -= v->iov_len;
+				continue;
+			}
+
+			size_t n = v->iov_len - ofs;
+			if (n > len - done)
+				n = len - done;
+
+			/* Entirely within one element, no copy needed */
+			if (n == len)
+				return (const uint8_t *) v->iov_base + ofs;
+
+			memcpy(scratch + done,
+			       (const uint8_t *) v->iov_base + ofs, n);
+			done += n;
+			ofs = 0;
+		}
+		break;
+	case XFER_SRC_FD:
+		while (done < len) {
+			ssize_t ret = pread(s->fd, scratch + done, len - done,
+					    s->fdofs + ofs + done);
+			if (ret < 0 && errno == EINTR)
+				continue;
+			if (ret <= 0) {
+				if (ret == 0)
+					errno = EIO;
+				return NULL;
+			}
+			done += ret;
+		}
+		break;
+	}
+
+	if (done < len) {
+		errno = EINVAL;
+		return NULL;
+	}
+	return scratch;
+}
+
+/* Copy LEN bytes at OFS to BUF, returns 0 or -errno */
+static inline int
+xfer_src_read(const struct xfer_src *s, size_t ofs, uint8_t *buf, size_t len)
+{
+	const uint8_t *p = xfer_src_get(s, ofs, len, buf);
+
+	if (!p)
+		return -errno;
+	if (p != buf)
+		memcpy(buf, p, len);
+	return 0;
+}
+
+#endif	/* _XFER_SRC_H_ */
@@ -20,6 +20,10 @@
 #define _YMODEM_H_
 
 #include "config.h"
+#include "crc16.h"
+#include "deadline.h"
+#include "frame.h"
+#include "xfer_src.h"
 
 #include <ctype.h>
 #include <endian.h>
@@ -32,57 +36,65 @@
 #include <unistd.h>
 #include <math.h>
 #include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/uio.h>
 
-static const unsigned short crc16_tbl[256]= {
-	0x0000,0x1021,0x2042,0x3063,0x4084,0x50a5,0x60c6,0x70e7,
-	0x8108,0x9129,0xa14a,0xb16b,0xc18c,0xd1ad,0xe1ce,0xf1ef,
-	0x1231,0x0210,0x3273,0x2252,0x52b5,0x4294,0x72f7,0x62d6,
-	0x9339,0x8318,0xb37b,0xa35a,0xd3bd,0xc39c,0xf3ff,0xe3de,
-	0x2462,0x3443,0x0420,0x1401,0x64e6,0x74c7,0x44a4,0x5485,
-	0xa56a,0xb54b,0x8528,0x9509,0xe5ee,0xf5cf,0xc5ac,0xd58d,
-	0x3653,0x2672,0x1611,0x0630,0x76d7,0x66f6,0x5695,0x46b4,
-	0xb75b,0xa77a,0x9719,0x8738,0xf7df,0xe7fe,0xd79d,0xc7bc,
-	0x48c4,0x58e5,0x6886,0x78a7,0x0840,0x1861,0x2802,0x3823,
-	0xc9cc,0xd9ed,0xe98e,0xf9af,0x8948,0x9969,0xa90a,0xb92b,
-	0x5af5,0x4ad4,0x7ab7,0x6a96,0x1a71,0x0a50,0x3a33,0x2a12,
-	0xdbfd,0xcbdc,0xfbbf,0xeb9e,0x9b79,0x8b58,0xbb3b,0xab1a,
-	0x6ca6,0x7c87,0x4ce4,0x5cc5,0x2c22,0x3c03,0x0c60,0x1c41,
-	0xedae,0xfd8f,0xcdec,0xddcd,0xad2a,0xbd0b,0x8d68,0x9d49,
-	0x7e97,0x6eb6,0x5ed5,0x4ef4,0x3e13,0x2e32,0x1e51,0x0e70,
-	0xff9f,0xefbe,0xdfdd,0xcffc,0xbf1b,0xaf3a,0x9f59,0x8f78,
-	0x9188,0x81a9,0xb1ca,0xa1eb,0xd10c,0xc12d,0xf14e,0xe16f,
-	0x1080,0x00a1,0x30c2,0x20e3,0x5004,0x4025,0x7046,0x6067,
-	0x83b9,0x9398,0xa3fb,0xb3da,0xc33d,0xd31c,0xe37f,0xf35e,
-	0x02b1,0x1290,0x22f3,0x32d2,0x4235,0x5214,0x6277,0x7256,
-	0xb5ea,0xa5cb,0x95a8,0x8589,0xf56e,0xe54f,0xd52c,0xc50d,
-	0x34e2,0x24c3,0x14a0,0x0481,0x7466,0x6447,0x5424,0x4405,
-	0xa7db,0xb7fa,0x8799,0x97b8,0xe75f,0xf77e,0xc71d,0xd73c,
-	0x26d3,0x36f2,0x0691,0x16b0,0x6657,0x7676,0x4615,0x5634,
-	0xd94c,0xc96d,0xf90e,0xe92f,0x99c8,0x89e9,0xb98a,0xa9ab,
-	0x5844,0x4865,0x7806,0x6827,0x18c0,0x08e1,0x3882,0x28a3,
-	0xcb7d,0xdb5c,0xeb3f,0xfb1e,0x8bf9,0x9bd8,0xabbb,0xbb9a,
-	0x4a75,0x5a54,0x6a37,0x7a16,0x0af1,0x1ad0,0x2ab3,0x3a92,
-	0xfd2e,0xed0f,0xdd6c,0xcd4d,0xbdaa,0xad8b,0x9de8,0x8dc9,
-	0x7c26,0x6c07,0x5c64,0x4c45,0x3ca2,0x2c83,0x1ce0,0x0cc1,
-	0xef1f,0xff3e,0xcf5d,0xdf7c,0xaf9b,0xbfba,0x8fd9,0x9ff8,
-	0x6e17,0x7e36,0x4e55,0x5e74,0x2e93,0x3eb2,0x0ed1,0x1ef0
-};
+/* Timeouts in milliseconds */
+#define YMODEM_C_TIMEOUT	5000
+#define YMODEM_ACK_TIMEOUT	1500
+#define YMODEM_XMIT_TIMEOUT	10000
+#define YMODEM_DRAIN_QUIET	100
 
-static inline uint16_t crc16_xmodem(const void *ptr, int len)
-{
-	int counter;
-	uint16_t crc = 0;
-	const unsigned char *buf = (const unsigned char *) ptr;
-	for(counter = 0; counter < len; counter++)
-		crc = (crc<<8) ^
-			crc16_tbl[((crc>>8)
-				   ^ * ((unsigned char *)(buf++)))&0x00FF];
-	return crc;
-}
+/* Maximum number of data blocks in flight when pipelining */
+#define YMODEM_WINDOW_MAX	16
+
+/* Frames prepared ahead by the producer, a power of 2 >= the window */
+#define YMODEM_RING_N		32
+
+/*
+  Link adaptation: after this many NAKs or timeouts in a row, frames
+  shrink to 128 B SOH ones, and grow back to 1024 B STX after a run of
+  clean ACKs. A window closed by a NAK reopens after
+  YMODEM_WINDOW_AFTER clean ACKs.
+
+  Tails up to YMODEM_SOH_TAIL bytes go out as SOH frames instead of a
+  padded STX one. Each frame costs a turnaround, which stop-and-wait
+  over USB is worth far more than the bytes saved, so only tails of one
+  or two of them.
+*/
+#define YMODEM_SOH_AFTER	3
+#define YMODEM_STX_AFTER	16
+#define YMODEM_WINDOW_AFTER	16
+#define YMODEM_SOH_TAIL		(2 * 128)
+
+/*
+  Transfer tunables, set by the frontend before calling ymodem_xfer().
+  A window of 1 is the plain stop-and-wait YModem. OUT_DRAIN waits
+  until what was written left the host, when the port can tell. ACK_MS
+  is how long an ACK is waited for, 0 for YMODEM_ACK_TIMEOUT.
+*/
+static struct ymodem_cfg {
+	int	window;
+	int	(*out_drain)(int fd);
+	int	ack_ms;
+} ymodem_cfg = {
+	.window = 1,
+};
 
-#define YMODEM_C_TIMEOUT	5
-#define YMODEM_ACK_TIMEOUT	1.5
-#define YMODEM_XMIT_TIMEOUT	10
+/* Outcome of the latest ymodem_xfer(), also valid after a failure */
+static struct ymodem_stat {
+	size_t	acked;		/* payload bytes acknowledged in order */
+	int	naks;
+	int	timeouts;
+	int	resent;		/* frames repeating data already sent */
+	int	soh;		/* data frames sent as 128 B ones */
+	int	frames;		/* data frames sent, resent ones included */
+	size_t	wire;		/* bytes of those frames */
+	int64_t	wait_ms;	/* until the receiver asked with C */
+	int64_t	ms;		/* from the first data frame to its last ACK */
+	int64_t	ack_max_ms;	/* longest wait that ended in an ACK */
+} ymodem_stat;
 
 /* Control Characters */
 #define SOH 0x01
@@ -90,30 +102,36 @@ static inline uint16_t crc16_xmodem(const void *ptr, int len)
 #define EOT 0x04
 #define ACK 0x06
 #define NAK 0x15
+#define CAN 0x18
 #define C   'C'
 
+/* 0 on ACK, EAGAIN on NAK, ETIMEDOUT if neither came, or -errno */
 static inline int ymodem_wait_ack(int fd)
 {
-	time_t t0 = time(NULL);
-	char cc;
+	int64_t t0 = mono_ms(), deadline;
+	struct frame_dec dec;
 	int ret;
 
+	deadline = t0 + (ymodem_cfg.ack_ms ? ymodem_cfg.ack_ms
+			 : YMODEM_ACK_TIMEOUT);
+	frame_dec_init(&dec);
 	while (1) {
-		ret = read(fd, &cc, 1);
+		ret = frame_next(fd, &dec, deadline);
 
-		if (ret == 0) continue;
+		if (ret == FRAME_NONE)
+			return ETIMEDOUT;
 		if (ret < 0) {
 			perror("ymodem_wait_ack");
 			return -errno;
 		}
 
-		if (cc == ACK)
+		if (ret == FRAME_ACK) {
+			if (mono_ms() - t0 > ymodem_stat.ack_max_ms)
+				ymodem_stat.ack_max_ms = mono_ms() - t0;
 			return 0;
+		}
 
-		if (cc == NAK)
-			return EAGAIN;
-
-		if (difftime(time(NULL), t0) > YMODEM_ACK_TIMEOUT)
+		if (ret == FRAME_NAK)
 			return EAGAIN;
 	}
 }
@@ -132,19 +150,15 @@ static inline int ymodem_blk_xmit(int fd, const uint8_t *blk, size_t len)
 		written += ret;
 	}
 
-	/* for (int i = 0; i < len; i++) */
-		/* printf("%02X ", blk[i]); */
-	/* printf("\n"); */
-
 	return 0;
 }
 
 static inline int ymodem_blk_timed_xmit(int fd, const uint8_t *blk, size_t len)
 {
-	time_t t0 = time(NULL);
+	int64_t deadline = deadline_in(YMODEM_XMIT_TIMEOUT);
 	int ret;
 blk_xmit:
-	if (difftime(time(NULL), t0) > YMODEM_XMIT_TIMEOUT) {
+	if (deadline_passed(deadline)) {
 		errno = ETIMEDOUT;
 		perror("ymodem_blk_timed_xmit");
 		return -errno;
@@ -157,45 +171,340 @@ blk_xmit:
 	ret = ymodem_wait_ack(fd);
 	if (ret < 0)
 		return ret;
-	if (ret > 0)
+	if (ret > 0) {
+		if (ret == EAGAIN)
+			ymodem_stat.naks++;
+		else
+			ymodem_stat.timeouts++;
+		ymodem_stat.resent++;
 		goto blk_xmit;
+	}
 
 	return 0;
 }
 
+/*
+  A data frame as it goes on the wire. The payload is referenced rather
+  than copied, so blocks can be sent straight out of a mapped image.
+*/
+struct ymodem_frame {
+	uint8_t		 hdr[3];
+	const uint8_t	*dat;
+	uint8_t		 crc[2];
+};
+
+/*
+  Send a TYPE (SOH or STX) frame numbered SEQ. The sequence number is
+  only settled at send time, as frame sizes may change mid-session.
+*/
+static inline int ymodem_frame_xmit(int fd, uint8_t type, uint8_t seq,
+				    const uint8_t *dat, const uint8_t *crc)
+{
+	uint8_t hdr[3] = { type, seq, 0xff - seq };
+	struct iovec iov[3] = {
+		{ hdr, sizeof(hdr) },
+		{ (void *) dat, type == STX ? 1024 : 128 },
+		{ (void *) crc, 2 },
+	};
+	struct iovec *v = iov;
+	int cnt = 3;
+
+	while (cnt > 0) {
+		ssize_t ret = writev(fd, v, cnt);
+		if (ret < 0) {
+			perror("ymodem_frame_xmit");
+			return -errno;
+		}
+
+		/* Skip what went out, a short write may stop mid-iovec */
+		while (cnt > 0 && (size_t) ret >= v->iov_len) {
+			ret -= v->iov_len;
+			v++, cnt--;
+		}
+		if (cnt > 0) {
+			v->iov_base = (uint8_t *) v->iov_base + ret;
+			v->iov_len -= ret;
+		}
+	}
+
+	return 0;
+}
+
+static inline void
+ymodem_frame_build(struct ymodem_frame *fr, int i_blk, const uint8_t *dat)
+{
+	fr->hdr[0] = STX;
+	fr->hdr[1] = i_blk % 0x100;
+	fr->hdr[2] = 0xff - fr->hdr[1];
+	fr->dat = dat;
+	*((uint16_t *) fr->crc) = htobe16(crc16_xmodem(dat, 1024));
+}
+
+/*
+  Frame producer stage
+
+  A producer thread walks the image, building and CRCing frames into a
+  single-producer/single-consumer ring while the sender only writes and
+  waits for ACKs, so page faults on a slow disk or a busy CPU don't idle
+  the line. Blocks that aren't contiguous in memory, or the padded last
+  one, are staged in the slot's own buffer.
+
+  `ready' and `acked' are the only shared state: the producer
+  advances `ready' after building a block and never overwrites a slot
+  the sender hasn't had ACKed yet, which keeps every in-flight frame
+  around for retransmission. The mutex & condition are only touched to
+  sleep when the ring is full or empty.
+*/
+struct ymodem_ring {
+	struct ymodem_frame	 fr[YMODEM_RING_N];
+	uint8_t			 stage[YMODEM_RING_N][1024];
+
+	const struct xfer_src	*src;
+	size_t			 ofs;
+	size_t			 len;
+	int			 total_blk;
+
+	atomic_int		 ready;	/* blocks built, 1-based */
+	atomic_int		 acked;	/* blocks acknowledged */
+	atomic_int		 stop;
+	atomic_int		 err;	/* errno of a failed source read */
+
+	pthread_mutex_t		 lock;
+	pthread_cond_t		 cond;
+};
+
+static inline void ymodem_ring_wake(struct ymodem_ring *r)
+{
+	pthread_mutex_lock(&r->lock);
+	pthread_cond_broadcast(&r->cond);
+	pthread_mutex_unlock(&r->lock);
+}
+
+static inline void *ymodem_ring_produce(void *arg)
+{
+	struct ymodem_ring *r = arg;
+	size_t last_blk = r->len % 1024;
+
+	for (int i_blk = 1; i_blk <= r->total_blk; i_blk++) {
+		size_t ofs = (size_t) (i_blk - 1) * 1024;
+		size_t n = (i_blk == r->total_blk && last_blk) ? last_blk : 1024;
+		uint8_t *stage = r->stage[i_blk % YMODEM_RING_N];
+		const uint8_t *blk;
+
+		pthread_mutex_lock(&r->lock);
+		while (!atomic_load(&r->stop)
+		       && i_blk - atomic_load(&r->acked) > YMODEM_RING_N)
+			pthread_cond_wait(&r->cond, &r->lock);
+		pthread_mutex_unlock(&r->lock);
+
+		if (atomic_load(&r->stop))
+			break;
+
+		blk = xfer_src_get(r->src, r->ofs + ofs, n, stage);
+		if (!blk) {
+			atomic_store(&r->err, errno);
+			ymodem_ring_wake(r);
+			break;
+		}
+
+		if (n < 1024) {
+			if (blk != stage)
+				memcpy(stage, blk, n);
+			memset(stage + n, 0, 1024 - n);
+			blk = stage;
+		}
+
+		ymodem_frame_build(&r->fr[i_blk % YMODEM_RING_N], i_blk, blk);
+
+		atomic_store(&r->ready, i_blk);
+		ymodem_ring_wake(r);
+	}
+
+	return NULL;
+}
+
 static inline int
-ymodem_xfer(int fd, FILE *f, const char *fn, size_t len, int verbose)
+ymodem_ring_start(struct ymodem_ring *r, pthread_t *th,
+		  const struct xfer_src *src, size_t ofs, size_t len)
 {
-        int total_blk = ceil(len/1024.0), i_blk = 0;
-	uint8_t blkbuf[1029], cc, occ;
-	size_t last_blk = (last_blk = len - ((len/1024)*1024)) ? last_blk : 1024;
-	time_t t0 = time(NULL);
+	int ret;
+
+	r->src = src;
+	r->ofs = ofs;
+	r->len = len;
+	r->total_blk = (len + 1023) / 1024;
+	atomic_init(&r->ready, 0);
+	atomic_init(&r->acked, 0);
+	atomic_init(&r->stop, 0);
+	atomic_init(&r->err, 0);
+	pthread_mutex_init(&r->lock, NULL);
+	pthread_cond_init(&r->cond, NULL);
+
+	ret = pthread_create(th, NULL, ymodem_ring_produce, r);
+	if (ret) {
+		errno = ret;
+		perror("pthread_create");
+		return -errno;
+	}
+
+	return 0;
+}
+
+static inline void ymodem_ring_stop(struct ymodem_ring *r, pthread_t th)
+{
+	atomic_store(&r->stop, 1);
+	ymodem_ring_wake(r);
+	pthread_join(th, NULL);
+	pthread_cond_destroy(&r->cond);
+	pthread_mutex_destroy(&r->lock);
+}
+
+/*
+  Frame of block I_BLK, waiting for the producer if it isn't built yet.
+  NULL with errno set if the source couldn't be read.
+*/
+static inline const struct ymodem_frame *
+ymodem_ring_get(struct ymodem_ring *r, int i_blk)
+{
+	if (atomic_load(&r->ready) < i_blk) {
+		pthread_mutex_lock(&r->lock);
+		while (atomic_load(&r->ready) < i_blk
+		       && !atomic_load(&r->err))
+			pthread_cond_wait(&r->cond, &r->lock);
+		pthread_mutex_unlock(&r->lock);
+	}
+
+	if (atomic_load(&r->ready) < i_blk) {
+		errno = atomic_load(&r->err);
+		return NULL;
+	}
+
+	return &r->fr[i_blk % YMODEM_RING_N];
+}
+
+/* Hand the slot of block I_BLK back to the producer */
+static inline void ymodem_ring_release(struct ymodem_ring *r, int i_blk)
+{
+	atomic_store(&r->acked, i_blk);
+	if (atomic_load(&r->ready) < r->total_blk)
+		ymodem_ring_wake(r);
+}
+
+/* Discard whatever the receiver is still replying, until the line idles */
+static inline void ymodem_drain(int fd)
+{
+	char buf[64];
+
+	while (rx_read(fd, buf, sizeof(buf),
+		       deadline_in(YMODEM_DRAIN_QUIET)) > 0)
+		;
+}
+
+/* Cancel the session on the receiver side and wait for it to settle */
+static inline void ymodem_abort(int fd)
+{
+	const uint8_t can[] = { CAN, CAN, CAN, CAN, CAN };
+
+	ymodem_blk_xmit(fd, can, sizeof(can));
+	ymodem_drain(fd);
+}
+
+/* Longest FN block 0 holds, with its NUL and "0x" + 16 digits + NUL */
+#define YMODEM_FN_MAX	(128 - 20)
+
+/*
+  Block 0, the file info header carrying FN & LEN, or the empty one
+  closing the batch if FN is NULL. FN is cut to YMODEM_FN_MAX.
+*/
+static inline void ymodem_blk0_build(uint8_t blk[128+5], const char *fn,
+				     size_t len)
+{
+	memset(blk, 0, 128+5);
+	blk[0] = SOH; blk[1] = 0x00; blk[2] = 0xff;
+
+	if (fn) {
+		size_t fnlen = strnlen(fn, YMODEM_FN_MAX);
+
+		memcpy(blk+3, fn, fnlen);
+		snprintf((char *) blk+3+fnlen+1, 127 - fnlen, "0x%zx", len);
+	}
+
+	*((uint16_t *) (blk + 131)) = htobe16(crc16_xmodem(blk+3, 128));
+}
+
+/* Whether the REST of an image, less than a block, goes out as SOH */
+static inline int ymodem_tail_soh(size_t rest)
+{
+	return rest <= YMODEM_SOH_TAIL;
+}
+
+/*
+  A pre-framed session, as emitted by blob/mkframes: block 0, the STX
+  frames of the whole blocks, the tail as ymodem_xfer() sends it (SOH
+  frames or one padded STX frame) and the closing block 0, back to back.
+*/
+static inline size_t ymodem_pre_len(size_t len)
+{
+	size_t tail = len % 1024, n = 2 * (128+5) + len / 1024 * (1024+5);
+
+	if (tail && ymodem_tail_soh(tail))
+		n += (tail + 127) / 128 * (128+5);
+	else if (tail)
+		n += 1024+5;
+	return n;
+}
+
+/* The frame of a pre-framed session of LEN that starts at image OFS */
+static inline const uint8_t *
+ymodem_pre_frame(const uint8_t *pre, size_t len, size_t ofs)
+{
+	size_t whole = len / 1024 * 1024;
+
+	pre += 128+5;
+	if (ofs < whole || !ymodem_tail_soh(len - whole))
+		return pre + ofs / 1024 * (1024+5);
+	return pre + whole / 1024 * (1024+5) + (ofs - whole) / 128 * (128+5);
+}
+
+/*
+  Run a session for LEN bytes named FN. Frames come from RING, or from
+  PRE if it is pre-framed, in which case nothing is built nor CRC'd.
+*/
+static inline int
+ymodem_session_run(int fd, struct ymodem_ring *ring, const uint8_t *pre,
+		   const char *fn, size_t len, int verbose)
+{
+        int total_blk = ceil(len/1024.0);
+	uint8_t blkbuf[1029];
+	struct frame_dec dec;
+	int64_t deadline = deadline_in(YMODEM_C_TIMEOUT);
 	int ret, pgbk = 0;
 
-	/* Waiting for C */
-	if (verbose) printf("< ");
+	memset(&ymodem_stat, 0, sizeof(ymodem_stat));
+	ymodem_stat.wait_ms = mono_ms();
+
+	/* Waiting for C, showing what the receiver prints meanwhile */
+	frame_dec_init(&dec);
 	while (1) {
-		ret = read(fd, &cc, 1);
+		ret = frame_next(fd, &dec, deadline);
 
 		if (ret < 0) {
 			perror("read");
 			return -errno;
 		}
 
-		if (ret == 0 && difftime(time(NULL), t0) > YMODEM_C_TIMEOUT) {
+		if (ret == FRAME_NONE) {
 			errno = ETIMEDOUT;
 			perror("read");
 			return -errno;
 		}
 
-		if (ret > 0 && cc == C) break;
+		if (ret == FRAME_C) break;
 
-		if (verbose && isascii(cc) && isprint(cc))
-			printf("%c", (occ = cc));
-		else if (verbose && cc == '\n' && occ != '\n')
-			printf("%c< ", occ = cc);
+		if (verbose && ret == FRAME_LINE && *dec.line)
+			printf("< %s\n", dec.line);
 	};
-	if (verbose && occ != '\n') printf("\n");
+	ymodem_stat.wait_ms = mono_ms() - ymodem_stat.wait_ms;
 
 	/* Display current progress */
 	pgbk = 2;		/* "0%" */
@@ -204,57 +513,187 @@ ymodem_xfer(int fd, FILE *f, const char *fn, size_t len, int verbose)
 
 	/* Block 0: File Info */
 
-	memset(blkbuf, 0, sizeof(blkbuf));
-	blkbuf[0] = SOH; blkbuf[1] = 0x00; blkbuf[2] = 0xff;
-
-	strncpy((char *) blkbuf+3, fn, 128);
-
-	snprintf((char *) blkbuf+3+strlen(fn)+ 1,
-		 127 - strlen(fn), "0x%zx", len);
+	if (!pre)
+		ymodem_blk0_build(blkbuf, fn, len);
 
-	*((uint16_t *) (blkbuf + 131)) = htobe16(crc16_xmodem(blkbuf+3, 128));
-
-	ret = ymodem_blk_timed_xmit(fd, blkbuf, 128+5);
+	ret = ymodem_blk_timed_xmit(fd, pre ? pre : blkbuf, 128+5);
 	if (ret < 0)
 		return ret;
 
-	i_blk++;
-
-	/* Data Blocks: File Data */
-	size_t wrote_bytes = 0;
-
-	while (i_blk < total_blk+1) {
-		size_t rlen = (i_blk == total_blk) ? last_blk : 1024;
-		memset(blkbuf, 0, sizeof(blkbuf));
-
-		blkbuf[0] = STX;
-		blkbuf[1] = i_blk % 0x100;
-		blkbuf[2] = 0xff - (blkbuf[1]);
-
-		ret = fread(blkbuf+3, 1, rlen, f);
-		if (i_blk < total_blk && ret < 1024) {
-			printf("\nERROR: No data left on file.");
-			fflush(stdout);
-			return EXIT_FAILURE;
+	/*
+	  Data Blocks: File Data
+
+	  Up to `window' frames are sent ahead of the oldest unacknowledged
+	  one. YModem ACKs carry no sequence number, so they are matched to
+	  the frames in flight in order. Once the receiver NAKs or stalls
+	  with more than one frame outstanding, the frames behind it are
+	  let out and whatever the receiver says to them is dropped, so no
+	  stale ACK is taken for a resent frame. Transfer goes on
+	  stop-and-wait from that frame, until a run of clean ACKs reopens
+	  the window.
+
+	  Blocks come from the producer ring or the pre-framed image, both
+	  1024 B with their CRC. On a link bad enough to keep NAKing, they
+	  go out as 128 B slices instead, CRC'd here, until it recovers;
+	  in flight frames are therefore tracked by offset, not by block.
+	*/
+	struct {
+		size_t	ofs;
+		uint8_t	seq;
+		uint8_t	type;
+	} fl[YMODEM_WINDOW_MAX];
+	int window = ymodem_cfg.window, n_fl = 0, soh = 0, bad = 0, clean = 0;
+	int window_max;
+	int64_t t0, tack;
+	size_t pos = 0, sent_hi = 0, wrote_bytes = 0;
+	uint8_t seq = 1;
+
+	if (window < 1)
+		window = 1;
+	if (window > YMODEM_WINDOW_MAX)
+		window = YMODEM_WINDOW_MAX;
+	window_max = window;
+
+	t0 = tack = mono_ms();
+
+	while (wrote_bytes < len) {
+		while (pos < len && n_fl < window) {
+			int i_blk = pos / 1024 + 1;
+			uint8_t type = (soh || ymodem_tail_soh(len - pos))
+				? SOH : STX;
+			const uint8_t *dat, *crc, *pf = NULL;
+			uint8_t soh_crc[2];
+
+			if (pre) {
+				pf = ymodem_pre_frame(pre, len, pos);
+				dat = pf + 3;
+				crc = dat + (pf[0] == STX ? 1024 : 128);
+			} else {
+				const struct ymodem_frame *fr;
+
+				fr = ymodem_ring_get(ring, i_blk);
+				if (!fr) {
+					perror("\nymodem_xfer");
+					return -errno;
+				}
+				dat = fr->dat;
+				crc = fr->crc;
+			}
+
+			/*
+			  Slices of a block are CRC'd here, unless pre-framed.
+			  Blocks are zero padded, a slice never runs off.
+			*/
+			if (type == SOH && !(pf && pf[0] == SOH)) {
+				dat += pos % 1024;
+				*((uint16_t *) soh_crc) =
+					htobe16(crc16_xmodem(dat, 128));
+				crc = soh_crc;
+			}
+			if (type == SOH)
+				ymodem_stat.soh++;
+
+			ret = ymodem_frame_xmit(fd, type, seq, dat, crc);
+			if (ret < 0)
+				return ret;
+			ymodem_stat.frames++;
+			ymodem_stat.wire += (type == STX) ? 1024+5 : 128+5;
+
+			fl[n_fl].ofs = pos;
+			fl[n_fl].seq = seq++;
+			fl[n_fl++].type = type;
+
+			if (pos < sent_hi)
+				ymodem_stat.resent++;
+			pos += (type == STX) ? 1024 : 128;
+			if (pos > len)
+				pos = len;
+			if (pos > sent_hi)
+				sent_hi = pos;
 		}
 
-		*((uint16_t *) (blkbuf + 1027)) = \
-			htobe16(crc16_xmodem(blkbuf+3, 1024));
-
-		ret = ymodem_blk_timed_xmit(fd, blkbuf, 1029);
+		ret = ymodem_wait_ack(fd);
 		if (ret < 0)
 			return ret;
 
-		wrote_bytes += rlen;
+		if (ret > 0) {
+			if (ret == EAGAIN)
+				ymodem_stat.naks++;
+			else
+				ymodem_stat.timeouts++;
+			clean = 0;
+
+			if (mono_ms() - tack > YMODEM_XMIT_TIMEOUT) {
+				errno = ETIMEDOUT;
+				perror("\nymodem_xfer");
+				return -errno;
+			}
+
+			if (n_fl > 1) {
+				if (verbose)
+					printf("\nNAK with %d BLK in flight, "
+					       "falling back to stop-and-wait\n",
+					       n_fl);
+				if (ymodem_cfg.out_drain)
+					ymodem_cfg.out_drain(fd);
+				ymodem_drain(fd);
+				window = 1;
+			}
+
+			if (++bad >= YMODEM_SOH_AFTER && !soh) {
+				if (verbose)
+					printf("\n%d NAKs or timeouts in a row, "
+					       "dropping to 128 B frames\n", bad);
+				soh = 1;
+				window = 1;
+			}
+
+			/* Go back to the oldest unacknowledged frame */
+			pos = fl[0].ofs;
+			seq = fl[0].seq;
+			n_fl = 0;
+			continue;
+		}
+
+		tack = mono_ms();
+		bad = 0;
+
+		wrote_bytes = fl[0].ofs + ((fl[0].type == STX) ? 1024 : 128);
+		if (wrote_bytes > len)
+			wrote_bytes = len;
+		ymodem_stat.acked = wrote_bytes;
+		if (ring && (wrote_bytes % 1024 == 0 || wrote_bytes == len))
+			ymodem_ring_release(ring, (wrote_bytes + 1023) / 1024);
+
+		memmove(fl, fl + 1, sizeof(fl[0]) * --n_fl);
+
+		/* Grow back on a block boundary, once the link looks sane */
+		if (soh && ++clean >= YMODEM_STX_AFTER && pos % 1024 == 0) {
+			if (verbose)
+				printf("\n%d clean ACKs, back to 1024 B frames\n",
+				       clean);
+			soh = 0;
+			clean = 0;
+		} else if (!soh && window < window_max
+			   && ++clean >= YMODEM_WINDOW_AFTER) {
+			if (verbose)
+				printf("\n%d clean ACKs, reopening the window "
+				       "to %d BLK\n", clean, window_max);
+			window = window_max;
+			clean = 0;
+		}
+
+		double secs = (tack - t0) / 1000.0;
 
 		for (int i = 0; i < pgbk; i++)
 			putchar('\b');
-		pgbk = printf("%zu%%", wrote_bytes*100/len);
+		pgbk = printf("%zu%% %.1fKiB/s", wrote_bytes*100/len,
+			      secs > 0 ? wrote_bytes / 1024.0 / secs : 0.0);
 		fflush(stdout);
-
-		i_blk++;
 	}
 
+	ymodem_stat.ms = tack - t0;
+
 	/* EOT */
 
 	char eot = EOT;
@@ -269,16 +708,21 @@ eot_xmit:
 	ret = ymodem_wait_ack(fd);
 	if (ret < 0)
 		return ret;
-	if (ret > 0)
+	if (ret > 0) {
+		ymodem_stat.resent++;
 		goto eot_xmit;
+	}
 
 	/* Block 0: Finish Xmit */
 
-	memset(blkbuf, 0, sizeof(blkbuf));
-	blkbuf[0] = SOH; blkbuf[1] = 0x00; blkbuf[2] = 0xff;
-	*((uint16_t *) (blkbuf + 131)) = htobe16(crc16_xmodem(blkbuf+3, 128));
+	const uint8_t *fin = blkbuf;
 
-	ret = ymodem_blk_timed_xmit(fd, blkbuf, 128+5);
+	if (!pre)
+		ymodem_blk0_build(blkbuf, NULL, 0);
+	else
+		fin = pre + ymodem_pre_len(len) - (128+5);
+
+	ret = ymodem_blk_timed_xmit(fd, fin, 128+5);
 	if (ret < 0)
 		return ret;
 
@@ -286,4 +730,54 @@ eot_xmit:
 	return EXIT_SUCCESS;
 }
 
+static inline int
+ymodem_session(int fd, struct ymodem_ring *ring, const uint8_t *pre,
+	       const char *fn, size_t len, int verbose)
+{
+	int ret = ymodem_session_run(fd, ring, pre, fn, len, verbose);
+	struct ymodem_stat *st = &ymodem_stat;
+
+	/* Link quality summary, worth a look whenever it's not spotless */
+	if (verbose || st->naks || st->timeouts || st->resent)
+		printf("%s: %d NAK, %d timeout, %d resent, %d SOH frame(s)\n",
+		       fn, st->naks, st->timeouts, st->resent, st->soh);
+
+	return ret;
+}
+
+/* Send LEN bytes of SRC from OFS as FN */
+static inline int
+ymodem_xfer_src(int fd, const struct xfer_src *src, size_t ofs, size_t len,
+		const char *fn, int verbose)
+{
+	static struct ymodem_ring ring;
+	pthread_t producer;
+	int ret;
+
+	/* Start building frames while the receiver gets ready */
+	ret = ymodem_ring_start(&ring, &producer, src, ofs, len);
+	if (ret < 0)
+		return ret;
+
+	ret = ymodem_session(fd, &ring, NULL, fn, len, verbose);
+	ymodem_ring_stop(&ring, producer);
+	return ret;
+}
+
+static inline int
+ymodem_xfer(int fd, const uint8_t *dat, const char *fn, size_t len, int verbose)
+{
+	struct xfer_src src = xfer_src_buf(dat, len);
+
+	return ymodem_xfer_src(fd, &src, 0, len, fn, verbose);
+}
+
+/* Send a session pre-framed by blob/mkframes, for an image of LEN */
+static inline int
+ymodem_xfer_frames(int fd, const uint8_t *pre, const char *fn, size_t len,
+		   int verbose)
+{
+	return ymodem_session(fd, NULL, pre, fn, len, verbose);
+}
+
 #endif /* _YMODEM_H_ */